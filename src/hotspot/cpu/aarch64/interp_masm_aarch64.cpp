@@ -471,127 +471,135 @@ void InterpreterMacroAssembler::dispatch_via(TosState state, address* table) {
 //       installs IllegalMonitorStateException
 //    Else
 //       no error processing
+//
+// If !check_monitors the caller guarantees that the method is not
+// synchronized and has no monitor bytecodes (_fast_*return), so the
+// unlock and monitor block scan are omitted.
 void InterpreterMacroAssembler::remove_activation(TosState state,
                                                   bool throw_monitor_exception,
                                                   bool install_monitor_exception,
-                                                  bool notify_jvmdi) {
+                                                  bool notify_jvmdi,
+                                                  bool check_monitors) {
   // Note: Registers r3 xmm0 may be in use for the
   // result check if synchronized method
   Label unlocked, unlock, no_unlock;
 
-  // get the value of _do_not_unlock_if_synchronized into r3
-  const Address do_not_unlock_if_synchronized(rthread,
-    in_bytes(JavaThread::do_not_unlock_if_synchronized_offset()));
-  ldrb(r3, do_not_unlock_if_synchronized);
-  strb(zr, do_not_unlock_if_synchronized); // reset the flag
-
- // get method access flags
-  ldr(r1, Address(rfp, frame::interpreter_frame_method_offset * wordSize));
-  ldrh(r2, Address(r1, Method::access_flags_offset()));
-  tbz(r2, exact_log2(JVM_ACC_SYNCHRONIZED), unlocked);
-
-  // Don't unlock anything if the _do_not_unlock_if_synchronized flag
-  // is set.
-  cbnz(r3, no_unlock);
-
-  // unlock monitor
-  push(state); // save result
-
-  // BasicObjectLock will be first in list, since this is a
-  // synchronized method. However, need to check that the object has
-  // not been unlocked by an explicit monitorexit bytecode.
-  const Address monitor(rfp, frame::interpreter_frame_initial_sp_offset *
-                        wordSize - (int) sizeof(BasicObjectLock));
-  // We use c_rarg1 so that if we go slow path it will be the correct
-  // register for unlock_object to pass to VM directly
-  lea(c_rarg1, monitor); // address of first monitor
-
-  ldr(r0, Address(c_rarg1, BasicObjectLock::obj_offset()));
-  cbnz(r0, unlock);
-
-  pop(state);
-  if (throw_monitor_exception) {
-    // Entry already unlocked, need to throw exception
-    call_VM(noreg, CAST_FROM_FN_PTR(address,
-                   InterpreterRuntime::throw_illegal_monitor_state_exception));
-    should_not_reach_here();
-  } else {
-    // Monitor already unlocked during a stack unroll. If requested,
-    // install an illegal_monitor_state_exception.  Continue with
-    // stack unrolling.
-    if (install_monitor_exception) {
-      call_VM(noreg, CAST_FROM_FN_PTR(address,
-                     InterpreterRuntime::new_illegal_monitor_state_exception));
-    }
-    b(unlocked);
-  }
-
-  bind(unlock);
-  unlock_object(c_rarg1);
-  pop(state);
-
-  // Check that for block-structured locking (i.e., that all locked
-  // objects has been unlocked)
-  bind(unlocked);
-
-  // r0: Might contain return value
-
-  // Check that all monitors are unlocked
-  {
-    Label loop, exception, entry, restart;
-    const int entry_size = frame::interpreter_frame_monitor_size_in_bytes();
-    const Address monitor_block_top(
-        rfp, frame::interpreter_frame_monitor_block_top_offset * wordSize);
-    const Address monitor_block_bot(
-        rfp, frame::interpreter_frame_initial_sp_offset * wordSize);
-
-    bind(restart);
+  if (check_monitors) {
+    // get the value of _do_not_unlock_if_synchronized into r3
+    const Address do_not_unlock_if_synchronized(rthread,
+      in_bytes(JavaThread::do_not_unlock_if_synchronized_offset()));
+    ldrb(r3, do_not_unlock_if_synchronized);
+    strb(zr, do_not_unlock_if_synchronized); // reset the flag
+
+   // get method access flags
+    ldr(r1, Address(rfp, frame::interpreter_frame_method_offset * wordSize));
+    ldrh(r2, Address(r1, Method::access_flags_offset()));
+    tbz(r2, exact_log2(JVM_ACC_SYNCHRONIZED), unlocked);
+
+    // Don't unlock anything if the _do_not_unlock_if_synchronized flag
+    // is set.
+    cbnz(r3, no_unlock);
+
+    // unlock monitor
+    push(state); // save result
+
+    // BasicObjectLock will be first in list, since this is a
+    // synchronized method. However, need to check that the object has
+    // not been unlocked by an explicit monitorexit bytecode.
+    const Address monitor(rfp, frame::interpreter_frame_initial_sp_offset *
+                          wordSize - (int) sizeof(BasicObjectLock));
     // We use c_rarg1 so that if we go slow path it will be the correct
     // register for unlock_object to pass to VM directly
-    ldr(c_rarg1, monitor_block_top); // derelativize pointer
-    lea(c_rarg1, Address(rfp, c_rarg1, Address::lsl(Interpreter::logStackElementSize)));
-    // c_rarg1 points to current entry, starting with top-most entry
+    lea(c_rarg1, monitor); // address of first monitor
 
-    lea(r19, monitor_block_bot);  // points to word before bottom of
-                                  // monitor block
-    b(entry);
-
-    // Entry already locked, need to throw exception
-    bind(exception);
+    ldr(r0, Address(c_rarg1, BasicObjectLock::obj_offset()));
+    cbnz(r0, unlock);
 
+    pop(state);
     if (throw_monitor_exception) {
-      // Throw exception
-      MacroAssembler::call_VM(noreg,
-                              CAST_FROM_FN_PTR(address, InterpreterRuntime::
-                                   throw_illegal_monitor_state_exception));
+      // Entry already unlocked, need to throw exception
+      call_VM(noreg, CAST_FROM_FN_PTR(address,
+                     InterpreterRuntime::throw_illegal_monitor_state_exception));
       should_not_reach_here();
     } else {
-      // Stack unrolling. Unlock object and install illegal_monitor_exception.
-      // Unlock does not block, so don't have to worry about the frame.
-      // We don't have to preserve c_rarg1 since we are going to throw an exception.
-
-      push(state);
-      unlock_object(c_rarg1);
-      pop(state);
-
+      // Monitor already unlocked during a stack unroll. If requested,
+      // install an illegal_monitor_state_exception.  Continue with
+      // stack unrolling.
       if (install_monitor_exception) {
         call_VM(noreg, CAST_FROM_FN_PTR(address,
-                                        InterpreterRuntime::
-                                        new_illegal_monitor_state_exception));
+                       InterpreterRuntime::new_illegal_monitor_state_exception));
       }
+      b(unlocked);
+    }
 
-      b(restart);
+    bind(unlock);
+    unlock_object(c_rarg1);
+    pop(state);
+
+    // Check that for block-structured locking (i.e., that all locked
+    // objects has been unlocked)
+    bind(unlocked);
+
+    // r0: Might contain return value
+
+    // Check that all monitors are unlocked
+    {
+      Label loop, exception, entry, restart;
+      const int entry_size = frame::interpreter_frame_monitor_size_in_bytes();
+      const Address monitor_block_top(
+          rfp, frame::interpreter_frame_monitor_block_top_offset * wordSize);
+      const Address monitor_block_bot(
+          rfp, frame::interpreter_frame_initial_sp_offset * wordSize);
+
+      bind(restart);
+      // We use c_rarg1 so that if we go slow path it will be the correct
+      // register for unlock_object to pass to VM directly
+      ldr(c_rarg1, monitor_block_top); // derelativize pointer
+      lea(c_rarg1, Address(rfp, c_rarg1, Address::lsl(Interpreter::logStackElementSize)));
+      // c_rarg1 points to current entry, starting with top-most entry
+
+      lea(r19, monitor_block_bot);  // points to word before bottom of
+                                    // monitor block
+      b(entry);
+
+      // Entry already locked, need to throw exception
+      bind(exception);
+
+      if (throw_monitor_exception) {
+        // Throw exception
+        MacroAssembler::call_VM(noreg,
+                                CAST_FROM_FN_PTR(address, InterpreterRuntime::
+                                     throw_illegal_monitor_state_exception));
+        should_not_reach_here();
+      } else {
+        // Stack unrolling. Unlock object and install illegal_monitor_exception.
+        // Unlock does not block, so don't have to worry about the frame.
+        // We don't have to preserve c_rarg1 since we are going to throw an exception.
+
+        push(state);
+        unlock_object(c_rarg1);
+        pop(state);
+
+        if (install_monitor_exception) {
+          call_VM(noreg, CAST_FROM_FN_PTR(address,
+                                          InterpreterRuntime::
+                                          new_illegal_monitor_state_exception));
+        }
+
+        b(restart);
+      }
+
+      bind(loop);
+      // check if current entry is used
+      ldr(rscratch1, Address(c_rarg1, BasicObjectLock::obj_offset()));
+      cbnz(rscratch1, exception);
+
+      add(c_rarg1, c_rarg1, entry_size); // otherwise advance to next entry
+      bind(entry);
+      cmp(c_rarg1, r19); // check if bottom reached
+      br(Assembler::NE, loop); // if not at bottom then check this entry
     }
 
-    bind(loop);
-    // check if current entry is used
-    ldr(rscratch1, Address(c_rarg1, BasicObjectLock::obj_offset()));
-    cbnz(rscratch1, exception);
-
-    add(c_rarg1, c_rarg1, entry_size); // otherwise advance to next entry
-    bind(entry);
-    cmp(c_rarg1, r19); // check if bottom reached
-    br(Assembler::NE, loop); // if not at bottom then check this entry
   }
 
   bind(no_unlock);
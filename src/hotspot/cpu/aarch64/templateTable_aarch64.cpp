@@ -47,6 +47,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
+#include "services/runtimeService.hpp"
 #include "utilities/powerOfTwo.hpp"
 
 #define __ Disassembler::hook<InterpreterMacroAssembler>(__FILE__, __LINE__, _masm)->
@@ -2229,7 +2230,21 @@ void TemplateTable::_return(TosState state)
     __ narrow(r0);
   }
 
-  __ remove_activation(state);
+  if (Bytecodes::is_fast_return(_desc->bytecode())) {
+    address counter = RuntimeService::interpreted_fast_returns_addr();
+    if (counter != nullptr) {
+      __ lea(rscratch2, ExternalAddress(counter));
+      __ increment(Address(rscratch2));
+    }
+    // The Rewriter only emits _fast_*return for methods without monitors.
+    __ remove_activation(state,
+                         true /* throw_monitor_exception */,
+                         true /* install_monitor_exception */,
+                         true /* notify_jvmdi */,
+                         false /* check_monitors */);
+  } else {
+    __ remove_activation(state);
+  }
   __ ret(lr);
 }
 
@@ -3405,6 +3420,98 @@ void TemplateTable::invokestatic(int byte_no)
   __ jump_from_interpreted(rmethod, r0);
 }
 
+// Self-recursive invokestatic in tail position, see Rewriter::rewrite_self_tail_calls.
+// Instead of pushing a new activation, the outgoing arguments overwrite the
+// parameters and the method restarts at bci 0 in the current frame.
+void TemplateTable::fast_tailcall(int byte_no)
+{
+  transition(vtos, vtos);
+  assert(byte_no == f1_byte, "use this argument");
+
+  Label slow_path;
+
+  if (!OptimizeSelfTailCalls) {
+    // The bytecode may come from an archive dumped with the optimization on.
+    __ movw(rscratch1, Bytecodes::_invokestatic);
+    __ dispatch_only_normal(vtos);
+    return;
+  }
+
+  // Threads in interp_only_mode must see every method entry and exit.
+  __ ldrw(rscratch1, Address(rthread, JavaThread::interp_only_mode_offset()));
+  __ cbnzw(rscratch1, slow_path);
+
+  // The call is never resolved here, so after RedefineClasses an old method
+  // must make a real call that reaches the current version.
+  __ ldrw(rscratch1, Address(rmethod, Method::flags_offset()));
+  __ tstw(rscratch1, MethodFlags::is_old_mask());
+  __ br(Assembler::NE, slow_path);
+
+  // Once compiled code exists, make a real call so that the rest of the
+  // recursion runs there; the compilers turn the tail call into a loop too.
+  __ ldr(rscratch1, Address(rmethod, Method::code_offset()));
+  __ cbnz(rscratch1, slow_path);
+
+  // Count the restart as an invocation so that the method gets compiled.
+  int increment = InvocationCounter::count_increment;
+  Label no_mdo, counted, overflow;
+  if (ProfileInterpreter) {
+    __ ldr(r0, Address(rmethod, Method::method_data_offset()));
+    __ cbz(r0, no_mdo);
+    const Address mdo_invocation_counter(r0, in_bytes(MethodData::invocation_counter_offset()) +
+                                              in_bytes(InvocationCounter::counter_offset()));
+    const Address mdo_mask(r0, in_bytes(MethodData::invoke_mask_offset()));
+    __ increment_mask_and_jump(mdo_invocation_counter, increment, mdo_mask, rscratch1, rscratch2, false, Assembler::EQ, &overflow);
+    __ b(counted);
+  }
+  __ bind(no_mdo);
+  const Address invocation_counter(rscratch2,
+                MethodCounters::invocation_counter_offset() +
+                InvocationCounter::counter_offset());
+  __ get_method_counters(rmethod, rscratch2, counted);
+  const Address mask(rscratch2, in_bytes(MethodCounters::invoke_mask_offset()));
+  __ increment_mask_and_jump(invocation_counter, increment, mask, rscratch1, r1, false, Assembler::EQ, &overflow);
+  __ b(counted);
+
+  __ bind(overflow);
+  __ mov(c_rarg1, 0);
+  __ call_VM(noreg, CAST_FROM_FN_PTR(address, InterpreterRuntime::frequency_counter_overflow), c_rarg1);
+  __ get_method(rmethod);
+
+  __ bind(counted);
+
+  // Copy the arguments into locals 0..n-1. The first argument is the deepest
+  // expression stack slot and both areas grow towards lower addresses.
+  Label loop, done;
+  __ ldr(r2, Address(rmethod, Method::const_offset()));
+  __ load_unsigned_short(r2, Address(r2, ConstMethod::size_of_parameters_offset()));
+  __ cbz(r2, done);
+  __ lea(r3, Address(esp, r2, Address::lsl(3)));
+  __ mov(r4, rlocals);
+  __ bind(loop);
+  __ ldr(r0, Address(__ pre(r3, -wordSize)));
+  __ str(r0, Address(__ post(r4, -wordSize)));
+  __ subs(r2, r2, 1);
+  __ br(Assembler::NE, loop);
+  __ bind(done);
+
+  // Restart at bci 0 with an empty expression stack, polling like a backward branch.
+  __ empty_expression_stack();
+  __ ldr(rbcp, Address(rmethod, Method::const_offset()));
+  __ add(rbcp, rbcp, in_bytes(ConstMethod::codes_offset()));
+  if (ProfileInterpreter) {
+    // The profile position must follow bcp back to bci 0.
+    __ set_method_data_pointer_for_bcp();
+  }
+  __ load_unsigned_byte(rscratch1, Address(rbcp, 0));
+  __ dispatch_only(vtos, /*generate_poll*/true);
+
+  // Execute the bytecode as the plain invokestatic it was rewritten from.
+  __ bind(slow_path);
+  __ movw(rscratch1, Bytecodes::_invokestatic);
+  __ dispatch_only_normal(vtos);
+}
+
 void TemplateTable::fast_invokevfinal(int byte_no)
 {
   __ call_Unimplemented();
@@ -3783,6 +3783,13 @@ void TemplateTable::fast_invokevfinal(int byte_no) {
 }
 
 
+void TemplateTable::fast_tailcall(int byte_no) {
+  transition(vtos, vtos);
+  assert(byte_no == f1_byte, "use this argument");
+  __ stop("fast_tailcall is not used on ARM");
+}
+
+
 void TemplateTable::invokeinterface(int byte_no) {
   transition(vtos, vtos);
   assert(byte_no == f1_byte, "use this argument");
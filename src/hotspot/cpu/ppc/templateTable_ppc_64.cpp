@@ -3494,6 +3494,12 @@ void TemplateTable::fast_invokevfinal(int byte_no) {
   invokevfinal_helper(Rcache, R11_scratch1, R12_scratch2, R22_tmp2, R23_tmp3);
 }
 
+void TemplateTable::fast_tailcall(int byte_no) {
+  transition(vtos, vtos);
+  assert(byte_no == f1_byte, "use this argument");
+  __ stop("fast_tailcall not used on PPC64");
+}
+
 void TemplateTable::invokevfinal_helper(Register Rcache,
                                         Register Rscratch1, Register Rscratch2, Register Rscratch3, Register Rscratch4) {
 
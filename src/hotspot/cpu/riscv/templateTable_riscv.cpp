@@ -3315,6 +3315,10 @@ void TemplateTable::fast_invokevfinal(int byte_no) {
   __ call_Unimplemented();
 }
 
+void TemplateTable::fast_tailcall(int byte_no) {
+  __ call_Unimplemented();
+}
+
 void TemplateTable::invokeinterface(int byte_no) {
   transition(vtos, vtos);
   assert(byte_no == f1_byte, "use this argument");
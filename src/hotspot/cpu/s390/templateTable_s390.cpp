@@ -3714,6 +3714,12 @@ void TemplateTable::fast_invokevfinal(int byte_no) {
   __ stop("fast_invokevfinal not used on linuxs390x");
 }
 
+void TemplateTable::fast_tailcall(int byte_no) {
+  transition(vtos, vtos);
+  assert(byte_no == f1_byte, "use this argument");
+  __ stop("fast_tailcall not used on linuxs390x");
+}
+
 void TemplateTable::invokeinterface(int byte_no) {
   transition(vtos, vtos);
 
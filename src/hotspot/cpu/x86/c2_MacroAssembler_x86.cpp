@@ -49,7 +49,7 @@
 #endif
 
 // C2 compiled method's prolog code.
-void C2_MacroAssembler::verified_entry(int framesize, int stack_bang_size, bool fp_mode_24b, bool is_stub) {
+void C2_MacroAssembler::verified_entry(int framesize, int stack_bang_size, bool fp_mode_24b, bool is_stub, bool use_watermark) {
   assert(stack_bang_size >= framesize || stack_bang_size <= 0, "stack bang size incorrect");
 
   assert((framesize & (StackAlignmentInBytes-1)) == 0, "frame size not aligned");
@@ -63,7 +63,22 @@ void C2_MacroAssembler::verified_entry(int framesize, int stack_bang_size, bool
   // stack.  But the stack safety zone should account for that.
   // See bugs 4446381, 4468289, 4497237.
   if (stack_bang_size > 0) {
+    Label L_banged;
+    if (use_watermark) {
+      // Same scheme as TemplateInterpreterGenerator::bang_stack_shadow_pages:
+      // above the growth watermark the shadow zone was banged before and the
+      // guard zone is far away.
+      cmpptr(rsp, Address(r15_thread, JavaThread::shadow_zone_growth_watermark()));
+      jcc(Assembler::above, L_banged);
+    }
     generate_stack_overflow_check(stack_bang_size);
+    if (use_watermark) {
+      // Record the new watermark, but only if it is above the safe limit.
+      cmpptr(rsp, Address(r15_thread, JavaThread::shadow_zone_safe_limit()));
+      jccb(Assembler::belowEqual, L_banged);
+      movptr(Address(r15_thread, JavaThread::shadow_zone_growth_watermark()), rsp);
+    }
+    bind(L_banged);
 
     // We always push rbp, so that on return to interpreter rbp, will be
     // restored correctly and we can correct the stack.
@@ -29,7 +29,7 @@
 
 public:
   // C2 compiled method's prolog code.
-  void verified_entry(int framesize, int stack_bang_size, bool fp_mode_24b, bool is_stub);
+  void verified_entry(int framesize, int stack_bang_size, bool fp_mode_24b, bool is_stub, bool use_watermark);
 
   Assembler::AvxVectorLen vector_length_encoding(int vlen_in_bytes);
 
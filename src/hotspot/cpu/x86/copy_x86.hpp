@@ -29,6 +29,15 @@
 
 static void pd_fill_to_words(HeapWord* tohw, size_t count, juint value) {
 #ifdef AMD64
+  if (value == 0) {
+    // Zeroing is by far the most common fill, e.g. clearing large arrays
+    // outside TLABs. The C library memset picks vector stores for small
+    // sizes and non-temporal stores above a threshold it derives from the
+    // cache sizes at startup, so clearing a huge array does not flush
+    // the last level cache.
+    (void)memset(tohw, 0, count * HeapWordSize);
+    return;
+  }
   julong* to = (julong*) tohw;
   julong  v  = ((julong) value << 32) | value;
   while (count-- > 0) {
@@ -52,6 +52,8 @@ const bool CCallingConventionRequiresIntsAsLongs = false;
 #define SUPPORT_RESERVED_STACK_AREA
 #endif
 
+#define SUPPORT_INTERPRETER_TAIL_CALLS
+
 #define USE_POINTERS_TO_REGISTER_IMPL_ARRAY
 
 #endif // CPU_X86_GLOBALDEFINITIONS_X86_HPP
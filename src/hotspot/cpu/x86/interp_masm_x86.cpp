@@ -791,11 +791,16 @@ void InterpreterMacroAssembler::narrow(Register result) {
 //       installs IllegalMonitorStateException
 //    Else
 //       no error processing
+//
+// If !check_monitors the caller guarantees that the method is not
+// synchronized and has no monitor bytecodes (_fast_*return), so the
+// unlock and monitor block scan are omitted.
 void InterpreterMacroAssembler::remove_activation(TosState state,
                                                   Register ret_addr,
                                                   bool throw_monitor_exception,
                                                   bool install_monitor_exception,
-                                                  bool notify_jvmdi) {
+                                                  bool notify_jvmdi,
+                                                  bool check_monitors) {
   // Note: Registers rdx xmm0 may be in use for the
   // result check if synchronized method
   Label unlocked, unlock, no_unlock;
@@ -804,123 +809,125 @@ void InterpreterMacroAssembler::remove_activation(TosState state,
   const Register robj    = c_rarg1;
   const Register rmon    = c_rarg1;
 
-  // get the value of _do_not_unlock_if_synchronized into rdx
-  const Address do_not_unlock_if_synchronized(rthread,
-    in_bytes(JavaThread::do_not_unlock_if_synchronized_offset()));
-  movbool(rbx, do_not_unlock_if_synchronized);
-  movbool(do_not_unlock_if_synchronized, false); // reset the flag
-
- // get method access flags
-  movptr(rcx, Address(rbp, frame::interpreter_frame_method_offset * wordSize));
-  load_unsigned_short(rcx, Address(rcx, Method::access_flags_offset()));
-  testl(rcx, JVM_ACC_SYNCHRONIZED);
-  jcc(Assembler::zero, unlocked);
-
-  // Don't unlock anything if the _do_not_unlock_if_synchronized flag
-  // is set.
-  testbool(rbx);
-  jcc(Assembler::notZero, no_unlock);
-
-  // unlock monitor
-  push(state); // save result
-
-  // BasicObjectLock will be first in list, since this is a
-  // synchronized method. However, need to check that the object has
-  // not been unlocked by an explicit monitorexit bytecode.
-  const Address monitor(rbp, frame::interpreter_frame_initial_sp_offset *
-                        wordSize - (int) sizeof(BasicObjectLock));
-  // We use c_rarg1/rdx so that if we go slow path it will be the correct
-  // register for unlock_object to pass to VM directly
-  lea(robj, monitor); // address of first monitor
-
-  movptr(rax, Address(robj, BasicObjectLock::obj_offset()));
-  testptr(rax, rax);
-  jcc(Assembler::notZero, unlock);
-
-  pop(state);
-  if (throw_monitor_exception) {
-    // Entry already unlocked, need to throw exception
-    call_VM(noreg, CAST_FROM_FN_PTR(address,
-                   InterpreterRuntime::throw_illegal_monitor_state_exception));
-    should_not_reach_here();
-  } else {
-    // Monitor already unlocked during a stack unroll. If requested,
-    // install an illegal_monitor_state_exception.  Continue with
-    // stack unrolling.
-    if (install_monitor_exception) {
-      call_VM(noreg, CAST_FROM_FN_PTR(address,
-                     InterpreterRuntime::new_illegal_monitor_state_exception));
-    }
-    jmp(unlocked);
-  }
-
-  bind(unlock);
-  unlock_object(robj);
-  pop(state);
-
-  // Check that for block-structured locking (i.e., that all locked
-  // objects has been unlocked)
-  bind(unlocked);
-
-  // rax, rdx: Might contain return value
-
-  // Check that all monitors are unlocked
-  {
-    Label loop, exception, entry, restart;
-    const int entry_size = frame::interpreter_frame_monitor_size_in_bytes();
-    const Address monitor_block_top(
-        rbp, frame::interpreter_frame_monitor_block_top_offset * wordSize);
-    const Address monitor_block_bot(
-        rbp, frame::interpreter_frame_initial_sp_offset * wordSize);
-
-    bind(restart);
-    // We use c_rarg1 so that if we go slow path it will be the correct
+  if (check_monitors) {
+    // get the value of _do_not_unlock_if_synchronized into rdx
+    const Address do_not_unlock_if_synchronized(rthread,
+      in_bytes(JavaThread::do_not_unlock_if_synchronized_offset()));
+    movbool(rbx, do_not_unlock_if_synchronized);
+    movbool(do_not_unlock_if_synchronized, false); // reset the flag
+
+   // get method access flags
+    movptr(rcx, Address(rbp, frame::interpreter_frame_method_offset * wordSize));
+    load_unsigned_short(rcx, Address(rcx, Method::access_flags_offset()));
+    testl(rcx, JVM_ACC_SYNCHRONIZED);
+    jcc(Assembler::zero, unlocked);
+
+    // Don't unlock anything if the _do_not_unlock_if_synchronized flag
+    // is set.
+    testbool(rbx);
+    jcc(Assembler::notZero, no_unlock);
+
+    // unlock monitor
+    push(state); // save result
+
+    // BasicObjectLock will be first in list, since this is a
+    // synchronized method. However, need to check that the object has
+    // not been unlocked by an explicit monitorexit bytecode.
+    const Address monitor(rbp, frame::interpreter_frame_initial_sp_offset *
+                          wordSize - (int) sizeof(BasicObjectLock));
+    // We use c_rarg1/rdx so that if we go slow path it will be the correct
     // register for unlock_object to pass to VM directly
-    movptr(rmon, monitor_block_top); // derelativize pointer
-    lea(rmon, Address(rbp, rmon, Address::times_ptr));
-    // c_rarg1 points to current entry, starting with top-most entry
-
-    lea(rbx, monitor_block_bot);  // points to word before bottom of
-                                  // monitor block
-    jmp(entry);
+    lea(robj, monitor); // address of first monitor
 
-    // Entry already locked, need to throw exception
-    bind(exception);
+    movptr(rax, Address(robj, BasicObjectLock::obj_offset()));
+    testptr(rax, rax);
+    jcc(Assembler::notZero, unlock);
 
+    pop(state);
     if (throw_monitor_exception) {
-      // Throw exception
-      MacroAssembler::call_VM(noreg,
-                              CAST_FROM_FN_PTR(address, InterpreterRuntime::
-                                   throw_illegal_monitor_state_exception));
+      // Entry already unlocked, need to throw exception
+      call_VM(noreg, CAST_FROM_FN_PTR(address,
+                     InterpreterRuntime::throw_illegal_monitor_state_exception));
       should_not_reach_here();
     } else {
-      // Stack unrolling. Unlock object and install illegal_monitor_exception.
-      // Unlock does not block, so don't have to worry about the frame.
-      // We don't have to preserve c_rarg1 since we are going to throw an exception.
-
-      push(state);
-      mov(robj, rmon);   // nop if robj and rmon are the same
-      unlock_object(robj);
-      pop(state);
-
+      // Monitor already unlocked during a stack unroll. If requested,
+      // install an illegal_monitor_state_exception.  Continue with
+      // stack unrolling.
       if (install_monitor_exception) {
         call_VM(noreg, CAST_FROM_FN_PTR(address,
-                                        InterpreterRuntime::
-                                        new_illegal_monitor_state_exception));
+                       InterpreterRuntime::new_illegal_monitor_state_exception));
       }
-
-      jmp(restart);
+      jmp(unlocked);
     }
 
-    bind(loop);
-    // check if current entry is used
-    cmpptr(Address(rmon, BasicObjectLock::obj_offset()), NULL_WORD);
-    jcc(Assembler::notEqual, exception);
-
-    addptr(rmon, entry_size); // otherwise advance to next entry
-    bind(entry);
-    cmpptr(rmon, rbx); // check if bottom reached
-    jcc(Assembler::notEqual, loop); // if not at bottom then check this entry
+    bind(unlock);
+    unlock_object(robj);
+    pop(state);
+
+    // Check that for block-structured locking (i.e., that all locked
+    // objects has been unlocked)
+    bind(unlocked);
+
+    // rax, rdx: Might contain return value
+
+    // Check that all monitors are unlocked
+    {
+      Label loop, exception, entry, restart;
+      const int entry_size = frame::interpreter_frame_monitor_size_in_bytes();
+      const Address monitor_block_top(
+          rbp, frame::interpreter_frame_monitor_block_top_offset * wordSize);
+      const Address monitor_block_bot(
+          rbp, frame::interpreter_frame_initial_sp_offset * wordSize);
+
+      bind(restart);
+      // We use c_rarg1 so that if we go slow path it will be the correct
+      // register for unlock_object to pass to VM directly
+      movptr(rmon, monitor_block_top); // derelativize pointer
+      lea(rmon, Address(rbp, rmon, Address::times_ptr));
+      // c_rarg1 points to current entry, starting with top-most entry
+
+      lea(rbx, monitor_block_bot);  // points to word before bottom of
+                                    // monitor block
+      jmp(entry);
+
+      // Entry already locked, need to throw exception
+      bind(exception);
+
+      if (throw_monitor_exception) {
+        // Throw exception
+        MacroAssembler::call_VM(noreg,
+                                CAST_FROM_FN_PTR(address, InterpreterRuntime::
+                                     throw_illegal_monitor_state_exception));
+        should_not_reach_here();
+      } else {
+        // Stack unrolling. Unlock object and install illegal_monitor_exception.
+        // Unlock does not block, so don't have to worry about the frame.
+        // We don't have to preserve c_rarg1 since we are going to throw an exception.
+
+        push(state);
+        mov(robj, rmon);   // nop if robj and rmon are the same
+        unlock_object(robj);
+        pop(state);
+
+        if (install_monitor_exception) {
+          call_VM(noreg, CAST_FROM_FN_PTR(address,
+                                          InterpreterRuntime::
+                                          new_illegal_monitor_state_exception));
+        }
+
+        jmp(restart);
+      }
+
+      bind(loop);
+      // check if current entry is used
+      cmpptr(Address(rmon, BasicObjectLock::obj_offset()), NULL_WORD);
+      jcc(Assembler::notEqual, exception);
+
+      addptr(rmon, entry_size); // otherwise advance to next entry
+      bind(entry);
+      cmpptr(rmon, rbx); // check if bottom reached
+      jcc(Assembler::notEqual, loop); // if not at bottom then check this entry
+    }
   }
 
   bind(no_unlock);
@@ -196,10 +196,12 @@ class InterpreterMacroAssembler: public MacroAssembler {
   // installing an exception, and notifying jvmdi.
   // In earlyReturn case we only want to skip throwing an exception
   // and installing an exception.
+  // The _fast_*return bytecodes skip the monitor checks altogether.
   void remove_activation(TosState state, Register ret_addr,
                          bool throw_monitor_exception = true,
                          bool install_monitor_exception = true,
-                         bool notify_jvmdi = true);
+                         bool notify_jvmdi = true,
+                         bool check_monitors = true);
   void get_method_counters(Register method, Register mcs, Label& skip);
 
   // Object locking
@@ -46,6 +46,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/synchronizer.hpp"
+#include "services/runtimeService.hpp"
 #include "utilities/macros.hpp"
 
 #define __ Disassembler::hook<InterpreterMacroAssembler>(__FILE__, __LINE__, _masm)->
@@ -2151,7 +2152,21 @@ void TemplateTable::_return(TosState state) {
   if (state == itos) {
     __ narrow(rax);
   }
-  __ remove_activation(state, rbcp);
+
+  if (Bytecodes::is_fast_return(_desc->bytecode())) {
+    address counter = RuntimeService::interpreted_fast_returns_addr();
+    if (counter != nullptr) {
+      __ incrementq(ExternalAddress(counter), rscratch1);
+    }
+    // The Rewriter only emits _fast_*return for methods without monitors.
+    __ remove_activation(state, rbcp,
+                         true /* throw_monitor_exception */,
+                         true /* install_monitor_exception */,
+                         true /* notify_jvmdi */,
+                         false /* check_monitors */);
+  } else {
+    __ remove_activation(state, rbcp);
+  }
 
   __ jmp(rbcp);
 }
@@ -3314,6 +3329,100 @@ void TemplateTable::invokestatic(int byte_no) {
   __ jump_from_interpreted(rbx, rax);
 }
 
+// Self-recursive invokestatic in tail position, see Rewriter::rewrite_self_tail_calls.
+// Instead of pushing a new activation, the outgoing arguments overwrite the
+// parameters and the method restarts at bci 0 in the current frame.
+void TemplateTable::fast_tailcall(int byte_no) {
+  transition(vtos, vtos);
+  assert(byte_no == f1_byte, "use this argument");
+
+  Label slow_path;
+
+  if (!OptimizeSelfTailCalls) {
+    // The bytecode may come from an archive dumped with the optimization on.
+    __ movl(rbx, Bytecodes::_invokestatic);
+    __ dispatch_only_normal(vtos);
+    return;
+  }
+
+  // Threads in interp_only_mode must see every method entry and exit.
+  __ cmpl(Address(r15_thread, JavaThread::interp_only_mode_offset()), 0);
+  __ jcc(Assembler::notZero, slow_path);
+
+  // The call is never resolved here, so after RedefineClasses an old method
+  // must make a real call that reaches the current version.
+  __ get_method(rbx);
+  __ testl(Address(rbx, Method::flags_offset()), MethodFlags::is_old_mask());
+  __ jcc(Assembler::notZero, slow_path);
+
+  // Once compiled code exists, make a real call so that the rest of the
+  // recursion runs there; the compilers turn the tail call into a loop too.
+  __ cmpptr(Address(rbx, Method::code_offset()), NULL_WORD);
+  __ jcc(Assembler::notEqual, slow_path);
+
+  // Count the restart as an invocation so that the method gets compiled.
+  Label no_mdo, counted, overflow;
+  if (ProfileInterpreter) {
+    __ movptr(rax, Address(rbx, Method::method_data_offset()));
+    __ testptr(rax, rax);
+    __ jccb(Assembler::zero, no_mdo);
+    const Address mdo_invocation_counter(rax, in_bytes(MethodData::invocation_counter_offset()) +
+                                              in_bytes(InvocationCounter::counter_offset()));
+    const Address mdo_mask(rax, in_bytes(MethodData::invoke_mask_offset()));
+    __ increment_mask_and_jump(mdo_invocation_counter, mdo_mask, rcx, &overflow);
+    __ jmp(counted);
+  }
+  __ bind(no_mdo);
+  const Address invocation_counter(rax, MethodCounters::invocation_counter_offset() +
+                                        InvocationCounter::counter_offset());
+  __ get_method_counters(rbx, rax, counted);
+  const Address mask(rax, in_bytes(MethodCounters::invoke_mask_offset()));
+  __ increment_mask_and_jump(invocation_counter, mask, rcx, &overflow);
+  __ jmp(counted);
+
+  __ bind(overflow);
+  __ movl(c_rarg1, 0);
+  __ call_VM(noreg, CAST_FROM_FN_PTR(address, InterpreterRuntime::frequency_counter_overflow), c_rarg1);
+
+  __ bind(counted);
+
+  // Copy the arguments into locals 0..n-1. The first argument is the deepest
+  // expression stack slot and both areas grow towards lower addresses.
+  Label loop, done;
+  __ get_method(rbx);
+  __ movptr(rdx, Address(rbx, Method::const_offset()));
+  __ load_unsigned_short(rdx, Address(rdx, ConstMethod::size_of_parameters_offset()));
+  __ testl(rdx, rdx);
+  __ jcc(Assembler::zero, done);
+  __ lea(rcx, Address(rsp, rdx, Interpreter::stackElementScale(), -Interpreter::stackElementSize));
+  __ movptr(rbx, rlocals);
+  __ bind(loop);
+  __ movptr(rax, Address(rcx, 0));
+  __ movptr(Address(rbx, 0), rax);
+  __ subptr(rcx, Interpreter::stackElementSize);
+  __ subptr(rbx, Interpreter::stackElementSize);
+  __ decrementl(rdx);
+  __ jcc(Assembler::notZero, loop);
+  __ bind(done);
+
+  // Restart at bci 0 with an empty expression stack, polling like a backward branch.
+  __ empty_expression_stack();
+  __ get_method(rbx);
+  __ movptr(rbcp, Address(rbx, Method::const_offset()));
+  __ lea(rbcp, Address(rbcp, ConstMethod::codes_offset()));
+  if (ProfileInterpreter) {
+    // The profile position must follow bcp back to bci 0.
+    __ set_method_data_pointer_for_bcp();
+  }
+  __ load_unsigned_byte(rbx, Address(rbcp, 0));
+  __ dispatch_only(vtos, true);
+
+  // Execute the bytecode as the plain invokestatic it was rewritten from.
+  __ bind(slow_path);
+  __ movl(rbx, Bytecodes::_invokestatic);
+  __ dispatch_only_normal(vtos);
+}
+
 
 void TemplateTable::fast_invokevfinal(int byte_no) {
   transition(vtos, vtos);
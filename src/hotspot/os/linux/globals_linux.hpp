@@ -64,6 +64,10 @@
   product(bool, DumpPerfMapAtExit, false, DIAGNOSTIC,                   \
           "Write map file for Linux perf tool at exit")                 \
                                                                         \
+  product(bool, WritePerfMapContinuously, false, DIAGNOSTIC,            \
+          "Append an entry to the map file for Linux perf tool "        \
+          "whenever compiled code or a stub is installed")              \
+                                                                        \
   product(intx, TimerSlack, -1, EXPERIMENTAL,                           \
           "Overrides the timer slack value to the given number of "     \
           "nanoseconds. Lower value provides more accurate "            \
@@ -74,6 +78,32 @@
           "to disable both the override and the printouts."             \
           "See prctl(PR_SET_TIMERSLACK) for more info.")                \
                                                                         \
+  product(bool, UseFutexParker, false, EXPERIMENTAL,                    \
+          "Implement LockSupport.park/unpark with a futex instead of "  \
+          "a mutex and condition variables")                            \
+                                                                        \
+  product(uint, ParkSpinLimit, 0, EXPERIMENTAL,                         \
+          "With UseFutexParker, the maximum number of spins for a "     \
+          "permit before a thread blocks in LockSupport.park. The "     \
+          "limit adapts to whether spinning succeeded")                 \
+          range(0, 1000000)                                             \
+                                                                        \
+  product(bool, UseThreadStackPool, false, EXPERIMENTAL,                \
+          "Run Java threads on VM-mapped stacks, and keep the stacks "  \
+          "of exited threads for reuse by new threads of the same "     \
+          "stack size")                                                 \
+                                                                        \
+  product(uint, ThreadStackPoolSize, 64, EXPERIMENTAL,                  \
+          "Maximum number of thread stacks kept for reuse with "        \
+          "UseThreadStackPool")                                         \
+          range(0, 100000)                                              \
+                                                                        \
+  product(bool, THPCollapseOnCommit, false, EXPERIMENTAL,               \
+          "With UseTransparentHugePages in madvise mode, collapse "     \
+          "committed large-page aligned ranges into huge pages right "  \
+          "away (MADV_COLLAPSE) instead of waiting for khugepaged. "    \
+          "This populates the committed memory")                        \
+                                                                        \
   product(bool, THPStackMitigation, true, DIAGNOSTIC,                   \
           "If THPs are unconditionally enabled on the system (mode "    \
           "\"always\"), the JVM will prevent THP from forming in "      \
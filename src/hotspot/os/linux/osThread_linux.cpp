@@ -32,6 +32,8 @@ OSThread::OSThread()
   : _thread_id(0),
     _pthread_id(0),
     _caller_sigmask(),
+    _pooled_stack(nullptr),
+    _pooled_stack_size(0),
     sr(),
     _siginfo(nullptr),
     _ucontext(nullptr),
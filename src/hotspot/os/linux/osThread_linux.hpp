@@ -42,6 +42,10 @@ class OSThread : public OSThreadBase {
 
   sigset_t _caller_sigmask; // Caller's signal mask
 
+  // Stack taken from the thread stack pool, see UseThreadStackPool
+  char*  _pooled_stack;
+  size_t _pooled_stack_size;
+
  public:
   OSThread();
   ~OSThread();
@@ -64,6 +68,17 @@ class OSThread : public OSThreadBase {
     _pthread_id = tid;
   }
 
+  char* pooled_stack() const {
+    return _pooled_stack;
+  }
+  size_t pooled_stack_size() const {
+    return _pooled_stack_size;
+  }
+  void set_pooled_stack(char* base, size_t size) {
+    _pooled_stack = base;
+    _pooled_stack_size = size;
+  }
+
   // ***************************************************************
   // suspension support.
   // ***************************************************************
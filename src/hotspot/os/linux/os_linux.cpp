@@ -974,6 +974,111 @@ static void init_adjust_stacksize_for_guard_pages() {
 }
 #endif // GLIBC
 
+//////////////////////////////////////////////////////////////////////////////
+// thread stack pool
+
+// With UseThreadStackPool, Java threads run on stacks the VM maps itself
+// rather than on stacks glibc allocates. When such a thread exits, its stack
+// is kept for the next Java thread created with the same stack size, so that
+// short-lived threads do not pay for mapping and faulting in a fresh stack.
+// These threads are created joinable: a stack can only be handed out again
+// once the thread that ran on it has terminated, which pthread_tryjoin_np()
+// tells us without blocking.
+class ThreadStackPool : AllStatic {
+  struct Entry : public CHeapObj<mtThread> {
+    char*     _base;
+    size_t    _size;
+    pthread_t _owner;   // Thread that last ran on the stack, 0 once joined
+    Entry*    _next;
+  };
+
+  static pthread_mutex_t _lock;
+  static Entry* _entries;
+  static uint _count;
+
+  static bool try_join(Entry* e) {
+    if (e->_owner != 0 && pthread_tryjoin_np(e->_owner, nullptr) == 0) {
+      e->_owner = 0;
+    }
+    return e->_owner == 0;
+  }
+
+ public:
+  static char* take(size_t size);
+  static void give_back(char* base, size_t size, pthread_t owner);
+};
+
+pthread_mutex_t ThreadStackPool::_lock = PTHREAD_MUTEX_INITIALIZER;
+ThreadStackPool::Entry* ThreadStackPool::_entries = nullptr;
+uint ThreadStackPool::_count = 0;
+
+// Returns a stack of the given size, reusing a pooled one if its thread has
+// terminated, or nullptr if no stack could be mapped.
+char* ThreadStackPool::take(size_t size) {
+  pthread_mutex_lock(&_lock);
+  for (Entry** prev = &_entries; *prev != nullptr; prev = &(*prev)->_next) {
+    Entry* e = *prev;
+    if (e->_size == size && try_join(e)) {
+      *prev = e->_next;
+      _count--;
+      pthread_mutex_unlock(&_lock);
+      char* base = e->_base;
+      delete e;
+      log_trace(os, thread)("Reusing pooled thread stack " PTR_FORMAT " (%zuk)", p2i(base), size / K);
+      return base;
+    }
+  }
+  pthread_mutex_unlock(&_lock);
+
+  void* base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+  if (base == MAP_FAILED) {
+    return nullptr;
+  }
+  if (THPStackMitigation) {
+    // Without a glibc guard page between them, adjacent pooled stacks could
+    // be merged into one VMA and collapsed into huge pages.
+    ::madvise(base, size, MADV_NOHUGEPAGE);
+  }
+  return (char*)base;
+}
+
+// Called by a thread that is about to exit with the stack it runs on, or
+// with owner 0 for a stack no thread was started on. Keeps at most
+// ThreadStackPoolSize stacks, unmapping those of terminated threads beyond
+// that.
+void ThreadStackPool::give_back(char* base, size_t size, pthread_t owner) {
+  Entry* e = new Entry();
+  e->_base = base;
+  e->_size = size;
+  e->_owner = owner;
+
+  Entry* trimmed = nullptr;
+  pthread_mutex_lock(&_lock);
+  e->_next = _entries;
+  _entries = e;
+  _count++;
+  for (Entry** prev = &e->_next; *prev != nullptr && _count > ThreadStackPoolSize; ) {
+    Entry* cur = *prev;
+    if (try_join(cur)) {
+      *prev = cur->_next;
+      _count--;
+      cur->_next = trimmed;
+      trimmed = cur;
+    } else {
+      prev = &cur->_next;
+    }
+  }
+  pthread_mutex_unlock(&_lock);
+
+  while (trimmed != nullptr) {
+    Entry* next = trimmed->_next;
+    ::munmap(trimmed->_base, trimmed->_size);
+    delete trimmed;
+    trimmed = next;
+  }
+}
+
 bool os::create_thread(Thread* thread, ThreadType thr_type,
                        size_t req_stack_size) {
   assert(thread->osthread() == nullptr, "caller responsible");
@@ -1049,6 +1154,16 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
     return false;
   }
 
+  char* pooled_stack = nullptr;
+  if (UseThreadStackPool && thr_type == java_thread) {
+    pooled_stack = ThreadStackPool::take(stack_size);
+    if (pooled_stack != nullptr) {
+      pthread_attr_setstack(&attr, pooled_stack, stack_size);
+      pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+      osthread->set_pooled_stack(pooled_stack, stack_size);
+    }
+  }
+
   ThreadState state;
 
   {
@@ -1103,6 +1218,9 @@ bool os::create_thread(Thread* thread, ThreadType thr_type,
 
     if (ret != 0) {
       // Need to clean up stuff we've allocated so far
+      if (pooled_stack != nullptr) {
+        ThreadStackPool::give_back(pooled_stack, stack_size, 0);
+      }
       thread->set_osthread(nullptr);
       delete osthread;
       return false;
@@ -1227,6 +1345,13 @@ void os::free_thread(OSThread* osthread) {
   sigset_t sigmask = osthread->caller_sigmask();
   pthread_sigmask(SIG_SETMASK, &sigmask, nullptr);
 
+  // The stack is still in use until this thread terminates, the pool
+  // only hands it out again after that.
+  if (osthread->pooled_stack() != nullptr) {
+    ThreadStackPool::give_back(osthread->pooled_stack(), osthread->pooled_stack_size(),
+                               osthread->pthread_id());
+  }
+
   delete osthread;
 }
 
@@ -2866,6 +2991,15 @@ void os::pd_commit_memory_or_exit(char* addr, size_t size, bool exec,
   STATIC_ASSERT(MADV_POPULATE_WRITE == MADV_POPULATE_WRITE_value);
 #endif
 
+// Define MADV_COLLAPSE here so we can build HotSpot on old systems.
+#define MADV_COLLAPSE_value 25
+#ifndef MADV_COLLAPSE
+  #define MADV_COLLAPSE MADV_COLLAPSE_value
+#else
+  // Sanity-check our assumed default value if we build with a new enough libc.
+  STATIC_ASSERT(MADV_COLLAPSE == MADV_COLLAPSE_value);
+#endif
+
 // Note that the value for MAP_FIXED_NOREPLACE differs between architectures, but all architectures
 // supported by OpenJDK share the same flag value.
 #define MAP_FIXED_NOREPLACE_value 0x100000
@@ -2908,9 +3042,46 @@ void os::Linux::madvise_transparent_huge_pages(void* addr, size_t bytes) {
   ::madvise(addr, bytes, MADV_HUGEPAGE);
 }
 
+void os::Linux::collapse_transparent_huge_pages(void* addr, size_t bytes) {
+  // MADV_COLLAPSE (Linux 6.1) backs the range with huge pages right away
+  // instead of leaving it to khugepaged. Pages not yet faulted in are
+  // zero-filled, so this also populates the range. Failure is harmless:
+  // the range stays madvised and khugepaged may still collapse it later.
+  static volatile bool _unsupported = false;
+  if (_unsupported) {
+    return;
+  }
+  if (::madvise(addr, bytes, MADV_COLLAPSE) == -1) {
+    const int err = errno;
+    if (err == EINVAL) {
+      _unsupported = true;
+      log_info(pagesize)("MADV_COLLAPSE not supported by the kernel, disabling THPCollapseOnCommit");
+    } else {
+      log_debug(pagesize)("MADV_COLLAPSE failed for " RANGEFMT ": %s",
+                          RANGEFMTARGS((char*)addr, bytes), os::strerror(err));
+    }
+  }
+}
+
+// Define MADV_FREE here so we can build HotSpot on old systems.
+#ifndef MADV_FREE
+  #define MADV_FREE 8
+#endif
+
+void os::Linux::madvise_free(void* addr, size_t bytes) {
+  // MADV_FREE is not supported before Linux 4.5; release the memory right
+  // away there, which still keeps it mapped.
+  if (::madvise(addr, bytes, MADV_FREE) == -1) {
+    ::madvise(addr, bytes, MADV_DONTNEED);
+  }
+}
+
 void os::pd_realign_memory(char *addr, size_t bytes, size_t alignment_hint) {
   if (Linux::should_madvise_anonymous_thps() && alignment_hint > vm_page_size()) {
     Linux::madvise_transparent_huge_pages(addr, bytes);
+    if (THPCollapseOnCommit) {
+      Linux::collapse_transparent_huge_pages(addr, bytes);
+    }
   }
 }
 
@@ -191,6 +191,11 @@ class os::Linux {
   static bool should_madvise_shmem_thps();
 
   static void madvise_transparent_huge_pages(void* addr, size_t bytes);
+  static void collapse_transparent_huge_pages(void* addr, size_t bytes);
+
+  // Lets the kernel reclaim the given memory when it needs to, while
+  // keeping it mapped. Memory not yet reclaimed keeps its contents.
+  static void madvise_free(void* addr, size_t bytes);
 
   // Stack repair handling
 
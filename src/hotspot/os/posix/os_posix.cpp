@@ -63,6 +63,8 @@
 #endif
 #ifdef LINUX
 #include "os_linux.hpp"
+#include <linux/futex.h>
+#include <sys/syscall.h>
 #endif
 
 #include <dirent.h>
@@ -1813,7 +1815,7 @@ void PlatformEvent::unpark() {
 
 // JSR166 support
 
- PlatformParker::PlatformParker() : _counter(0), _cur_index(-1) {
+ PlatformParker::PlatformParker() : _counter(0), _cur_index(-1) LINUX_ONLY(COMMA _spin_limit((int)ParkSpinLimit)) {
   int status = pthread_cond_init(&_cond[REL_INDEX], _condAttr);
   assert_status(status == 0, status, "cond_init rel");
   status = pthread_cond_init(&_cond[ABS_INDEX], nullptr);
@@ -1831,6 +1833,67 @@ PlatformParker::~PlatformParker() {
   assert_status(status == 0, status, "mutex_destroy");
 }
 
+#ifdef LINUX
+// Futex-based parking, used with UseFutexParker. Only the owning thread
+// parks, so _counter is all the state needed: 1 when a permit is
+// available, 0 when not, and -1 while the owner is blocked or about to
+// block in the kernel. park() and unpark() then only take a lock-free
+// atomic each, and unpark() enters the kernel only when it replaces a -1.
+
+static long futex_wait(volatile int* addr, int val, const struct timespec* abstime, bool realtime) {
+  // FUTEX_WAIT_BITSET takes an absolute timeout, on CLOCK_MONOTONIC unless
+  // FUTEX_CLOCK_REALTIME is given, which matches what to_abstime() computes.
+  int op = FUTEX_WAIT_BITSET_PRIVATE | (realtime ? FUTEX_CLOCK_REALTIME : 0);
+  return syscall(SYS_futex, addr, op, val, abstime, nullptr, FUTEX_BITSET_MATCH_ANY);
+}
+
+static long futex_wake(volatile int* addr) {
+  return syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, 1, nullptr, nullptr, 0);
+}
+
+// Spin briefly in case an unpark is imminent, as in a producer/consumer
+// handoff. The budget adapts: it is restored to ParkSpinLimit whenever
+// spinning got the permit, and halved, down to ParkSpinLimit / 16,
+// whenever it did not. The thread is already _thread_blocked while
+// spinning, so safepoints do not wait for the spin to end.
+bool PlatformParker::spin_for_permit() {
+  const int limit = _spin_limit;
+  for (int i = 0; i < limit; i++) {
+    if (Atomic::load(&_counter) > 0 && Atomic::xchg(&_counter, 0) > 0) {
+      _spin_limit = (int)ParkSpinLimit;
+      return true;
+    }
+    SpinPause();
+  }
+  _spin_limit = MAX2(limit / 2, (int)(ParkSpinLimit / 16));
+  return false;
+}
+
+void PlatformParker::park_futex(const struct timespec* abstime, bool realtime) {
+  // Announce that we are going to block. This only fails if a permit
+  // arrived since the fast path check, which we then consume instead.
+  if (Atomic::cmpxchg(&_counter, 0, -1) != 0) {
+    Atomic::xchg(&_counter, 0);
+    return;
+  }
+  long ret = futex_wait(&_counter, -1, abstime, realtime);
+  assert(ret == 0 || errno == EAGAIN || errno == EINTR || errno == ETIMEDOUT,
+         "futex_wait failed: %s", os::strerror(errno));
+  // Woken, timed out or returned spuriously: consume any permit and leave
+  // the parked state in one step.
+  Atomic::xchg(&_counter, 0);
+}
+
+void PlatformParker::unpark_futex() {
+  if (Atomic::xchg(&_counter, 1) < 0) {
+    // The owner is blocked, or is about to block and will not once it
+    // sees the permit.
+    long ret = futex_wake(&_counter);
+    assert(ret >= 0, "futex_wake failed: %s", os::strerror(errno));
+  }
+}
+#endif // LINUX
+
 // Parker::park decrements count if > 0, else does a condvar wait.  Unpark
 // sets count to 1 and signals condvar.  Only one thread ever waits
 // on the condvar. Contention seen when trying to park implies that someone
@@ -1862,6 +1925,20 @@ void Parker::park(bool isAbsolute, jlong time) {
     to_abstime(&absTime, time, isAbsolute, false);
   }
 
+#ifdef LINUX
+  if (UseFutexParker) {
+    // Spin only once blocked, so that a spinning thread never holds up a
+    // safepoint.
+    ThreadBlockInVM tbivm(jt);
+    if (spin_for_permit()) {
+      return;
+    }
+    OSThreadWaitState osts(jt->osthread(), false /* not Object.wait() */);
+    park_futex(time > 0 ? &absTime : nullptr, isAbsolute || !_use_clock_monotonic_condattr);
+    return;
+  }
+#endif
+
   // Enter safepoint region
   // Beware of deadlocks such as 6317397.
   // The per-thread Parker:: mutex is a classic leaf-lock.
@@ -1916,6 +1993,12 @@ void Parker::park(bool isAbsolute, jlong time) {
 }
 
 void Parker::unpark() {
+#ifdef LINUX
+  if (UseFutexParker) {
+    unpark_futex();
+    return;
+  }
+#endif
   int status = pthread_mutex_lock(_mutex);
   assert_status(status == 0, status, "invariant");
   const int s = _counter;
@@ -86,6 +86,17 @@ class PlatformParker {
   pthread_mutex_t _mutex[1];
   pthread_cond_t  _cond[2]; // one for relative times and one for absolute
 
+#ifdef LINUX
+  // With UseFutexParker, _counter is used as a futex word instead of the
+  // mutex and condvars, and park() spins for up to _spin_limit iterations
+  // before blocking.
+  int _spin_limit;
+
+  bool spin_for_permit();
+  void park_futex(const struct timespec* abstime, bool realtime);
+  void unpark_futex();
+#endif
+
  public:
   PlatformParker();
   ~PlatformParker();
@@ -334,6 +334,18 @@ void BlockListBuilder::set_leaders() {
         current = nullptr;
         break;
 
+      case Bytecodes::_invokestatic:
+        // A self tail call stores the outgoing arguments into the
+        // parameters and jumps back to the method entry.
+        if (method()->is_self_tail_call_site(cur_bci)) {
+          for (int i = 0; i < method()->arg_size(); i++) {
+            store_one(current, i);
+          }
+          make_block_at(0, current);
+          current = nullptr;
+        }
+        break;
+
       case Bytecodes::_goto_w:
         make_block_at(s.get_far_dest(), current);
         current = nullptr;
@@ -1287,6 +1299,38 @@ void GraphBuilder::_goto(int from_bci, int to_bci) {
 }
 
 
+// The call site was vetted by ciMethod::is_self_tail_call_site: instead of
+// calling, the outgoing arguments become the parameters of the next
+// iteration and control goes back to the method entry.
+void GraphBuilder::self_tail_call() {
+  assert(method()->is_static(), "no receiver");
+  const int arg_size = method()->arg_size();
+  const int base = state()->stack_size() - arg_size;
+  assert(base >= 0, "arguments must be on the stack");
+  for (int i = base; i < state()->stack_size(); ) {
+    int index = i - base;
+    Value arg = state()->stack_at_inc(i);
+    store_local(state(), arg, index);
+  }
+  for (int i = arg_size; i < state()->locals_size(); i++) {
+    if (state()->local_at(i) != nullptr) {
+      state()->invalidate_local(i);
+    }
+  }
+  state()->truncate_stack(0);
+
+  // A deoptimization at the back edge reexecutes the method from bci 0.
+  ValueStack* state_before = state()->copy(ValueStack::StateBefore, 0);
+  state_before->set_force_reexecute();
+  Goto* x = new Goto(block_at(0), state_before, true);
+  if (is_profiling()) {
+    compilation()->set_would_profile(true);
+    x->set_profiled_bci(bci());
+  }
+  append_with_bci(x, 0);
+}
+
+
 void GraphBuilder::if_node(Value x, If::Condition cond, Value y, ValueStack* state_before) {
   BlockBegin* tsux = block_at(stream()->get_dest());
   BlockBegin* fsux = block_at(stream()->next_bci());
@@ -2929,9 +2973,15 @@ BlockEnd* GraphBuilder::iterate_bytecodes_for_block(int bci) {
       case Bytecodes::_putstatic      : // fall through
       case Bytecodes::_getfield       : // fall through
       case Bytecodes::_putfield       : access_field(code); break;
+      case Bytecodes::_invokestatic   :
+        if (method()->is_self_tail_call_site(s.cur_bci())) {
+          self_tail_call();
+          break;
+        }
+        invoke(code);
+        break;
       case Bytecodes::_invokevirtual  : // fall through
       case Bytecodes::_invokespecial  : // fall through
-      case Bytecodes::_invokestatic   : // fall through
       case Bytecodes::_invokedynamic  : // fall through
       case Bytecodes::_invokeinterface: invoke(code); break;
       case Bytecodes::_new            : new_instance(s.get_index_u2()); break;
@@ -257,6 +257,7 @@ class GraphBuilder {
   void call_register_finalizer();
   void access_field(Bytecodes::Code code);
   void invoke(Bytecodes::Code code);
+  void self_tail_call();
   void new_instance(int klass_index);
   void new_type_array();
   void new_object_array();
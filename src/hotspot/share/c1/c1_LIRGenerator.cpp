@@ -42,6 +42,7 @@
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/vm_version.hpp"
+#include "services/runtimeService.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/powerOfTwo.hpp"
@@ -1169,6 +1170,19 @@ void LIRGenerator::do_Return(Return* x) {
     call_runtime(&signature, args, CAST_FROM_FN_PTR(address, SharedRuntime::dtrace_method_exit), voidType, nullptr);
   }
 
+  if (method()->has_fastreturn()) {
+    address counter = RuntimeService::c1_fast_returns_addr();
+    if (counter != nullptr) {
+      LIR_Opr pointer = new_pointer_register();
+      __ move(LIR_OprFact::intptrConst(counter), pointer);
+      LIR_Address* addr = new LIR_Address(pointer, T_LONG);
+      LIR_Opr count = new_register(T_LONG);
+      __ load(addr, count);
+      __ add(count, LIR_OprFact::longConst(1), count);
+      __ store(count, addr);
+    }
+  }
+
   if (x->type()->is_void()) {
     __ return_op(LIR_OprFact::illegalOpr);
   } else {
@@ -2348,6 +2362,11 @@ void LIRGenerator::do_Goto(Goto* x) {
     CodeEmitInfo* info = state_for(x, state);
     increment_backedge_counter(info, x->profiled_bci());
     CodeEmitInfo* safepoint_info = state_for(x, state);
+    if (state->force_reexecute()) {
+      // self tail call: the state describes a fresh activation at bci 0
+      info->set_force_reexecute();
+      safepoint_info->set_force_reexecute();
+    }
     __ safepoint(safepoint_poll_register(), safepoint_info);
   }
 
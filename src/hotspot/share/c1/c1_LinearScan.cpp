@@ -85,6 +85,7 @@ LinearScan::LinearScan(IR* ir, LIRGenerator* gen, FrameMap* frame_map)
  , _new_intervals_from_allocation(nullptr)
  , _sorted_intervals(nullptr)
  , _needs_full_resort(false)
+ , _fast_mode(C1FastLinearScanThreshold > 0 && ir->method()->code_size() > C1FastLinearScanThreshold)
  , _lir_ops(0)     // initialized later with correct length
  , _block_of_op(0) // initialized later with correct length
  , _has_info(0)
@@ -5094,6 +5095,12 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
       TRACE_LINEAR_SCAN(4, tty->print_cr("      interval has hole just before max_split_pos, so splitting at max_split_pos"));
       optimal_split_pos = max_split_pos;
 
+    } else if (allocator()->fast_mode()) {
+      // huge method: do not search the blocks between min_block and max_block, just
+      // split at the beginning of max_block so that the split moves end up at a block boundary
+      TRACE_LINEAR_SCAN(4, tty->print_cr("      fast mode: splitting at beginning of block B%d", max_block->block_id()));
+      optimal_split_pos = max_block->first_lir_instruction_id();
+
     } else {
       // search optimal block boundary between min_split_pos and max_split_pos
       TRACE_LINEAR_SCAN(4, tty->print_cr("      moving split pos to optimal block boundary between block B%d and B%d", min_block->block_id(), max_block->block_id()));
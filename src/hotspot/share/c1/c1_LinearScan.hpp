@@ -138,6 +138,7 @@ class LinearScan : public CompilationResourceObj {
   IntervalList*             _new_intervals_from_allocation; // list with all intervals created during allocation when an existing interval is split
   IntervalArray*            _sorted_intervals;  // intervals sorted by Interval::from()
   bool                      _needs_full_resort; // set to true if an Interval::from() is changed and _sorted_intervals must be resorted
+  bool                      _fast_mode;         // true if intervals are split at the nearest block boundary instead of the optimal one (huge methods)
 
   LIR_OpArray               _lir_ops;           // mapping from LIR_Op id to LIR_Op node
   BlockBeginArray           _block_of_op;       // mapping from LIR_Op id to the BlockBegin containing this instruction
@@ -377,6 +378,7 @@ class LinearScan : public CompilationResourceObj {
   // accessors used by Compilation
   int         max_spills()  const { return _max_spills; }
   int         num_calls() const   { assert(_num_calls >= 0, "not set"); return _num_calls; }
+  bool        fast_mode() const   { return _fast_mode; }
 
 #ifndef PRODUCT
   // entry functions for printing
@@ -497,6 +497,11 @@ static nmethod* counter_overflow_helper(JavaThread* current, int branch_bci, Met
       case Bytecodes::_goto_w:
         offset = Bytes::get_Java_u4(pc + 1);
         break;
+      case Bytecodes::_invokestatic:
+      case Bytecodes::_fast_tailcall:
+        // self tail call, the loop restarts at the method entry
+        offset = -branch_bci;
+        break;
       default: ;
     }
     bci = branch_bci + offset;
@@ -215,6 +215,12 @@
   develop(bool, CountLinearScan, false,                                     \
           "collect statistic counters during LinearScan")                   \
                                                                             \
+  product(intx, C1FastLinearScanThreshold, 0, DIAGNOSTIC,                   \
+          "Methods with more bytecodes than this use a fast mode of the"    \
+          " linear scan allocator that splits intervals at the nearest"     \
+          " block boundary. 0 disables the fast mode")                      \
+          range(0, max_jint)                                                \
+                                                                            \
   /* C1 variable */                                                         \
                                                                             \
   develop(bool, C1Breakpoint, false,                                        \
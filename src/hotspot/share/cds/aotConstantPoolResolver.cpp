@@ -422,6 +422,50 @@ bool AOTConstantPoolResolver::check_lambda_metafactory_methodhandle_arg(Constant
   return check_methodtype_signature(cp, sig);
 }
 
+// The static arguments of ObjectMethods::bootstrap() must be the record class itself, the
+// component names, and one REF_getField MethodHandle for each record component.
+bool AOTConstantPoolResolver::check_object_methods_args(ConstantPool* cp, int bsms_attribute_index) {
+  InstanceKlass* pool_holder = cp->pool_holder();
+  BSMAttributeEntry* bsme = cp->bsm_attribute_entry(bsms_attribute_index);
+  int arg_count = bsme->argument_count();
+  if (arg_count < 2) {
+    // Malformed class?
+    return false;
+  }
+
+  int class_index = bsme->argument_index(0);
+  if (!cp->tag_at(class_index).is_klass_reference() || cp->klass_name_at(class_index) != pool_holder->name()) {
+    return false;
+  }
+  if (!cp->tag_at(bsme->argument_index(1)).is_string()) {
+    return false;
+  }
+
+  for (int arg_i = 2; arg_i < arg_count; arg_i++) {
+    int mh_index = bsme->argument_index(arg_i);
+    if (!cp->tag_at(mh_index).is_method_handle() ||
+        cp->method_handle_ref_kind_at(mh_index) != JVM_REF_getField ||
+        cp->klass_name_at(cp->method_handle_klass_index_at(mh_index)) != pool_holder->name()) {
+      return false;
+    }
+
+    Symbol* field_sig = cp->method_handle_signature_ref_at(mh_index);
+    if (log_is_enabled(Debug, aot, resolve)) {
+      ResourceMark rm;
+      log_debug(aot, resolve)("Checking getter for ObjectMethods BSM arg %d: %s", arg_i, field_sig->as_C_string());
+    }
+    ResourceMark rm;
+    SignatureStream ss(field_sig, false);
+    if (ss.is_reference()) {
+      Klass* k = find_loaded_class(Thread::current(), pool_holder->class_loader(), ss.as_symbol());
+      if (k == nullptr || SystemDictionaryShared::should_be_excluded(k)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp, int cp_index) {
   assert(cp->tag_at(cp_index).is_invoke_dynamic(), "sanity");
   if (!CDSConfig::is_dumping_invokedynamic()) {
@@ -439,7 +483,8 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
   Symbol* bsm_signature = cp->uncached_signature_ref_at(bsm_ref);
   Symbol* bsm_klass = cp->klass_name_at(cp->uncached_klass_ref_index_at(bsm_ref));
 
-  // We currently support only StringConcatFactory::makeConcatWithConstants() and LambdaMetafactory::metafactory()
+  // We currently support only StringConcatFactory::makeConcatWithConstants(), LambdaMetafactory::metafactory()
+  // and ObjectMethods::bootstrap()
   // We should mark the allowed BSMs in the JDK code using a private annotation.
   // See notes on RFE JDK-8342481.
 
@@ -538,6 +583,32 @@ bool AOTConstantPoolResolver::is_indy_resolution_deterministic(ConstantPool* cp,
     return true;
   }
 
+  if (bsm_klass->equals("java/lang/runtime/ObjectMethods") &&
+      bsm_name->equals("bootstrap") &&
+      bsm_signature->equals("(Ljava/lang/invoke/MethodHandles$Lookup;"
+                             "Ljava/lang/String;"
+                             "Ljava/lang/invoke/TypeDescriptor;"
+                             "Ljava/lang/Class;"
+                             "Ljava/lang/String;"
+                             "[Ljava/lang/invoke/MethodHandle;"
+                            ")Ljava/lang/Object;")) {
+    // Used by javac for the toString(), hashCode() and equals() methods of records. The
+    // call site type has the record as its first parameter, so all of its types are
+    // loaded by the time the record's methods have been linked.
+    Symbol* factory_type_sig = cp->uncached_signature_ref_at(cp_index);
+    if (log_is_enabled(Debug, aot, resolve)) {
+      ResourceMark rm;
+      log_debug(aot, resolve)("Checking ObjectMethods callsite signature [%d]: %s", cp_index, factory_type_sig->as_C_string());
+    }
+
+    if (!check_methodtype_signature(cp, factory_type_sig)) {
+      return false;
+    }
+
+    int bsms_attribute_index = cp->bootstrap_methods_attribute_index(cp_index);
+    return check_object_methods_args(cp, bsms_attribute_index);
+  }
+
   return false;
 }
 #ifdef ASSERT
@@ -60,6 +60,7 @@
 #include "oops/oopHandle.inline.hpp"
 #include "oops/trainingData.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
@@ -1137,8 +1138,48 @@ class RelocateBufferToRequested : public BitMapClosure {
     return true; // keep iterating
   }
 
+  // Relocates a slice of the ptrmap with a private copy of the closure. Slices are
+  // split at word boundaries, so the clear_bit() calls made by different workers
+  // never modify the same bitmap word.
+  class Task : public ArchiveWorkerTask {
+    RelocateBufferToRequested* const _patcher;
+
+  public:
+    Task(RelocateBufferToRequested* patcher) :
+      ArchiveWorkerTask("Relocate Buffer To Requested"), _patcher(patcher) {}
+
+    void work(int chunk, int max_chunks) override {
+      BitMap* ptrmap = ArchivePtrMarker::ptrmap();
+      BitMap::idx_t size  = ptrmap->size();
+      BitMap::idx_t words = ptrmap->size_in_words();
+      BitMap::idx_t start = MIN2(size, words * chunk / max_chunks * BitsPerWord);
+      BitMap::idx_t end   = MIN2(size, words * (chunk + 1) / max_chunks * BitsPerWord);
+      if (start >= end) {
+        return;
+      }
+      RelocateBufferToRequested local(*_patcher);
+      local._max_non_null_offset = 0;
+      ptrmap->iterate(&local, start, end);
+
+      size_t cur = Atomic::load(&_patcher->_max_non_null_offset);
+      while (local._max_non_null_offset > cur) {
+        size_t prev = Atomic::cmpxchg(&_patcher->_max_non_null_offset, cur, local._max_non_null_offset);
+        if (prev == cur) {
+          break;
+        }
+        cur = prev;
+      }
+    }
+  };
+
   void doit() {
-    ArchivePtrMarker::ptrmap()->iterate(this);
+    if (AOTCacheParallelRelocation) {
+      ArchiveWorkers workers;
+      Task task(this);
+      workers.run_task(&task);
+    } else {
+      ArchivePtrMarker::ptrmap()->iterate(this);
+    }
     ArchivePtrMarker::compact(_max_non_null_offset);
   }
 };
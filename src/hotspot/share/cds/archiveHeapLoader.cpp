@@ -258,6 +258,52 @@ class ArchiveHeapLoader::PatchLoadedRegionPointers: public BitMapClosure {
   }
 };
 
+// Same as PatchLoadedRegionPointers, for when the dump time and run time
+// narrowOops differ by a constant: add it without decoding and encoding.
+class ArchiveHeapLoader::PatchLoadedRegionPointersQuick: public BitMapClosure {
+  narrowOop* _start;
+  uint32_t _delta;
+  DEBUG_ONLY(intx _offset;)
+
+ public:
+  PatchLoadedRegionPointersQuick(narrowOop* start, uint32_t delta, LoadedArchiveHeapRegion* loaded_region)
+    : _start(start),
+      _delta(delta)
+      DEBUG_ONLY(COMMA _offset(loaded_region->_runtime_offset)) {}
+
+  bool do_bit(size_t offset) {
+    narrowOop* p = _start + offset;
+    narrowOop v = *p;
+    assert(!CompressedOops::is_null(v), "null oops should have been filtered out at dump time");
+    narrowOop new_v = CompressedOops::narrow_oop_cast(CompressedOops::narrow_oop_value(v) + _delta);
+    assert(!CompressedOops::is_null(new_v), "should never relocate to narrowOop(0)");
+#ifdef ASSERT
+    uintptr_t o1 = cast_from_oop<uintptr_t>(ArchiveHeapLoader::decode_from_archive(v)) + _offset;
+    uintptr_t o2 = cast_from_oop<uintptr_t>(CompressedOops::decode_not_null(new_v));
+    assert(o1 == o2, "quick delta must work");
+    ArchiveHeapLoader::assert_in_loaded_heap(o2);
+#endif
+    RawAccess<IS_NOT_NULL>::oop_store(p, new_v);
+    return true;
+  }
+};
+
+// Returns true and sets quick_delta if every dump time narrowOop in the loaded
+// region can be turned into its run time value by adding quick_delta.
+static bool loaded_region_quick_delta(address dumptime_base, int dumptime_shift,
+                                      intx runtime_offset, uint32_t& quick_delta) {
+  if (dumptime_shift != CompressedOops::shift()) {
+    return false;
+  }
+  // runtime narrowOop = (dumptime_base + (v << shift) + runtime_offset - runtime_base) >> shift
+  intptr_t delta_bytes = (intptr_t)dumptime_base + runtime_offset - (intptr_t)CompressedOops::base();
+  if (!is_aligned(delta_bytes, (intptr_t)1 << dumptime_shift)) {
+    return false;
+  }
+  quick_delta = (uint32_t)(delta_bytes >> dumptime_shift);
+  return true;
+}
+
 bool ArchiveHeapLoader::init_loaded_region(FileMapInfo* mapinfo, LoadedArchiveHeapRegion* loaded_region,
                                            MemRegion& archive_space) {
   size_t total_bytes = 0;
@@ -315,8 +361,16 @@ bool ArchiveHeapLoader::load_heap_region_impl(FileMapInfo* mapinfo, LoadedArchiv
   BitMapView bm((BitMap::bm_word_t*)oopmap, r->oopmap_size_in_bits());
 
   if (UseCompressedOops) {
-    PatchLoadedRegionPointers patcher((narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region);
-    bm.iterate(&patcher);
+    narrowOop* patching_start = (narrowOop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos();
+    uint32_t quick_delta;
+    if (loaded_region_quick_delta(_narrow_oop_base, _narrow_oop_shift, loaded_region->_runtime_offset, quick_delta)) {
+      log_info(aot)("loaded heap relocation quick delta = 0x%x", quick_delta);
+      PatchLoadedRegionPointersQuick patcher(patching_start, quick_delta, loaded_region);
+      bm.iterate(&patcher);
+    } else {
+      PatchLoadedRegionPointers patcher(patching_start, loaded_region);
+      bm.iterate(&patcher);
+    }
   } else {
     PatchUncompressedEmbeddedPointers patcher((oop*)load_address + FileMapInfo::current_info()->heap_oopmap_start_pos(), loaded_region->_runtime_offset);
     bm.iterate(&patcher);
@@ -131,7 +131,7 @@
           "loaders before application main")                                \
                                                                             \
   product(bool, AOTCacheParallelRelocation, true, DIAGNOSTIC,               \
-          "Use parallel relocation code to speed up startup.")              \
+          "Use parallel relocation code to speed up startup and dumping.")  \
                                                                             \
   /* flags to control training and deployment modes  */                     \
                                                                             \
@@ -347,6 +347,25 @@ void BCEscapeAnalyzer::invoke(StateInfo &state, Bytecodes::Code code, ciMethod*
       }
       _dependencies.appendAll(analyzer.dependencies());
     }
+  } else if (inline_target == method() && inline_target == target &&
+             (code == Bytecodes::_invokestatic ||
+              code == Bytecodes::_invokespecial ||
+              (code == Bytecodes::_invokevirtual && target->is_final_method()))) {
+    // Statically bound self-recursive call. A CHA-bound virtual call would
+    // need a dependency that this state, saved in MethodData, cannot carry,
+    // so it takes the conservative path below. What happens to the actual
+    // arguments depends on this method's own escape state, which is only
+    // known once the whole method has been analyzed. Treat them as
+    // method-escaping for now and revisit in resolve_recursive_args().
+    TRACE_BCEA(3, tty->print_cr("[EA] recursive call to %s::%s", holder->name()->as_utf8(), target->name()->as_utf8()));
+    for (i = arg_size - 1; i >= 0; i--) {
+      ArgumentMap arg = state.raw_pop();
+      if (!(is_argument(arg) || arg.contains_allocated())) {
+        continue;
+      }
+      set_method_escape(arg);
+      _recursive_args.append(RecursiveArg(i, arg.get_bits()));
+    }
   } else {
     TRACE_BCEA(1, tty->print_cr("[EA] virtual method %s is not monomorphic.",
                                 target->name()->as_utf8()));
@@ -1200,6 +1219,35 @@ void BCEscapeAnalyzer::do_analysis() {
   _methodBlocks = _method->get_method_blocks();
 
   iterate_blocks(arena);
+  resolve_recursive_args();
+}
+
+// Apply the escape state this method ended up with to the arguments of its
+// self-recursive calls, as invoke() does with the state of an analyzed
+// callee. An argument escaping globally there may make another formal
+// escape, so repeat until nothing changes.
+void BCEscapeAnalyzer::resolve_recursive_args() {
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int k = 0; k < _recursive_args.length(); k++) {
+      const RecursiveArg& rarg = _recursive_args.at(k);
+      ArgumentMap arg;
+      arg.set_bits(rarg._actual);
+      for (int j = 0; j < _arg_size; j++) {
+        if (arg.contains(j) && (_arg_modified[j] | _arg_modified[rarg._formal]) != _arg_modified[j]) {
+          _arg_modified[j] |= _arg_modified[rarg._formal];
+          changed = true;
+        }
+      }
+      if (!_arg_stack.test(rarg._formal) || _arg_returned.test(rarg._formal)) {
+        bool was_arg_stack = is_arg_stack(arg);
+        bool was_allocated_escapes = _allocated_escapes;
+        set_global_escape(arg);
+        changed = changed || was_arg_stack || (arg.contains_allocated() && !was_allocated_escapes);
+      }
+    }
+  }
 }
 
 vmIntrinsicID BCEscapeAnalyzer::known_intrinsic() {
@@ -1450,6 +1498,7 @@ BCEscapeAnalyzer::BCEscapeAnalyzer(ciMethod* method, BCEscapeAnalyzer* parent)
     , _allocated_escapes(false)
     , _unknown_modified(false)
     , _dependencies(_arena, 4, 0, nullptr)
+    , _recursive_args(_arena, 0, 0, RecursiveArg())
     , _parent(parent)
     , _level(parent == nullptr ? 0 : parent->level() + 1) {
   if (!_conservative) {
@@ -64,6 +64,17 @@ class BCEscapeAnalyzer : public ArenaObj {
 
   GrowableArray<ciMetadata*> _dependencies;
 
+  // An argument passed to a direct, statically bound self-recursive call:
+  // the callee formal and the bits of the ArgumentMap for the actual.
+  class RecursiveArg {
+   public:
+    int  _formal;
+    uint _actual;
+    RecursiveArg() : _formal(-1), _actual(0) {}
+    RecursiveArg(int formal, uint actual) : _formal(formal), _actual(actual) {}
+  };
+  GrowableArray<RecursiveArg> _recursive_args;
+
   ciMethodBlocks   *_methodBlocks;
 
   BCEscapeAnalyzer* _parent;
@@ -86,6 +97,7 @@ class BCEscapeAnalyzer : public ArenaObj {
   void set_modified(ArgumentMap vars, int offs, int size);
 
   bool is_recursive_call(ciMethod* callee);
+  void resolve_recursive_args();
   void invoke(StateInfo &state, Bytecodes::Code code, ciMethod* target, ciKlass* holder);
 
   void iterate_one_block(ciBlock *blk, StateInfo &state, GrowableArray<ciBlock *> &successors);
@@ -39,13 +39,15 @@ class ciCallProfile : StackObj {
   friend class ciMethodHandle;
 
   enum { MorphismLimit = 2 }; // Max call site's morphism we care about
+  int  _receiver_limit;       // max number of receivers to keep
   int  _limit;                // number of receivers have been determined
   int  _morphism;             // determined call site's morphism
   int  _count;                // # times has this call been executed
-  int  _receiver_count[MorphismLimit + 1]; // # times receivers have been seen
-  ciKlass*  _receiver[MorphismLimit + 1];  // receivers (exact)
+  int  _receiver_count[ReceiverLimit + 1]; // # times receivers have been seen
+  ciKlass*  _receiver[ReceiverLimit + 1];  // receivers (exact)
 
   ciCallProfile() {
+    _receiver_limit = MorphismLimit;
     _limit = 0;
     _morphism    = 0;
     _count = -1;
@@ -56,21 +58,23 @@ class ciCallProfile : StackObj {
   void add_receiver(ciKlass* receiver, int receiver_count);
 
 public:
+  enum { ReceiverLimit = 4 }; // Max receivers kept, for megamorphic inlining
+
   // Note:  The following predicates return false for invalid profiles:
   bool      has_receiver(int i) const { return _limit > i; }
   int       morphism() const          { return _morphism; }
 
   int       count() const             { return _count; }
   int       receiver_count(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return _receiver_count[i];
   }
   float     receiver_prob(int i)  {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return (float)_receiver_count[i]/(float)_count;
   }
   ciKlass*  receiver(int i)        {
-    assert(i < _limit, "out of Call Profile MorphismLimit");
+    assert(i < _limit, "out of Call Profile ReceiverLimit");
     return _receiver[i];
   }
 };
@@ -1080,6 +1080,9 @@ void ciEnv::register_method(ciMethod* target,
       assert(!method->is_synchronized() || nm->has_monitors(), "");
 
       if (entry_bci == InvocationEntryBci) {
+        if (BindSelfRecursiveCalls) {
+          nm->bind_self_calls();
+        }
         if (TieredCompilation) {
           // If there is an old version we're done with it
           nmethod* old = method->code();
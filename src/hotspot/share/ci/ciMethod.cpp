@@ -463,8 +463,16 @@ int ciMethod::check_overflow(int c, Bytecodes::Code code) {
 // Get the ciCallProfile for the invocation of this method.
 // Also reports receiver types for non-call type checks (if TypeProfileCasts).
 ciCallProfile ciMethod::call_profile_at_bci(int bci) {
+  return call_profile_at_bci(bci, ciCallProfile::MorphismLimit);
+}
+
+// At most receiver_limit receivers, the most frequent ones, are kept.
+ciCallProfile ciMethod::call_profile_at_bci(int bci, int receiver_limit) {
+  assert(receiver_limit >= ciCallProfile::MorphismLimit &&
+         receiver_limit <= ciCallProfile::ReceiverLimit, "invalid receiver limit %d", receiver_limit);
   ResourceMark rm;
   ciCallProfile result;
+  result._receiver_limit = receiver_limit;
   if (method_data() != nullptr && method_data()->is_mature()) {
     ciProfileData* data = method_data()->bci_to_data(bci);
     if (data != nullptr && data->is_CounterData()) {
@@ -551,7 +559,7 @@ void ciCallProfile::add_receiver(ciKlass* receiver, int receiver_count) {
   }
   _receiver[i] = receiver;
   _receiver_count[i] = receiver_count;
-  if (_limit < MorphismLimit) _limit++;
+  if (_limit < _receiver_limit) _limit++;
 }
 
 
@@ -980,6 +988,43 @@ bool ciMethod::is_object_initializer() const {
    return name() == ciSymbols::object_initializer_name();
 }
 
+// ------------------------------------------------------------------
+// ciMethod::is_self_tail_call_site
+//
+// A static method that opted into FastReturn promises not to rely on
+// its own recursive frames, so the compilers may replace an invokestatic
+// of itself that is immediately followed by a return with a jump back to
+// bci 0.
+// The method must not need anything that the discarded frame would
+// otherwise keep alive: monitors, exception handlers, jsr subroutines,
+// or locals that a debugger could inspect.
+bool ciMethod::is_self_tail_call_site(int bci) {
+  if (!OptimizeSelfTailCalls || !is_static() || is_synchronized() ||
+      has_monitor_bytecodes() || has_exception_handlers()) {
+    return false;
+  }
+  ciEnv* env = CURRENT_ENV;
+  if (env->should_retain_local_variables() ||
+      env->jvmti_can_post_on_exceptions()) {
+    return false;
+  }
+  if (!has_fastreturn() || has_jsrs()) {
+    return false;
+  }
+  ciBytecodeStream str(this);
+  str.reset_to_bci(bci);
+  if (str.next() != Bytecodes::_invokestatic) {
+    return false;
+  }
+  bool will_link;
+  ciSignature* declared_signature = nullptr;
+  ciMethod* callee = str.get_method(will_link, &declared_signature);
+  if (!will_link || callee != this) {
+    return false;
+  }
+  return str.next() != ciBytecodeStream::EOBC() && Bytecodes::is_return(str.cur_bc());
+}
+
 // ------------------------------------------------------------------
 // ciMethod::is_scoped
 //
@@ -1280,6 +1325,7 @@ void ciMethod::print_codes_on(outputStream* st) {
 
 bool ciMethod::has_loops      () const {         FETCH_FLAG_FROM_VM(has_loops); }
 bool ciMethod::has_jsrs       () const {         FETCH_FLAG_FROM_VM(has_jsrs);  }
+bool ciMethod::has_fastreturn () const {         FETCH_FLAG_FROM_VM(has_fastreturn); }
 bool ciMethod::is_getter      () const {         FETCH_FLAG_FROM_VM(is_getter); }
 bool ciMethod::is_setter      () const {         FETCH_FLAG_FROM_VM(is_setter); }
 bool ciMethod::is_accessor    () const {         FETCH_FLAG_FROM_VM(is_accessor); }
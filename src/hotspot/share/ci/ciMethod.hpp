@@ -264,6 +264,7 @@ class ciMethod : public ciMetadata {
   ciTypeFlow*   get_flow_analysis();
   ciTypeFlow*   get_osr_flow_analysis(int osr_bci);  // alternate entry point
   ciCallProfile call_profile_at_bci(int bci);
+  ciCallProfile call_profile_at_bci(int bci, int receiver_limit);
 
   // Does type profiling provide any useful information at this point?
   bool          argument_profiled_type(int bci, int i, ciKlass*& type, ProfilePtrKind& ptr_kind);
@@ -349,6 +350,7 @@ class ciMethod : public ciMetadata {
   bool is_overpass    () const                   { check_is_loaded(); return _is_overpass; }
   bool has_loops      () const;
   bool has_jsrs       () const;
+  bool has_fastreturn () const;
   bool is_getter      () const;
   bool is_setter      () const;
   bool is_accessor    () const;
@@ -359,6 +361,9 @@ class ciMethod : public ciMetadata {
   bool is_unboxing_method() const;
   bool is_vector_method() const;
   bool is_object_initializer() const;
+  // Is the invoke at bci a self-recursive call in tail position that C2
+  // may turn into a jump back to bci 0?
+  bool is_self_tail_call_site(int bci);
   bool is_scoped() const;
   bool is_old() const;
 
@@ -236,6 +236,17 @@ void ciMethodBlocks::do_analysis() {
         break;
       }
 
+      case Bytecodes::_invokestatic:
+        // A self tail call is parsed as a jump back to the method entry,
+        // so it ends its block just like a goto.
+        if (_method->is_self_tail_call_site(bci)) {
+          cur_block->set_control_bci(bci);
+          if (s.next_bci() < limit_bci) {
+            (void) make_block_at(s.next_bci());
+          }
+        }
+        break;
+
       case Bytecodes::_athrow      :
         cur_block->set_may_throw();
         // fall-through
@@ -53,7 +53,11 @@ ciMethodData::ciMethodData(MethodData* md)
   // Initialize the escape information (to "don't know.");
   _eflags(0), _arg_local(0), _arg_stack(0), _arg_returned(0),
   _invocation_counter(0),
-  _orig() {}
+  _orig() {
+  for (int i = 0; i < MethodData::recursion_depth_buckets; i++) {
+    _recursion_depth[i] = 0;
+  }
+}
 
 
 static bool is_klass_loaded(Klass* k) {
@@ -298,6 +302,9 @@ bool ciMethodData::load_data() {
   _arg_local = mdo->arg_local();
   _arg_stack = mdo->arg_stack();
   _arg_returned  = mdo->arg_returned();
+  for (int i = 0; i < MethodData::recursion_depth_buckets; i++) {
+    _recursion_depth[i] = mdo->recursion_depth_count(i);
+  }
   if (ReplayCompiles) {
     ciReplay::initialize(this);
     if (is_empty()) {
@@ -561,6 +568,24 @@ void ciMethodData::update_escape_info() {
   }
 }
 
+int ciMethodData::recursion_depth() const {
+  julong total = 0;
+  for (int i = 0; i < MethodData::recursion_depth_buckets; i++) {
+    total += _recursion_depth[i];
+  }
+  if (total == 0) {
+    return 0;
+  }
+  julong seen = 0;
+  for (int i = 0; i < MethodData::recursion_depth_buckets; i++) {
+    seen += _recursion_depth[i];
+    if (seen * 2 >= total) {
+      return i + 1;
+    }
+  }
+  return MethodData::recursion_depth_buckets;
+}
+
 void ciMethodData::set_compilation_stats(short loops, short blocks) {
   VM_ENTRY_MARK;
   MethodData* mdo = get_MethodData();
@@ -404,6 +404,9 @@ class ciMethodData : public ciMetadata {
   // its maturity we need separate counters.
   int _invocation_counter;
 
+  // Snapshot of the sampled recursion depth histogram.
+  uint _recursion_depth[MethodData::recursion_depth_buckets];
+
   // Coherent snapshot of original header.
   MethodData::CompilerCounters _orig;
 
@@ -479,6 +482,10 @@ class ciMethodData : public ciMetadata {
 
   int invocation_count() { return _invocation_counter; }
 
+  // Median number of activations of the method on the stack seen by the
+  // recursion depth samples, or 0 if the method was never sampled.
+  int recursion_depth() const;
+
   // Transfer information about the method to MethodData*.
   // would_profile means we would like to profile this method,
   // meaning it's not trivial.
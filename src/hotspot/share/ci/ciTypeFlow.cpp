@@ -707,6 +707,28 @@ void ciTypeFlow::StateVector::do_invoke(ciBytecodeStream* str,
   }
 }
 
+// ------------------------------------------------------------------
+// ciTypeFlow::StateVector::do_self_tail_call
+//
+// The outgoing arguments become the incoming parameters of the next
+// iteration, and the state is reset to what the method entry expects.
+void ciTypeFlow::StateVector::do_self_tail_call(ciBytecodeStream* str) {
+  const int arg_size = outer()->method()->arg_size();
+  assert(outer()->method()->is_static(), "no receiver");
+  assert(stack_size() >= arg_size, "arguments must be on the stack");
+  const int stack_base = stack_size() - arg_size;
+  for (int i = 0; i < arg_size; i++) {
+    set_type_at(local(i), type_at(stack(stack_base + i)));
+    store_to_local(i);
+  }
+  for (int i = arg_size; i < outer()->max_locals(); i++) {
+    set_type_at(local(i), bottom_type());
+  }
+  while (stack_size() > 0) {
+    pop();
+  }
+}
+
 // ------------------------------------------------------------------
 // ciTypeFlow::StateVector::do_jsr
 void ciTypeFlow::StateVector::do_jsr(ciBytecodeStream* str) {
@@ -1326,7 +1348,15 @@ bool ciTypeFlow::StateVector::apply_one_bytecode(ciBytecodeStream* str) {
     }
   case Bytecodes::_invokeinterface: do_invoke(str, true);           break;
   case Bytecodes::_invokespecial:   do_invoke(str, true);           break;
-  case Bytecodes::_invokestatic:    do_invoke(str, false);          break;
+  case Bytecodes::_invokestatic:
+    {
+      if (outer()->method()->is_self_tail_call_site(str->cur_bci())) {
+        do_self_tail_call(str);
+      } else {
+        do_invoke(str, false);
+      }
+      break;
+    }
   case Bytecodes::_invokevirtual:   do_invoke(str, true);           break;
   case Bytecodes::_invokedynamic:   do_invoke(str, false);          break;
 
@@ -1754,6 +1784,15 @@ ciTypeFlow::Block::successors(ciBytecodeStream* str,
         break;
       }
 
+      case Bytecodes::_invokestatic:
+        // Only a self tail call ends a block; it jumps back to the entry.
+        assert(analyzer->method()->is_self_tail_call_site(current_bci), "must be");
+        _successors =
+          new (arena) GrowableArray<Block*>(arena, 1, 0, nullptr);
+        assert(_successors->length() == GOTO_TARGET, "");
+        _successors->append(analyzer->block_at(0, jsrs));
+        break;
+
       case Bytecodes::_athrow:     case Bytecodes::_ireturn:
       case Bytecodes::_lreturn:    case Bytecodes::_freturn:
       case Bytecodes::_dreturn:    case Bytecodes::_areturn:
@@ -360,6 +360,7 @@ class ciTypeFlow : public ArenaObj {
     void do_getfield(ciBytecodeStream* str);
     void do_getstatic(ciBytecodeStream* str);
     void do_invoke(ciBytecodeStream* str, bool has_receiver);
+    void do_self_tail_call(ciBytecodeStream* str);
     void do_jsr(ciBytecodeStream* str);
     void do_ldc(ciBytecodeStream* str);
     void do_multianewarray(ciBytecodeStream* str);
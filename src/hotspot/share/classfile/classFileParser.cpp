@@ -2206,6 +2206,7 @@ Method* ClassFileParser::parse_method(const ClassFileStream* const cfs,
   bool parsed_code_attribute = false;
   bool parsed_checked_exceptions_attribute = false;
   bool parsed_stackmap_attribute = false;
+  bool parsed_fastreturn_attribute = false;
   // stackmap attribute - JDK1.5
   const u1* stackmap_data = nullptr;
   int stackmap_data_length = 0;
@@ -2446,6 +2447,16 @@ Method* ClassFileParser::parse_method(const ClassFileStream* const cfs,
           method_attribute_length, THREAD);
         return nullptr;
       }
+    } else if (method_attribute_name == vmSymbols::tag_fast_return()) {
+      // Emitted by javac for methods containing fastreturn statements.
+      // Carries no payload; an unknown attribute to other VMs.
+      if (method_attribute_length != 0) {
+        classfile_parse_error(
+          "Invalid FastReturn method attribute length %u in class file %s",
+          method_attribute_length, THREAD);
+        return nullptr;
+      }
+      parsed_fastreturn_attribute = true;
     } else if (_major_version >= JAVA_1_5_VERSION) {
       if (method_attribute_name == vmSymbols::tag_signature()) {
         if (generic_signature_index != 0) {
@@ -2662,6 +2673,10 @@ Method* ClassFileParser::parse_method(const ClassFileStream* const cfs,
     m->set_is_hidden();
   }
 
+  if (parsed_fastreturn_attribute && parsed_code_attribute) {
+    m->set_has_fastreturn();
+  }
+
   // Copy annotations
   copy_method_annotations(m->constMethod(),
                           runtime_visible_annotations,
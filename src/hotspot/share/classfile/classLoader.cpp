@@ -95,6 +95,7 @@ static JImageOpen_t                    JImageOpen             = nullptr;
 static JImageClose_t                   JImageClose            = nullptr;
 static JImageFindResource_t            JImageFindResource     = nullptr;
 static JImageGetResource_t             JImageGetResource      = nullptr;
+static JImageGetResourceAddress_t      JImageGetResourceAddress = nullptr;
 
 // JimageFile pointer, or null if exploded JDK build.
 static JImageFile*                     JImage_file            = nullptr;
@@ -441,11 +442,16 @@ ClassFileStream* ClassPathImageEntry::open_stream_for_loader(JavaThread* current
     if (UsePerfData) {
       ClassLoader::perf_sys_classfile_bytes_read()->inc(size);
     }
-    char* data = NEW_RESOURCE_ARRAY(char, size);
-    (*JImageGetResource)(jimage_non_null(), location, data, size);
-    // Resource allocated
+    // Parse uncompressed classes in place from the mapped image, which
+    // outlives the stream; otherwise copy or decompress into the resource area.
+    const char* data = (*JImageGetResourceAddress)(jimage_non_null(), location);
+    if (data == nullptr) {
+      char* buffer = NEW_RESOURCE_ARRAY(char, size);
+      (*JImageGetResource)(jimage_non_null(), location, buffer, size);
+      data = buffer;
+    }
     assert(this == (ClassPathImageEntry*)ClassLoader::get_jrt_entry(), "must be");
-    return new ClassFileStream((u1*)data,
+    return new ClassFileStream((const u1*)data,
                                checked_cast<int>(size),
                                _name,
                                true); // from_boot_loader_modules_image
@@ -861,8 +867,10 @@ void ClassLoader::load_jimage_library() {
       JImageClose = CAST_TO_FN_PTR(JImageClose_t, os::lookup_function("JIMAGE_Close"));
       JImageFindResource = CAST_TO_FN_PTR(JImageFindResource_t, os::lookup_function("JIMAGE_FindResource"));
       JImageGetResource = CAST_TO_FN_PTR(JImageGetResource_t, os::lookup_function("JIMAGE_GetResource"));
+      JImageGetResourceAddress = CAST_TO_FN_PTR(JImageGetResourceAddress_t, os::lookup_function("JIMAGE_GetResourceAddress"));
       assert(JImageOpen != nullptr && JImageClose != nullptr &&
-            JImageFindResource != nullptr && JImageGetResource != nullptr,
+            JImageFindResource != nullptr && JImageGetResource != nullptr &&
+            JImageGetResourceAddress != nullptr,
             "could not lookup all jimage library functions");
       return;
     }
@@ -881,8 +889,10 @@ void ClassLoader::load_jimage_library() {
   JImageClose = CAST_TO_FN_PTR(JImageClose_t, dll_lookup(handle, "JIMAGE_Close", path));
   JImageFindResource = CAST_TO_FN_PTR(JImageFindResource_t, dll_lookup(handle, "JIMAGE_FindResource", path));
   JImageGetResource = CAST_TO_FN_PTR(JImageGetResource_t, dll_lookup(handle, "JIMAGE_GetResource", path));
+  JImageGetResourceAddress = CAST_TO_FN_PTR(JImageGetResourceAddress_t, dll_lookup(handle, "JIMAGE_GetResourceAddress", path));
   assert(JImageOpen != nullptr && JImageClose != nullptr &&
-        JImageFindResource != nullptr && JImageGetResource != nullptr,
+        JImageFindResource != nullptr && JImageGetResource != nullptr &&
+        JImageGetResourceAddress != nullptr,
         "could not lookup all jimage library functions in jimage library");
 }
 
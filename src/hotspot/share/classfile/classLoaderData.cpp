@@ -657,7 +657,7 @@ const int _default_loader_dictionary_size = 107;
 
 Dictionary* ClassLoaderData::create_dictionary() {
   assert(!has_class_mirror_holder(), "class mirror holder cld does not have a dictionary");
-  int size;
+  size_t size;
   if (_the_null_class_loader_data == nullptr) {
     size = _boot_loader_dictionary_size;
   } else if (is_system_class_loader_data()) {
@@ -665,6 +665,16 @@ Dictionary* ClassLoaderData::create_dictionary() {
   } else {
     size = _default_loader_dictionary_size;
   }
+  // The builtin loaders will likely load most of the classes archived for
+  // them. Size their dictionaries so that loading those does not make the
+  // table grow, which happens under the SystemDictionary_lock, during the
+  // startup burst. The archive does not tell which builtin loader a class
+  // belongs to, so each gets room for all of them, at about two classes per
+  // bucket.
+  if (_the_null_class_loader_data == nullptr || is_system_class_loader_data() ||
+      is_platform_class_loader_data()) {
+    size = MAX2(size, SystemDictionaryShared::archived_builtin_class_count() / 2);
+  }
   return new Dictionary(this, size);
 }
 
@@ -2083,6 +2083,7 @@ int java_lang_VirtualThread::_onWaitingList_offset;
 int java_lang_VirtualThread::_notified_offset;
 int java_lang_VirtualThread::_timeout_offset;
 int java_lang_VirtualThread::_objectWaiter_offset;
+int java_lang_VirtualThread::_lastCarrier_offset;
 
 #define VTHREAD_FIELDS_DO(macro) \
   macro(static_vthread_scope_offset,       k, "VTHREAD_SCOPE",      continuationscope_signature, true);  \
@@ -2169,6 +2170,14 @@ void java_lang_VirtualThread::set_timeout(oop vthread, jlong value) {
   vthread->long_field_put(_timeout_offset, value);
 }
 
+jlong java_lang_VirtualThread::last_carrier(oop vthread) {
+  return vthread->long_field(_lastCarrier_offset);
+}
+
+void java_lang_VirtualThread::set_last_carrier(oop vthread, jlong tid) {
+  vthread->long_field_put(_lastCarrier_offset, tid);
+}
+
 JavaThreadStatus java_lang_VirtualThread::map_state_to_thread_status(int state) {
   JavaThreadStatus status = JavaThreadStatus::NEW;
   switch (state & ~SUSPENDED) {
@@ -2349,9 +2358,23 @@ static inline bool version_matches(Method* method, int version) {
 // exception backtrace to insulate users of the backtrace from needing
 // to know what it looks like.
 // The code of this class is not GC safe. Allocations can only happen
-// in expand().
+// in expand() and allocate_repeats().
+//
+// With CompactRecursiveBacktraces, a cycle of up to max_cycle_period
+// frames that repeats right after itself is stored once. The element
+// ending the last stored occurrence gets a repeat count in the chunk's
+// repeats array, (count << repeat_count_shift) | (period - 1), meaning that
+// the preceding period elements follow count more times.
 class BacktraceBuilder: public StackObj {
  friend class BacktraceIterator;
+ public:
+  enum {
+    max_cycle_period     = 8,
+    repeat_period_mask   = max_cycle_period - 1,
+    repeat_count_shift   = 3,
+    max_repeat_count     = max_jint >> repeat_count_shift
+  };
+
  private:
   Handle          _backtrace;
   objArrayOop     _head;
@@ -2359,11 +2382,21 @@ class BacktraceBuilder: public StackObj {
   typeArrayOop    _bcis;
   objArrayOop     _mirrors;
   typeArrayOop    _names; // Needed to insulate method name against redefinition.
+  typeArrayOop    _repeats; // Allocated with the first repeat count of the chunk.
   // True if the top frame of the backtrace is omitted because it shall be hidden.
   bool            _has_hidden_top_frame;
   int             _index;
   NoSafepointVerifier _nsv;
 
+  // Cycle detection, only used when _compact is set.
+  bool            _compact;
+  int             _count;         // frames pushed, including the repeated ones
+  Method*         _last_methods[max_cycle_period];
+  int             _last_bcis[max_cycle_period];
+  int             _cycle_period;  // period of the current cycle, 0 if none
+  int             _cycle_phase;   // frames of the next occurrence seen so far
+  int             _cycle_repeats; // complete occurrences that were not stored
+
   enum {
     trace_methods_offset = java_lang_Throwable::trace_methods_offset,
     trace_bcis_offset    = java_lang_Throwable::trace_bcis_offset,
@@ -2372,10 +2405,12 @@ class BacktraceBuilder: public StackObj {
     trace_conts_offset   = java_lang_Throwable::trace_conts_offset,
     trace_next_offset    = java_lang_Throwable::trace_next_offset,
     trace_hidden_offset  = java_lang_Throwable::trace_hidden_offset,
+    trace_repeats_offset = java_lang_Throwable::trace_repeats_offset,
     trace_size           = java_lang_Throwable::trace_size,
     trace_chunk_size     = java_lang_Throwable::trace_chunk_size
   };
 
+
   // get info out of chunks
   static typeArrayOop get_methods(objArrayHandle chunk) {
     typeArrayOop methods = typeArrayOop(chunk->obj_at(trace_methods_offset));
@@ -2397,15 +2432,96 @@ class BacktraceBuilder: public StackObj {
     assert(names != nullptr, "names array should be initialized in backtrace");
     return names;
   }
+  static typeArrayOop get_repeats(objArrayHandle chunk) {
+    return typeArrayOop(chunk->obj_at(trace_repeats_offset));
+  }
   static bool has_hidden_top_frame(objArrayHandle chunk) {
     oop hidden = chunk->obj_at(trace_hidden_offset);
     return hidden != nullptr;
   }
 
+  // Does the frame match the one pushed period frames ago?
+  bool repeats_frame(Method* method, int bci, int period) const {
+    int i = (_count - period) & repeat_period_mask;
+    return _last_methods[i] == method && _last_bcis[i] == bci;
+  }
+
+  void remember_frame(Method* method, int bci) {
+    int i = _count & repeat_period_mask;
+    _last_methods[i] = method;
+    _last_bcis[i] = bci;
+    _count++;
+  }
+
+  void allocate_repeats(TRAPS) {
+    objArrayHandle head(THREAD, _head);
+    PauseNoSafepointVerifier pnsv(&_nsv);
+
+    typeArrayOop repeats = oopFactory::new_intArray(trace_chunk_size, CHECK);
+    head->obj_at_put(trace_repeats_offset, repeats);
+
+    _head    = head();
+    _methods = get_methods(head);
+    _bcis    = get_bcis(head);
+    _mirrors = get_mirrors(head);
+    _names   = get_names(head);
+    _repeats = repeats;
+  }
+
+  // Record one more complete occurrence of the current cycle on the last
+  // stored element.
+  void add_cycle_repeat(TRAPS) {
+    if (_repeats == nullptr) {
+      allocate_repeats(CHECK);
+    }
+    _cycle_repeats++;
+    _repeats->int_at_put(_index - 1, (_cycle_repeats << repeat_count_shift) | (_cycle_period - 1));
+    _cycle_phase = 0;
+    if (_cycle_repeats == max_repeat_count) {
+      _cycle_period = 0;
+    }
+  }
+
+  // The frames of an incomplete occurrence of the cycle are stored after all.
+  void end_cycle(TRAPS) {
+    int phase = _cycle_phase;
+    _cycle_period = 0;
+    _cycle_phase = 0;
+    for (int i = _count - phase; i < _count; i++) {
+      int j = i & repeat_period_mask;
+      store(_last_methods[j], _last_bcis[j], CHECK);
+    }
+  }
+
+  void store(Method* method, int bci, TRAPS) {
+    if (_index >= trace_chunk_size) {
+      methodHandle mhandle(THREAD, method);
+      expand(CHECK);
+      method = mhandle();
+    }
+
+    _methods->ushort_at_put(_index, method->orig_method_idnum());
+    _bcis->int_at_put(_index, Backtrace::merge_bci_and_version(bci, method->constants()->version()));
+
+    // Note:this doesn't leak symbols because the mirror in the backtrace keeps the
+    // klass owning the symbols alive so their refcounts aren't decremented.
+    Symbol* name = method->name();
+    _names->symbol_at_put(_index, name);
+
+    // We need to save the mirrors in the backtrace to keep the class
+    // from being unloaded while we still have this stack trace.
+    assert(method->method_holder()->java_mirror() != nullptr, "never push null for mirror");
+    _mirrors->obj_at_put(_index, method->method_holder()->java_mirror());
+
+    _index++;
+  }
+
  public:
 
   // constructor for new backtrace
-  BacktraceBuilder(TRAPS): _head(nullptr), _methods(nullptr), _bcis(nullptr), _mirrors(nullptr), _names(nullptr), _has_hidden_top_frame(false) {
+  BacktraceBuilder(TRAPS): _head(nullptr), _methods(nullptr), _bcis(nullptr), _mirrors(nullptr), _names(nullptr), _repeats(nullptr),
+                           _has_hidden_top_frame(false), _compact(CompactRecursiveBacktraces), _count(0),
+                           _cycle_period(0), _cycle_phase(0), _cycle_repeats(0) {
     expand(CHECK);
     _backtrace = Handle(THREAD, _head);
     _index = 0;
@@ -2416,7 +2532,15 @@ class BacktraceBuilder: public StackObj {
     _bcis = get_bcis(backtrace);
     _mirrors = get_mirrors(backtrace);
     _names = get_names(backtrace);
+    _repeats = get_repeats(backtrace);
     _has_hidden_top_frame = has_hidden_top_frame(backtrace);
+    // The preallocated backtrace has no room to expand repeats into.
+    _compact = false;
+    _count = 0;
+    _cycle_period = 0;
+    _cycle_phase = 0;
+    _cycle_repeats = 0;
+    assert(_repeats == nullptr, "preallocated backtraces are not compacted");
     assert(_methods->length() == _bcis->length() &&
            _methods->length() == _mirrors->length() &&
            _mirrors->length() == _names->length(),
@@ -2461,6 +2585,7 @@ class BacktraceBuilder: public StackObj {
     _bcis = new_bcis();
     _mirrors = new_mirrors();
     _names  = new_names();
+    _repeats = nullptr;
     _index = 0;
   }
 
@@ -2474,26 +2599,51 @@ class BacktraceBuilder: public StackObj {
     // to a 0 even if it could be recorded.
     if (bci == SynchronizationEntryBCI) bci = 0;
 
-    if (_index >= trace_chunk_size) {
+    if (!_compact) {
+      store(method, bci, CHECK);
+      return;
+    }
+
+    if (_cycle_period > 0) {
+      if (repeats_frame(method, bci, _cycle_period)) {
+        remember_frame(method, bci);
+        if (++_cycle_phase == _cycle_period) {
+          add_cycle_repeat(CHECK);
+        }
+        return;
+      }
       methodHandle mhandle(THREAD, method);
-      expand(CHECK);
+      end_cycle(CHECK);
       method = mhandle();
     }
 
-    _methods->ushort_at_put(_index, method->orig_method_idnum());
-    _bcis->int_at_put(_index, Backtrace::merge_bci_and_version(bci, method->constants()->version()));
-
-    // Note:this doesn't leak symbols because the mirror in the backtrace keeps the
-    // klass owning the symbols alive so their refcounts aren't decremented.
-    Symbol* name = method->name();
-    _names->symbol_at_put(_index, name);
+    // A new cycle can only start after a stored element without a
+    // repeat count of its own.
+    if (_index > 0 && (_repeats == nullptr || _repeats->int_at(_index - 1) == 0)) {
+      int max_period = MIN2((int)max_cycle_period, _count);
+      for (int period = 1; period <= max_period; period++) {
+        if (repeats_frame(method, bci, period)) {
+          remember_frame(method, bci);
+          _cycle_period = period;
+          _cycle_phase = 1;
+          _cycle_repeats = 0;
+          if (_cycle_phase == _cycle_period) {
+            add_cycle_repeat(CHECK);
+          }
+          return;
+        }
+      }
+    }
 
-    // We need to save the mirrors in the backtrace to keep the class
-    // from being unloaded while we still have this stack trace.
-    assert(method->method_holder()->java_mirror() != nullptr, "never push null for mirror");
-    _mirrors->obj_at_put(_index, method->method_holder()->java_mirror());
+    store(method, bci, CHECK);
+    remember_frame(method, bci);
+  }
 
-    _index++;
+  // Store the frames of a cycle that was cut short by the end of the stack.
+  void finish(TRAPS) {
+    if (_cycle_period > 0) {
+      end_cycle(CHECK);
+    }
   }
 
   void set_has_hidden_top_frame() {
@@ -2527,6 +2677,27 @@ class BacktraceIterator : public StackObj {
   typeArrayHandle _methods;
   typeArrayHandle _bcis;
   typeArrayHandle _names;
+  typeArrayHandle _repeats;
+
+  // The last elements returned, to replay the cycles of a compacted backtrace.
+  int     _count;
+  int     _replay;
+  int     _replay_period;
+  Handle  _last_mirrors[BacktraceBuilder::max_cycle_period];
+  int     _last_method_ids[BacktraceBuilder::max_cycle_period];
+  int     _last_versions[BacktraceBuilder::max_cycle_period];
+  int     _last_bcis[BacktraceBuilder::max_cycle_period];
+  Symbol* _last_names[BacktraceBuilder::max_cycle_period];
+
+  void remember(const BacktraceElement& e) {
+    int i = _count & BacktraceBuilder::repeat_period_mask;
+    _last_mirrors[i] = e._mirror;
+    _last_method_ids[i] = e._method_id;
+    _last_versions[i] = e._version;
+    _last_bcis[i] = e._bci;
+    _last_names[i] = e._name;
+    _count++;
+  }
 
   void init(objArrayHandle result, Thread* thread) {
     // Get method id, bci, version and mirror from chunk
@@ -2536,21 +2707,37 @@ class BacktraceIterator : public StackObj {
       _bcis = typeArrayHandle(thread, BacktraceBuilder::get_bcis(_result));
       _mirrors = objArrayHandle(thread, BacktraceBuilder::get_mirrors(_result));
       _names = typeArrayHandle(thread, BacktraceBuilder::get_names(_result));
+      _repeats = typeArrayHandle(thread, BacktraceBuilder::get_repeats(_result));
       _index = 0;
     }
   }
  public:
-  BacktraceIterator(objArrayHandle result, Thread* thread) {
+  BacktraceIterator(objArrayHandle result, Thread* thread) : _count(0), _replay(0), _replay_period(0) {
     init(result, thread);
     assert(_methods.is_null() || _methods->length() == java_lang_Throwable::trace_chunk_size, "lengths don't match");
   }
 
   BacktraceElement next(Thread* thread) {
+    if (_replay > 0) {
+      int i = (_count - _replay_period) & BacktraceBuilder::repeat_period_mask;
+      BacktraceElement e (_last_mirrors[i], _last_method_ids[i], _last_versions[i],
+                          _last_bcis[i], _last_names[i]);
+      remember(e);
+      _replay--;
+      return e;
+    }
+
     BacktraceElement e (Handle(thread, _mirrors->obj_at(_index)),
                         _methods->ushort_at(_index),
                         Backtrace::version_at(_bcis->int_at(_index)),
                         Backtrace::bci_at(_bcis->int_at(_index)),
                         _names->symbol_at(_index));
+    remember(e);
+    int repeat = _repeats.not_null() ? _repeats->int_at(_index) : 0;
+    if (repeat != 0) {
+      _replay_period = (repeat & BacktraceBuilder::repeat_period_mask) + 1;
+      _replay = (repeat >> BacktraceBuilder::repeat_count_shift) * _replay_period;
+    }
     _index++;
 
     if (_index >= java_lang_Throwable::trace_chunk_size) {
@@ -2563,7 +2750,7 @@ class BacktraceIterator : public StackObj {
   }
 
   bool repeat() {
-    return _result.not_null() && _mirrors->obj_at(_index) != nullptr;
+    return _replay > 0 || (_result.not_null() && _mirrors->obj_at(_index) != nullptr);
   }
 };
 
@@ -2718,6 +2905,12 @@ void java_lang_Throwable::java_printStackTrace(Handle throwable, TRAPS) {
 }
 
 void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method, TRAPS) {
+  fill_in_stack_trace(throwable, method, MaxJavaStackTraceDepth, 0, THREAD);
+}
+
+void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method,
+                                              int max_depth, int tail_depth, TRAPS) {
+  assert(tail_depth == 0 || max_depth > 0, "a tail needs a bounded head");
   if (!StackTraceInThrowable) return;
   ResourceMark rm(THREAD);
 
@@ -2728,7 +2921,6 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   // This is unnecessary in 1.7+ but harmless
   clear_stacktrace(throwable());
 
-  int max_depth = MaxJavaStackTraceDepth;
   JavaThread* thread = THREAD;
 
   BacktraceBuilder bt(CHECK);
@@ -2766,7 +2958,16 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   bool skip_hidden = !ShowHiddenFrames;
   bool show_carrier = ShowCarrierFrames;
   ContinuationEntry* cont_entry = thread->last_continuation();
-  for (frame fr = thread->last_frame(); max_depth == 0 || max_depth != total_count;) {
+  // Once the head is full, the frames below it only go through a ring
+  // that keeps the last tail_depth of them.
+  Method** tail_methods = nullptr;
+  int* tail_bcis = nullptr;
+  int tail_count = 0;
+  if (tail_depth > 0) {
+    tail_methods = NEW_RESOURCE_ARRAY(Method*, tail_depth);
+    tail_bcis = NEW_RESOURCE_ARRAY(int, tail_depth);
+  }
+  for (frame fr = thread->last_frame(); max_depth == 0 || max_depth != total_count || tail_depth > 0;) {
     Method* method = nullptr;
     int bci = 0;
 
@@ -2865,15 +3066,42 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
       }
     }
 
+    if (tail_depth > 0 && total_count == max_depth) {
+      int slot = tail_count++ % tail_depth;
+      tail_methods[slot] = method;
+      tail_bcis[slot] = bci;
+      continue;
+    }
+
     bt.push(method, bci, CHECK);
     total_count++;
   }
 
+  int omitted = 0;
+  if (tail_count > 0) {
+    int kept = MIN2(tail_count, tail_depth);
+    omitted = tail_count - kept;
+    for (int i = omitted; i < tail_count; i++) {
+      bt.push(tail_methods[i % tail_depth], tail_bcis[i % tail_depth], CHECK);
+      total_count++;
+    }
+  }
+  bt.finish(CHECK);
+
   log_info(stacktrace)("%s, %d", throwable->klass()->external_name(), total_count);
 
   // Put completed stack trace into throwable object
   set_backtrace(throwable(), bt.backtrace());
   set_depth(throwable(), total_count);
+
+  if (omitted > 0 && message(throwable()) == nullptr) {
+    // Tell the reader where the gap in the trace is and how deep the stack was
+    char buf[128];
+    os::snprintf_checked(buf, sizeof(buf), "%d frames omitted after frame %d of %d",
+                         omitted, max_depth, total_count + omitted);
+    oop msg = java_lang_String::create_oop_from_str(buf, CHECK);
+    set_message(throwable(), msg);
+  }
 }
 
 void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHandle& method) {
@@ -2896,6 +3124,26 @@ void java_lang_Throwable::fill_in_stack_trace(Handle throwable, const methodHand
   CLEAR_PENDING_EXCEPTION;
 }
 
+void java_lang_Throwable::fill_in_stack_overflow_trace(Handle throwable) {
+  if (StackOverflowErrorTraceFrames == 0) {
+    fill_in_stack_trace(throwable);
+    return;
+  }
+
+  if (!StackTraceInThrowable) {
+    return;
+  }
+
+  JavaThread* THREAD = JavaThread::current(); // For exception macros.
+  PreserveExceptionMark pm(THREAD);
+
+  // Only the top and the bottom of an overflowed stack are of interest: the
+  // frames in between are usually the same recursion over and over.
+  fill_in_stack_trace(throwable, methodHandle(), StackOverflowErrorTraceFrames,
+                      StackOverflowErrorTraceFrames, THREAD);
+  CLEAR_PENDING_EXCEPTION;
+}
+
 void java_lang_Throwable::allocate_backtrace(Handle throwable, TRAPS) {
   // Allocate stack trace - backtrace is created but not filled in
 
@@ -3239,7 +3487,12 @@ void java_lang_ClassFrameInfo::init_class(Handle stackFrame, const methodHandle&
 
 void java_lang_ClassFrameInfo::init_method(Handle stackFrame, const methodHandle& m, TRAPS) {
   oop rmethod_name = java_lang_invoke_ResolvedMethodName::find_resolved_method(m, CHECK);
-  stackFrame->obj_field_put(_classOrMemberName_offset, rmethod_name);
+  init_method(stackFrame, m, rmethod_name);
+}
+
+void java_lang_ClassFrameInfo::init_method(Handle stackFrame, const methodHandle& m, oop resolved_method) {
+  assert(java_lang_invoke_ResolvedMethodName::vmtarget(resolved_method) == m() || m->is_old(), "wrong method");
+  stackFrame->obj_field_put(_classOrMemberName_offset, resolved_method);
   // flags is initialized when ClassFrameInfo object is constructed and retain the value
   int flags = java_lang_ClassFrameInfo::flags(stackFrame()) | get_flags(m);
   stackFrame->int_field_put(_flags_offset, flags);
@@ -3279,11 +3532,16 @@ Method* java_lang_StackFrameInfo::get_method(oop obj) {
   return method;
 }
 
-void java_lang_StackFrameInfo::set_method_and_bci(Handle stackFrame, const methodHandle& method, int bci, oop cont, TRAPS) {
+void java_lang_StackFrameInfo::set_method_and_bci(Handle stackFrame, const methodHandle& method, int bci, oop cont,
+                                                  oop resolved_method, TRAPS) {
   // set Method* or mid/cpref
   HandleMark hm(THREAD);
   Handle cont_h(THREAD, cont);
-  java_lang_ClassFrameInfo::init_method(stackFrame, method, CHECK);
+  if (resolved_method != nullptr) {
+    java_lang_ClassFrameInfo::init_method(stackFrame, method, resolved_method);
+  } else {
+    java_lang_ClassFrameInfo::init_method(stackFrame, method, CHECK);
+  }
 
   // set bci
   java_lang_StackFrameInfo::set_bci(stackFrame(), bci);
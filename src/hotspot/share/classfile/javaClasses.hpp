@@ -545,7 +545,8 @@ class java_lang_ThreadGroup : AllStatic {
 
 // Interface to java.lang.VirtualThread objects
 #define VTHREAD_INJECTED_FIELDS(macro)                                           \
-  macro(java_lang_VirtualThread,   objectWaiter,  intptr_signature,       false)
+  macro(java_lang_VirtualThread,   objectWaiter,  intptr_signature,       false) \
+  macro(java_lang_VirtualThread,   lastCarrier,   long_signature,         false)
 
 class java_lang_VirtualThread : AllStatic {
  private:
@@ -559,6 +560,7 @@ class java_lang_VirtualThread : AllStatic {
   static int _recheckInterval_offset;
   static int _timeout_offset;
   static int _objectWaiter_offset;
+  static int _lastCarrier_offset;
   JFR_ONLY(static int _jfr_epoch_offset;)
  public:
   enum {
@@ -608,6 +610,9 @@ class java_lang_VirtualThread : AllStatic {
   static jlong timeout(oop vthread);
   static void set_timeout(oop vthread, jlong value);
   static void set_notified(oop vthread, jboolean value);
+  // Thread id of the carrier that last mounted the virtual thread, 0 if never mounted
+  static jlong last_carrier(oop vthread);
+  static void set_last_carrier(oop vthread, jlong tid);
   static bool is_preempted(oop vthread);
   static JavaThreadStatus map_state_to_thread_status(int state);
 
@@ -634,7 +639,8 @@ class java_lang_Throwable: AllStatic {
     trace_conts_offset   = 4,
     trace_next_offset    = 5,
     trace_hidden_offset  = 6,
-    trace_size           = 7,
+    trace_repeats_offset = 7,
+    trace_size           = 8,
     trace_chunk_size     = 32
   };
 
@@ -650,6 +656,10 @@ class java_lang_Throwable: AllStatic {
   // Stacktrace (post JDK 1.7.0 to allow immutability protocol to be followed)
   static void set_stacktrace(oop throwable, oop st_element_array);
   static oop unassigned_stacktrace();
+  // Fill in the top max_depth frames and, if tail_depth > 0, the bottom
+  // tail_depth frames of the current stack
+  static void fill_in_stack_trace(Handle throwable, const methodHandle& method,
+                                  int max_depth, int tail_depth, TRAPS);
 
  public:
   // Backtrace
@@ -677,6 +687,8 @@ class java_lang_Throwable: AllStatic {
   // Fill in current stack trace, can cause GC
   static void fill_in_stack_trace(Handle throwable, const methodHandle& method, TRAPS);
   static void fill_in_stack_trace(Handle throwable, const methodHandle& method = methodHandle());
+  // Fill in the stack trace of a StackOverflowError thrown by the VM
+  static void fill_in_stack_overflow_trace(Handle throwable);
 
   // Programmatic access to stack trace
   static void get_stack_trace_elements(int depth, Handle backtrace, objArrayHandle stack_trace, TRAPS);
@@ -1613,6 +1625,7 @@ class java_lang_ClassFrameInfo: AllStatic {
   // Setters
   static void init_class(Handle stackFrame, const methodHandle& m);
   static void init_method(Handle stackFrame, const methodHandle& m, TRAPS);
+  static void init_method(Handle stackFrame, const methodHandle& m, oop resolved_method);
 
   static void compute_offsets();
   static void serialize_offsets(SerializeClosure* f) NOT_CDS_RETURN;
@@ -1641,7 +1654,9 @@ class java_lang_StackFrameInfo: AllStatic {
   static Method* get_method(oop info);
 
   // Setters
-  static void set_method_and_bci(Handle stackFrame, const methodHandle& method, int bci, oop cont, TRAPS);
+  // resolved_method is the ResolvedMethodName of method, or null to look it up.
+  static void set_method_and_bci(Handle stackFrame, const methodHandle& method, int bci, oop cont,
+                                 oop resolved_method, TRAPS);
   static void set_name(oop info, oop value);
   static void set_type(oop info, oop value);
   static void set_bci(oop info, int value);
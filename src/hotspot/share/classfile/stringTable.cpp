@@ -123,6 +123,44 @@ volatile bool _alt_hash = false;
 static bool _rehashed = false;
 static uint64_t _alt_hash_seed = 0;
 
+// With UseStringTableBloomFilter, a String whose hash has no bits set here
+// goes straight to do_intern(). The filter is only a hint: a false negative
+// costs one allocation before the insert finds the existing entry, so it
+// never needs to be cleared when entries die or the table is rehashed.
+static volatile uintx* _bloom_filter = nullptr;
+static size_t _bloom_filter_mask = 0;
+
+static void bloom_filter_bits(uintx hash, size_t& b1, size_t& b2) {
+  uint32_t h2 = (uint32_t)hash * 0x9E3779B9u;
+  b1 = (size_t)hash & _bloom_filter_mask;
+  b2 = (size_t)(h2 ^ (h2 >> 15)) & _bloom_filter_mask;
+}
+
+static bool bloom_filter_bit_at(size_t bit) {
+  return (Atomic::load(&_bloom_filter[bit / BitsPerWord]) & (uintx(1) << (bit % BitsPerWord))) != 0;
+}
+
+static void bloom_filter_set_bit(size_t bit) {
+  if (!bloom_filter_bit_at(bit)) {
+    Atomic::fetch_then_or(&_bloom_filter[bit / BitsPerWord], uintx(1) << (bit % BitsPerWord));
+  }
+}
+
+static bool bloom_filter_might_contain(uintx hash) {
+  size_t b1, b2;
+  bloom_filter_bits(hash, b1, b2);
+  return bloom_filter_bit_at(b1) && bloom_filter_bit_at(b2);
+}
+
+static void bloom_filter_add(uintx hash) {
+  if (_bloom_filter != nullptr) {
+    size_t b1, b2;
+    bloom_filter_bits(hash, b1, b2);
+    bloom_filter_set_bit(b1);
+    bloom_filter_set_bit(b2);
+  }
+}
+
 enum class StringType {
   OopStr, UnicodeStr, SymbolStr, UTF8Str
 };
@@ -317,6 +355,15 @@ void StringTable::create_table() {
   _oop_storage = OopStorageSet::create_weak("StringTable Weak", mtSymbol);
   _oop_storage->register_num_dead_callback(&gc_notification);
 
+  if (UseStringTableBloomFilter) {
+    // 16 bits per initial bucket keeps the false positive rate low until
+    // the table has grown well beyond its initial size.
+    size_t bits = _current_size * 16;
+    _bloom_filter = NEW_C_HEAP_ARRAY(uintx, bits / BitsPerWord, mtSymbol);
+    memset((void*)_bloom_filter, 0, bits / BitsPerWord * sizeof(uintx));
+    _bloom_filter_mask = bits - 1;
+  }
+
 #if INCLUDE_CDS_JAVA_HEAP
   if (ArchiveHeapLoader::is_in_use()) {
     _shared_strings_array = OopHandle(Universe::vm_global(), HeapShared::get_root(_shared_strings_array_root_index));
@@ -528,9 +575,11 @@ oop StringTable::intern(const StringWrapper& name, TRAPS) {
     hash = hash_string(chars, unicode_length, true);
   }
 
-  found_string = do_lookup(name, hash);
-  if (found_string != nullptr) {
-    return found_string;
+  if (_bloom_filter == nullptr || bloom_filter_might_contain(hash)) {
+    found_string = do_lookup(name, hash);
+    if (found_string != nullptr) {
+      return found_string;
+    }
   }
   return do_intern(name, hash, THREAD);
 }
@@ -559,12 +608,14 @@ oop StringTable::do_intern(const StringWrapper& name, uintx hash, TRAPS) {
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      bloom_filter_add(hash);
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
     // This could fail if the String got gc'ed concurrently, so loop back until success.
     if (_local_table->get(THREAD, lookup, stg, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      bloom_filter_add(hash);
       return stg.get_res_oop();
     }
   } while(true);
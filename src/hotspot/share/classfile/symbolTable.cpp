@@ -489,36 +489,55 @@ void SymbolTable::new_symbols(ClassLoaderData* loader_data, const constantPoolHa
   // Note that is_permanent will be false for non-strong hidden classes.
   // even if their loader is the boot loader because they will have a different cld.
   bool is_permanent = loader_data->is_the_null_class_loader_data();
+  Thread* current = Thread::current();
+  bool clean_hint = false;
+  bool rehash_warning = false;
+  ResourceMark rm(current);
   for (int i = 0; i < names_count; i++) {
     const char *name = names[i];
     int len = lengths[i];
     assert(len <= Symbol::max_length(), "must be - these come from the constant pool");
     unsigned int hash = hashValues[i];
     assert(lookup_shared(name, len, hash) == nullptr, "must have checked already");
-    Symbol* sym = do_add_if_needed(name, len, hash, is_permanent);
+    Symbol* sym = do_add(current, name, len, hash, is_permanent, &rehash_warning, &clean_hint);
     assert(sym->refcount() != 0, "lookup should have incremented the count");
     cp->symbol_at_put(cp_indices[i], sym);
   }
+  // The table maintenance is checked once for the whole batch.
+  after_add(rehash_warning, clean_hint);
 }
 
 Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, bool is_permanent) {
+  Thread* current = Thread::current();
+  bool clean_hint = false;
+  bool rehash_warning = false;
+  ResourceMark rm(current);
+  Symbol* sym = do_add(current, name, len, hash, is_permanent, &rehash_warning, &clean_hint);
+  after_add(rehash_warning, clean_hint);
+  return sym;
+}
+
+// Adds the symbol unless it is already in the table, and returns the table's
+// symbol either way. The caller provides the ResourceMark for the temporary
+// symbol, and acts on the rehash and clean hints, which are or-ed into the
+// given flags, afterwards.
+Symbol* SymbolTable::do_add(Thread* current, const char* name, int len, uintx hash, bool is_permanent,
+                            bool* rehash_warning, bool* clean_hint) {
   assert(len <= Symbol::max_length(), "caller should have ensured this");
   SymbolTableLookup lookup(name, len, hash);
   SymbolTableGet stg;
-  bool clean_hint = false;
-  bool rehash_warning = false;
-  Thread* current = Thread::current();
+  bool clean = false;
+  bool rehash = false;
   Symbol* sym;
 
-  ResourceMark rm(current);
   const int alloc_size = Symbol::byte_size(len);
   u1* u1_buf = NEW_RESOURCE_ARRAY_IN_THREAD(current, u1, alloc_size);
   Symbol* tmp = ::new ((void*)u1_buf) Symbol((const u1*)name, len,
                                              (is_permanent || CDSConfig::is_dumping_static_archive()) ? PERM_REFCOUNT : 1);
 
   do {
-    if (_local_table->insert(current, lookup, *tmp, &rehash_warning, &clean_hint)) {
-      if (_local_table->get(current, lookup, stg, &rehash_warning)) {
+    if (_local_table->insert(current, lookup, *tmp, &rehash, &clean)) {
+      if (_local_table->get(current, lookup, stg, &rehash)) {
         sym = stg.get_res_sym();
         // The get adds one to ref count, but we inserted with our ref already included.
         // Therefore decrement with one.
@@ -531,22 +550,28 @@ Symbol* SymbolTable::do_add_if_needed(const char* name, int len, uintx hash, boo
 
     // In case another thread did a concurrent add, return value already in the table.
     // This could fail if the symbol got deleted concurrently, so loop back until success.
-    if (_local_table->get(current, lookup, stg, &rehash_warning)) {
+    if (_local_table->get(current, lookup, stg, &rehash)) {
       // The lookup added a refcount, which is ours.
       sym = stg.get_res_sym();
       break;
     }
   } while(true);
 
+  // The table overwrites the hints on every access, so accumulate them.
+  *rehash_warning |= rehash;
+  *clean_hint |= clean;
+
+  assert((sym == nullptr) || sym->refcount() != 0, "found dead symbol");
+  return sym;
+}
+
+void SymbolTable::after_add(bool rehash_warning, bool clean_hint) {
   update_needs_rehash(rehash_warning);
 
   if (clean_hint) {
     mark_has_items_to_clean();
     check_concurrent_work();
   }
-
-  assert((sym == nullptr) || sym->refcount() != 0, "found dead symbol");
-  return sym;
 }
 
 Symbol* SymbolTable::new_permanent_symbol(const char* name) {
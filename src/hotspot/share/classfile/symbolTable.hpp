@@ -75,6 +75,9 @@ class SymbolTable : public AllStatic {
 
   static Symbol* do_lookup(const char* name, int len, uintx hash);
   static Symbol* do_add_if_needed(const char* name, int len, uintx hash, bool is_permanent);
+  static Symbol* do_add(Thread* current, const char* name, int len, uintx hash, bool is_permanent,
+                        bool* rehash_warning, bool* clean_hint);
+  static void after_add(bool rehash_warning, bool clean_hint);
 
   // lookup only, won't add. Also calculate hash. Used by the ClassfileParser.
   static Symbol* lookup_only(const char* name, int len, unsigned int& hash);
@@ -104,7 +107,7 @@ class SymbolTable : public AllStatic {
   static TableStatistics get_table_statistics();
 
   enum {
-    symbol_alloc_batch_size = 8,
+    symbol_alloc_batch_size = 32,
     // Pick initial size based on java -version size measurements
     symbol_alloc_arena_size = 360*K // TODO (revisit)
   };
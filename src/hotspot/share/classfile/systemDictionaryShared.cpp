@@ -364,6 +364,11 @@ bool SystemDictionaryShared::is_builtin_loader(ClassLoaderData* loader_data) {
           SystemDictionary::is_platform_class_loader(class_loader));
 }
 
+size_t SystemDictionaryShared::archived_builtin_class_count() {
+  return _static_archive._builtin_dictionary.entry_count() +
+         _dynamic_archive._builtin_dictionary.entry_count();
+}
+
 bool SystemDictionaryShared::has_platform_or_app_classes() {
   if (FileMapInfo::current_info()->has_platform_or_app_classes()) {
     return true;
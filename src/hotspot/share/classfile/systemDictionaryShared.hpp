@@ -203,6 +203,8 @@ class SystemDictionaryShared: public SystemDictionary {
   static void allocate_shared_data_arrays(int size, TRAPS);
 
   static bool is_builtin_loader(ClassLoaderData* loader_data);
+  // Number of classes of the builtin loaders in the mapped static and dynamic archives
+  static size_t archived_builtin_class_count() NOT_CDS_RETURN_(0);
 
   static InstanceKlass* lookup_super_for_unregistered_class(Symbol* class_name,
                                                             Symbol* super_name,  bool is_superclass);
@@ -353,6 +353,7 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
 
   if (stub != nullptr && (PrintStubCode ||
                        Forte::is_enabled() ||
+                       LINUX_ONLY(WritePerfMapContinuously ||)
                        JvmtiExport::should_post_dynamic_code_generated())) {
     char stub_id[256];
     assert(strlen(name1) + strlen(name2) < sizeof(stub_id), "");
@@ -374,6 +375,11 @@ void RuntimeBlob::trace_new_stub(RuntimeBlob* stub, const char* name1, const cha
     if (Forte::is_enabled()) {
       Forte::register_stub(stub_id, stub->code_begin(), stub->code_end());
     }
+#ifdef LINUX
+    if (WritePerfMapContinuously) {
+      CodeCache::append_to_perf_map(stub, stub_id);
+    }
+#endif
 
     if (JvmtiExport::should_post_dynamic_code_generated()) {
       const char* stub_name = name2;
@@ -167,6 +167,7 @@ class CodeBlob_sizes {
 
 address CodeCache::_low_bound = nullptr;
 address CodeCache::_high_bound = nullptr;
+LINUX_ONLY(int CodeCache::_perf_map_fd = -1;)
 volatile int CodeCache::_number_of_nmethods_with_dependencies = 0;
 ExceptionCache* volatile CodeCache::_exception_cache_purge_list = nullptr;
 
@@ -1143,6 +1144,19 @@ void CodeCache::initialize() {
   // This is used on Windows 64 bit platforms to register
   // Structured Exception Handlers for our generated code.
   os::register_code_area((char*)low_bound(), (char*)high_bound());
+
+#ifdef LINUX
+  if (WritePerfMapContinuously) {
+    char fname[JVM_MAXPATHLEN];
+    if (Arguments::copy_expand_pid(DEFAULT_PERFMAP_FILENAME, strlen(DEFAULT_PERFMAP_FILENAME),
+                                   fname, JVM_MAXPATHLEN)) {
+      _perf_map_fd = os::open(fname, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0666);
+    }
+    if (_perf_map_fd < 0) {
+      warning("Failed to create perf map file, WritePerfMapContinuously is disabled");
+    }
+  }
+#endif // LINUX
 }
 
 void codeCache_init() {
@@ -1234,9 +1248,11 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, KlassD
   // nmethod::check_all_dependencies works only correctly, if no safepoint
   // can happen
   NoSafepointVerifier nsv;
+  ResourceMark rm;
+  CheckedNMethods checked;
   for (DepChange::ContextStream str(changes, nsv); str.next(); ) {
     InstanceKlass* d = str.klass();
-    d->mark_dependent_nmethods(deopt_scope, changes);
+    d->mark_dependent_nmethods(deopt_scope, changes, &checked);
   }
 
 #ifndef PRODUCT
@@ -1823,6 +1839,57 @@ void CodeCache::print_layout(outputStream* st) {
   print_summary(st, true);
 }
 
+// Write a CompileCommand file that lowers the compile thresholds of all
+// methods that currently have in-use tier 4 code. A JVM started with
+// -XX:CompileCommandFile=<filename> spends much less time profiling these
+// methods before compiling them with the optimizing compiler again.
+void CodeCache::write_hot_methods(const char* filename, outputStream* st) {
+  fileStream fs(filename, "w");
+  if (!fs.is_open()) {
+    st->print_cr("Warning: Failed to create %s for hot methods", filename);
+    return;
+  }
+  fs.print_cr("# Methods compiled at tier %d in process %d", CompLevel_full_optimization, os::current_process_id());
+  fs.print_cr("# Use with -XX:CompileCommandFile=%s", filename);
+  fs.print_cr("quiet");
+
+  // Only collect the names under the CodeCache_lock, and write them out
+  // once it is released, so that file I/O does not hold up code
+  // installation and unloading.
+  ResourceMark rm;
+  GrowableArray<const char*> names;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    NMethodIterator iter(NMethodIterator::not_unloading);
+    while (iter.next()) {
+      nmethod* nm = iter.method();
+      if (!nm->is_in_use() || nm->comp_level() != CompLevel_full_optimization) {
+        continue;
+      }
+      Method* m = nm->method();
+      // Hidden classes get different names in every run.
+      if (m->method_holder()->is_hidden()) {
+        continue;
+      }
+      // An OSR nmethod only needs its own entry if there is no normal one.
+      if (nm->is_osr_method() && m->code() != nullptr && m->code()->comp_level() == CompLevel_full_optimization) {
+        continue;
+      }
+      stringStream ss;
+      ss.print("%s.%s%s",
+               m->method_holder()->name()->as_C_string(),
+               m->name()->as_C_string(),
+               m->signature()->as_C_string());
+      names.append(ss.as_string());
+    }
+  }
+
+  for (int i = 0; i < names.length(); i++) {
+    fs.print_cr("CompileThresholdScaling,%s,0.1", names.at(i));
+  }
+  st->print_cr("Wrote %d hot methods to %s", names.length(), filename);
+}
+
 void CodeCache::log_state(outputStream* st) {
   st->print(" total_blobs='" UINT32_FORMAT "' nmethods='" UINT32_FORMAT "'"
             " adapters='" UINT32_FORMAT "' free_code_cache='%zu'",
@@ -1870,6 +1937,36 @@ void CodeCache::write_perf_map(const char* filename, outputStream* st) {
                 method_name, jvmci_name ? " jvmci_name=" : "", jvmci_name ? jvmci_name : "");
   }
 }
+
+// Each entry is written with a single write() to a file opened with O_APPEND,
+// so threads installing code concurrently need no lock. perf has no notion of
+// unloaded code; an address range that is reused shows up again with the new
+// name further down in the file.
+void CodeCache::append_to_perf_map(CodeBlob* cb, const char* name) {
+  if (_perf_map_fd < 0) {
+    return;
+  }
+  ResourceMark rm;
+  const char* jvmci_name = nullptr;
+  if (name == nullptr) {
+    assert(cb->is_nmethod(), "only nmethods are named here");
+    nmethod* nm = cb->as_nmethod();
+    name = nm->method()->external_name();
+#if INCLUDE_JVMCI
+    jvmci_name = nm->jvmci_name();
+#endif
+  }
+  char line[1024];
+  int len = jio_snprintf(line, sizeof(line), INTPTR_FORMAT " " INTPTR_FORMAT " %s%s%s\n",
+                         (intptr_t)cb->code_begin(), (intptr_t)cb->code_size(),
+                         name, jvmci_name ? " jvmci_name=" : "", jvmci_name ? jvmci_name : "");
+  if (len < 0) {
+    // Truncated, terminate the line anyway.
+    len = sizeof(line) - 1;
+    line[len - 1] = '\n';
+  }
+  os::write(_perf_map_fd, line, (size_t)len);
+}
 #endif // LINUX
 
 //---<  BEGIN  >--- CodeHeap State Analytics.
@@ -112,6 +112,8 @@ class CodeCache : AllStatic {
 
   static ExceptionCache* volatile _exception_cache_purge_list;
 
+  LINUX_ONLY(static int    _perf_map_fd;)             // Append-only perf map file for WritePerfMapContinuously
+
   // CodeHeap management
   static void initialize_heaps();                             // Initializes the CodeHeaps
 
@@ -228,12 +230,15 @@ class CodeCache : AllStatic {
   static void print_summary(outputStream* st, bool detailed = true); // Prints a summary of the code cache usage
   static void log_state(outputStream* st);
   LINUX_ONLY(static void write_perf_map(const char* filename, outputStream* st);) // Prints warnings and error messages to outputStream
+  // Appends one entry to the continuous perf map; name is null for nmethods
+  LINUX_ONLY(static void append_to_perf_map(CodeBlob* cb, const char* name);)
   static const char* get_code_heap_name(CodeBlobType code_blob_type)  { return (heap_available(code_blob_type) ? get_code_heap(code_blob_type)->name() : "Unused"); }
   static void report_codemem_full(CodeBlobType code_blob_type, bool print);
 
   // Dcmd (Diagnostic commands)
   static void print_codelist(outputStream* st);
   static void print_layout(outputStream* st);
+  static void write_hot_methods(const char* filename, outputStream* st); // Prints warnings and error messages to outputStream
 
   // The full limits of the codeCache
   static address low_bound()                          { return _low_bound; }
@@ -30,6 +30,7 @@
 #include "runtime/handles.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/safepoint.hpp"
+#include "utilities/resourceHash.hpp"
 
 class nmethod;
 class DeoptimizationScope;
@@ -60,6 +61,11 @@ class nmethodBucket: public CHeapObj<mtClass> {
   nmethod* get_nmethod()                     { return _nmethod; }
 };
 
+// nmethods that have already been checked against one DepChange. The same
+// nmethod is often registered with several contexts in the hierarchy of a
+// new class, and check_dependency_on() looks at all of its dependencies.
+class CheckedNMethods : public ResourceHashtable<nmethod*, bool> {};
+
 //
 // Utility class to manipulate nmethod dependency context.
 // Dependency context can be attached either to an InstanceKlass (_dep_context field)
@@ -110,7 +116,7 @@ class DependencyContext : public StackObj {
 
   static void init();
 
-  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes);
+  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, DepChange& changes, CheckedNMethods* checked = nullptr);
   void add_dependent_nmethod(nmethod* nm);
   void remove_all_dependents();
   void clean_unloading_dependents();
@@ -185,14 +185,40 @@ void ImplicitExceptionTable::append( uint exec_off, uint cont_off ) {
   _len = l+1;
 };
 
+// The table in an nmethod is sorted by exception offset, see copy_bytes_to().
 uint ImplicitExceptionTable::continuation_offset( uint exec_off ) const {
-  uint l = len();
-  for( uint i=0; i<l; i++ )
-    if( *adr(i) == exec_off )
-      return *(adr(i)+1);
+  uint lo = 0;
+  uint hi = len();
+  while (lo < hi) {
+    uint mid = lo + (hi - lo) / 2;
+    if (*adr(mid) < exec_off) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < len() && *adr(lo) == exec_off) {
+    return *(adr(lo)+1);
+  }
   return 0;                     // Failed to find any exception offset
 }
 
+// The compilers append the entries mostly in code order, so this
+// insertion sort only moves the few that are out of place.
+void ImplicitExceptionTable::sort() {
+  for (uint i = 1; i < len(); i++) {
+    implicit_null_entry exec_off = *adr(i);
+    implicit_null_entry cont_off = *(adr(i)+1);
+    uint j = i;
+    for (; j > 0 && *adr(j - 1) > exec_off; j--) {
+      *adr(j)     = *adr(j - 1);
+      *(adr(j)+1) = *(adr(j - 1)+1);
+    }
+    *adr(j)     = exec_off;
+    *(adr(j)+1) = cont_off;
+  }
+}
+
 void ImplicitExceptionTable::print(address base) const {
   const uint n = len();
   if (n > 0) {
@@ -236,6 +262,7 @@ void ImplicitExceptionTable::copy_to( nmethod* nm ) {
 void ImplicitExceptionTable::copy_bytes_to(address addr, int size) {
   assert(size_in_bytes() <= size, "size of space allocated in nmethod incorrect");
   if (len() != 0) {
+    sort();
     implicit_null_entry* nmdata = (implicit_null_entry*)addr;
     // store the length in the first uint
     nmdata[0] = _len;
@@ -25,6 +25,7 @@
 #include "asm/assembler.inline.hpp"
 #include "code/codeCache.hpp"
 #include "code/compiledIC.hpp"
+#include "code/debugInfoRec.hpp"
 #include "code/dependencies.hpp"
 #include "code/nativeInst.hpp"
 #include "code/nmethod.inline.hpp"
@@ -51,10 +52,12 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
+#include "oops/cpCache.inline.hpp"
 #include "oops/klass.inline.hpp"
 #include "oops/method.inline.hpp"
 #include "oops/methodData.hpp"
 #include "oops/oop.inline.hpp"
+#include "oops/resolvedMethodEntry.hpp"
 #include "oops/weakHandle.inline.hpp"
 #include "prims/jvmtiImpl.hpp"
 #include "prims/jvmtiThreadState.hpp"
@@ -74,6 +77,7 @@
 #include "runtime/signature.hpp"
 #include "runtime/threadWXSetters.inline.hpp"
 #include "runtime/vmThread.hpp"
+#include "runtime/vm_version.hpp"
 #include "utilities/align.hpp"
 #include "utilities/copy.hpp"
 #include "utilities/dtrace.hpp"
@@ -398,6 +402,49 @@ static inline bool match_desc(PcDesc* pc, int pc_offset, bool approximate) {
   }
 }
 
+PcDescContainer::PcDescContainer(PcDesc* initial_pc_desc, PcDesc* end) : _pc_offsets(nullptr), _pc_offsets_length(0) {
+  _pc_desc_cache.init_to(initial_pc_desc);
+  int length = pointer_delta_as_int(end, initial_pc_desc);
+  if (length >= min_indexed_pc_descs) {
+    _pc_offsets = NEW_C_HEAP_ARRAY(int, length, mtCode);
+    for (int i = 0; i < length; i++) {
+      _pc_offsets[i] = initial_pc_desc[i].pc_offset();
+    }
+    _pc_offsets_length = length;
+  }
+}
+
+PcDescContainer::~PcDescContainer() {
+  FREE_C_HEAP_ARRAY(int, _pc_offsets);
+}
+
+// Returns the first PcDesc whose pc offset is not below pc_offset, which
+// is the match if there is one at all.
+PcDesc* PcDescContainer::find_indexed_pc_desc(int pc_offset, PcDesc* lower_incl) {
+  const int* offsets = _pc_offsets;
+  // Invariant: offsets[lo] < pc_offset <= offsets[hi]. The first entry is
+  // the initial sentinel, the last one a copy of the final sentinel.
+  int lo = 0;
+  int hi = _pc_offsets_length - 1;
+  if (offsets[hi] < pc_offset) {
+    return nullptr;
+  }
+  while (hi - lo > 16) {
+    int mid = lo + (hi - lo) / 2;
+    if (offsets[mid] < pc_offset) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  // Count the remaining smaller offsets without branching on them.
+  int index = lo + 1;
+  for (int i = lo + 1; i < hi; i++) {
+    index += offsets[i] < pc_offset ? 1 : 0;
+  }
+  return lower_incl + index;
+}
+
 void PcDescCache::init_to(PcDesc* initial_pc_desc) {
   NOT_PRODUCT(++pc_nmethod_stats.pc_desc_init);
   // initialize the cache by filling it with benign (non-null) values
@@ -769,6 +816,58 @@ void nmethod::clear_inline_caches() {
   }
 }
 
+// A static or private self call resolves to the verified entry of the
+// caller's own code as soon as it is first taken, so do that resolution
+// up front. Only calls in scopes of this method whose constant pool entry
+// is already resolved to it are bound; the call sites keep their
+// relocations, so they are re-resolved like any other direct call once
+// this nmethod is made not entrant.
+void nmethod::bind_self_calls() {
+  assert(is_not_installed() && !is_osr_method(), "must not be reachable yet");
+  Method* m = method();
+  if (!VM_Version::supports_fast_class_init_checks() && m->needs_clinit_barrier()) {
+    // Keep going through resolution, see SharedRuntime::resolve_helper.
+    return;
+  }
+
+  ResourceMark rm;
+  methodHandle mh(Thread::current(), m);
+  CompiledICLocker ml(this);
+  RelocIterator iter(this, oops_reloc_begin());
+  while (iter.next()) {
+    if (iter.type() != relocInfo::static_call_type &&
+        iter.type() != relocInfo::opt_virtual_call_type) {
+      continue;
+    }
+    CompiledDirectCall* cdc = CompiledDirectCall::at(iter.reloc());
+    if (!cdc->is_clean()) {
+      continue;
+    }
+    Method* target = attached_method(iter.addr());
+    if (target == nullptr) {
+      PcDesc* pd = pc_desc_at(cdc->end_of_call());
+      if (pd == nullptr || pd->scope_decode_offset() == DebugInformationRecorder::serialized_null) {
+        continue;
+      }
+      ScopeDesc* sd = scope_desc_at(cdc->end_of_call());
+      if (sd->method() != m || sd->bci() < 0) {
+        continue;
+      }
+      Bytecode_invoke inv(mh, sd->bci());
+      if (!inv.is_invokestatic() && !inv.is_invokespecial()) {
+        continue;
+      }
+      ResolvedMethodEntry* entry = m->constants()->cache()->resolved_method_entry_at(inv.index());
+      if (entry->is_resolved(inv.invoke_code())) {
+        target = entry->method();
+      }
+    }
+    if (target == m) {
+      nativeCall_at(iter.addr())->set_destination_mt_safe(verified_entry_point());
+    }
+  }
+}
+
 #ifdef ASSERT
 // Check class_loader is alive for this bit of metadata.
 class CheckClass : public MetadataClosure {
@@ -1536,7 +1635,7 @@ nmethod::nmethod(
     debug_info->copy_to(this);
 
     // Create cache after PcDesc data is copied - it will be used to initialize cache
-    _pc_desc_container = new PcDescContainer(scopes_pcs_begin());
+    _pc_desc_container = new PcDescContainer(scopes_pcs_begin(), scopes_pcs_end());
 
 #if INCLUDE_JVMCI
     if (compiler->is_jvmci()) {
@@ -2217,6 +2316,12 @@ void nmethod::post_compiled_method(CompileTask* task) {
   // JVMTI -- compiled method notification (must be done outside lock)
   post_compiled_method_load_event();
 
+#ifdef LINUX
+  if (WritePerfMapContinuously) {
+    CodeCache::append_to_perf_map(this, nullptr);
+  }
+#endif
+
   if (CompilationLog::log() != nullptr) {
     CompilationLog::log()->log_nmethod(JavaThread::current(), this);
   }
@@ -2789,6 +2894,20 @@ PcDesc* PcDescContainer::find_pc_desc_internal(address pc, bool approximate, add
     return res;
   }
 
+  if (_pc_offsets != nullptr) {
+    NOT_PRODUCT(++pc_nmethod_stats.pc_desc_searches);
+    res = find_indexed_pc_desc(pc_offset, lower_incl);
+    if (res != nullptr && match_desc(res, pc_offset, approximate)) {
+      assert(res == linear_search(pc_offset, approximate, lower_incl, upper_incl), "search mismatch");
+      if (!Thread::current_in_asgct()) {
+        _pc_desc_cache.add_pc_desc(res);
+      }
+      return res;
+    }
+    assert(nullptr == linear_search(pc_offset, approximate, lower_incl, upper_incl), "search mismatch");
+    return nullptr;
+  }
+
   // Fallback algorithm: quasi-linear search for the PcDesc
   // Find the last pc_offset less than the given offset.
   // The successor must be the required match, if there is a match at all.
@@ -109,9 +109,19 @@ class PcDescCache {
 
 class PcDescContainer : public CHeapObj<mtCode> {
 private:
+  enum { min_indexed_pc_descs = 64 };
+
   PcDescCache _pc_desc_cache;
+  // The pc offsets of the PcDescs of a large nmethod, packed so that the
+  // search after a cache miss reads 16 offsets per cache line instead of
+  // 4 PcDescs. Null for nmethods with fewer than min_indexed_pc_descs.
+  int*        _pc_offsets;
+  int         _pc_offsets_length;
+
+  PcDesc* find_indexed_pc_desc(int pc_offset, PcDesc* lower_incl);
 public:
-  PcDescContainer(PcDesc* initial_pc_desc) { _pc_desc_cache.init_to(initial_pc_desc); }
+  PcDescContainer(PcDesc* initial_pc_desc, PcDesc* end);
+  ~PcDescContainer();
 
   PcDesc* find_pc_desc_internal(address pc, bool approximate, address code_begin,
                                 PcDesc* lower, PcDesc* upper);
@@ -855,6 +865,10 @@ class nmethod : public CodeBlob {
 
   void clear_inline_caches();
 
+  // Bind the direct calls of this method to itself to its own verified
+  // entry point. Done once, before the nmethod is made in use.
+  void bind_self_calls();
+
   // Execute nmethod barrier code, as if entering through nmethod call.
   void run_nmethod_entry_barrier();
 
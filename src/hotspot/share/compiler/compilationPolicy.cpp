@@ -28,6 +28,7 @@
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/method.inline.hpp"
 #include "oops/methodData.hpp"
@@ -42,6 +43,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "runtime/vframe.inline.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -806,6 +808,19 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
 
   methodHandle max_method_h(THREAD, max_method);
 
+  if (max_task != nullptr && is_promotable_in_queue(max_task, max_method_h)) {
+    // The method collected enough profile in the interpreter while its tier 3
+    // task was queued. Tier 3 code would only profile it again, so drop the task.
+    // The method stays at level 0, and its next event goes straight to tier 4,
+    // see transition_from_none().
+    if (PrintTieredEvents) {
+      print_event(REMOVE_FROM_QUEUE, max_method, max_method, max_task->osr_bci(), (CompLevel)max_task->comp_level());
+    }
+    compile_queue->remove_and_mark_stale(max_task);
+    max_method->clear_queued_for_compilation();
+    return nullptr;
+  }
+
   if (max_task != nullptr && max_task->comp_level() == CompLevel_full_profile && TieredStopAtLevel > CompLevel_full_profile &&
       max_method != nullptr && is_method_profiled(max_method_h) && !Arguments::is_compiler_only()) {
     max_task->set_comp_level(CompLevel_limited_profile);
@@ -826,6 +841,19 @@ CompileTask* CompilationPolicy::select_task(CompileQueue* compile_queue, JavaThr
   return max_task;
 }
 
+// Can the queued tier 3 task be replaced by a tier 4 compilation?
+bool CompilationPolicy::is_promotable_in_queue(CompileTask* task, const methodHandle& method) {
+  return TieredPromoteQueuedTasks &&
+         task->comp_level() == CompLevel_full_profile &&
+         task->osr_bci() == InvocationEntryBci &&
+         task->can_become_stale() && !task->is_blocking() &&
+         TieredStopAtLevel > CompLevel_full_profile &&
+         !CompilationModeFlag::disable_intermediate() &&
+         !MethodTrainingData::have_data() &&
+         comp_level(method()) == CompLevel_none &&
+         transition_from_full_profile<CallPredicate>(method, CompLevel_full_profile) == CompLevel_full_optimization;
+}
+
 void CompilationPolicy::reprofile(ScopeDesc* trap_scope, bool is_osr) {
   for (ScopeDesc* sd = trap_scope;; sd = sd->sender()) {
     if (PrintTieredEvents) {
@@ -1360,7 +1388,10 @@ CompLevel CompilationPolicy::transition_from_none(const methodHandle& method, Co
     // we introduce a feedback on the C2 queue size. If the C2 queue is sufficiently long
     // we choose to compile a limited profiled version and then recompile with full profiling
     // when the load on C2 goes down.
-    if (delay_profiling || (!disable_feedback && CompileBroker::queue_size(CompLevel_full_optimization) > Tier3DelayOn * compiler_count(CompLevel_full_optimization))) {
+    // Directly recursive methods also start with limited profiling, because every
+    // frame of a deep recursion updates the profile in fully profiled code.
+    if (delay_profiling || delay_recursive_profiling(method) ||
+        (!disable_feedback && CompileBroker::queue_size(CompLevel_full_optimization) > Tier3DelayOn * compiler_count(CompLevel_full_optimization))) {
       next_level = CompLevel_limited_profile;
     } else {
       next_level = CompLevel_full_profile;
@@ -1369,6 +1400,10 @@ CompLevel CompilationPolicy::transition_from_none(const methodHandle& method, Co
   return next_level;
 }
 
+bool CompilationPolicy::delay_recursive_profiling(const methodHandle& method) {
+  return Tier2RecursiveProfileDelayFactor > 1.0 && method->is_self_recursive();
+}
+
 template<typename Predicate>
 CompLevel CompilationPolicy::transition_from_full_profile(const methodHandle& method, CompLevel cur_level) {
   precond(cur_level == CompLevel_full_profile);
@@ -1395,6 +1430,9 @@ CompLevel CompilationPolicy::transition_from_limited_profile(const methodHandle&
   int i = method->invocation_count();
   int b = method->backedge_count();
   double scale = delay_profiling ? Tier2ProfileDelayFactor : 1.0;
+  if (!delay_profiling && delay_recursive_profiling(method)) {
+    scale = Tier2RecursiveProfileDelayFactor;
+  }
   MethodData* mdo = method->method_data();
   if (mdo != nullptr) {
     if (mdo->would_profile()) {
@@ -1461,12 +1499,65 @@ CompLevel CompilationPolicy::loop_event(const methodHandle& method, CompLevel cu
   return next_level;
 }
 
+// The bounded walk in sample_recursion_depth only tells recursive methods
+// apart. Measuring the real depth takes a walk over the whole recursion, so
+// it is only done for events that the throttler lets through.
+static void post_deep_recursion_event(const methodHandle& mh, JavaThread* thread) {
+  EventDeepRecursion event;
+  if (!event.should_commit()) {
+    return;
+  }
+  int depth = 0;
+  for (vframeStream vfst(thread); !vfst.at_end() && depth < DeepRecursionEventDepth; vfst.next()) {
+    if (vfst.method() == mh()) {
+      depth++;
+    }
+  }
+  if (depth < DeepRecursionEventDepth) {
+    return;
+  }
+  event.set_method(mh());
+  event.set_depth(depth);
+  event.set_stackSize(pointer_delta(thread->stack_base(), (address)thread->last_Java_sp(), 1));
+  event.commit();
+}
+
+// Sample the recursion depth of a method whose invocation counter overflowed.
+// The method's own activation is on top of the stack, so the walk only needs
+// to look for further activations below it. Overflows are rare enough that
+// a bounded stack walk is cheap compared to the interpretation it replaces.
+void CompilationPolicy::sample_recursion_depth(const methodHandle& mh, JavaThread* THREAD) {
+  MethodData* mdo = mh->method_data();
+  if (mdo == nullptr || !THREAD->has_last_Java_frame()) {
+    return;
+  }
+  const int max_frames = 100;
+  int depth = 0;
+  int frames = 0;
+  for (vframeStream vfst(THREAD); !vfst.at_end() && frames < max_frames; vfst.next(), frames++) {
+    if (vfst.method() == mh()) {
+      if (++depth == MethodData::recursion_depth_buckets) {
+        break;
+      }
+    }
+  }
+  if (depth > 0) {
+    mdo->record_recursion_depth(depth);
+  }
+  if (depth == MethodData::recursion_depth_buckets) {
+    post_deep_recursion_event(mh, THREAD);
+  }
+}
+
 // Handle the invocation event.
 void CompilationPolicy::method_invocation_event(const methodHandle& mh, const methodHandle& imh,
                                                       CompLevel level, nmethod* nm, TRAPS) {
   if (should_create_mdo(mh, level)) {
     create_mdo(mh, THREAD);
   }
+  if (ProfileRecursionDepth) {
+    sample_recursion_depth(mh, THREAD);
+  }
   CompLevel next_level = call_event(mh, level, THREAD);
   if (next_level != level) {
     if (is_compilation_enabled() && !CompileBroker::compilation_is_in_queue(mh)) {
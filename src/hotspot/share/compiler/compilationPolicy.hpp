@@ -272,6 +272,8 @@ class CompilationPolicy : AllStatic {
   static CompLevel transition_from_limited_profile(const methodHandle& method, CompLevel cur_level, bool delay_profiling, bool disable_feedback);
   template<typename Predicate>
   static CompLevel transition_from_full_profile(const methodHandle& method, CompLevel cur_level);
+  // Should the full profiling of this directly recursive method be delayed?
+  static bool delay_recursive_profiling(const methodHandle& method);
   template<typename Predicate>
   static CompLevel standard_transition(const methodHandle& method, CompLevel cur_level, bool delayprof, bool disable_feedback);
 
@@ -311,8 +313,12 @@ class CompilationPolicy : AllStatic {
   inline static bool should_create_mdo(const methodHandle& method, CompLevel cur_level);
   // Create MDO if necessary.
   static void create_mdo(const methodHandle& mh, JavaThread* THREAD);
+  // Record how many activations of the method are on the current stack.
+  static void sample_recursion_depth(const methodHandle& mh, JavaThread* THREAD);
   // Is method profiled enough?
   static bool is_method_profiled(const methodHandle& method);
+  // Can a queued tier 3 task give way to a tier 4 compilation (see select_task())?
+  static bool is_promotable_in_queue(CompileTask* task, const methodHandle& method);
 
   static void set_c1_count(int x) { _c1_count = x;    }
   static void set_c2_count(int x) { _c2_count = x;    }
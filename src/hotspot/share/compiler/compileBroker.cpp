@@ -324,6 +324,7 @@ void CompileQueue::add(CompileTask* task) {
     assert(_first == nullptr, "queue is empty");
     _first = task;
     _last = task;
+    Atomic::store(&_first_time_queued, task->time_queued());
   } else {
     // Append the task to the queue.
     assert(_last->next() == nullptr, "not last");
@@ -383,6 +384,7 @@ void CompileQueue::delete_all() {
   }
   _first = nullptr;
   _last = nullptr;
+  Atomic::store(&_first_time_queued, (jlong)0);
 
   // Wake up all blocking task waiters to deal with remaining blocking
   // tasks. This is not a performance sensitive path, so we do this
@@ -506,6 +508,15 @@ void CompileQueue::remove(CompileTask* task) {
   }
   --_size;
   ++_total_removed;
+  Atomic::store(&_first_time_queued, _first != nullptr ? _first->time_queued() : (jlong)0);
+}
+
+double CompileQueue::oldest_wait_ms() const {
+  jlong first_time_queued = Atomic::load(&_first_time_queued);
+  if (first_time_queued == 0) {
+    return 0;
+  }
+  return TimeHelper::counter_to_millis(os::elapsed_counter() - first_time_queued);
 }
 
 void CompileQueue::remove_and_mark_stale(CompileTask* task) {
@@ -1037,6 +1048,19 @@ void CompileBroker::init_training_replay() {
   }
 }
 
+// The number of threads the queue length asks for. If tasks have waited longer than
+// CompilerThreadQueueLatencyTarget, ask for one more thread than we have, as long
+// as all compiler threads together stay within the processors the VM may use now.
+static int wanted_compiler_threads(CompileQueue* queue, int current, int tasks_per_thread, int all_threads) {
+  int wanted = queue->size() / tasks_per_thread;
+  if (CompilerThreadQueueLatencyTarget > 0 && wanted <= current &&
+      queue->oldest_wait_ms() > CompilerThreadQueueLatencyTarget &&
+      all_threads < os::active_processor_count()) {
+    wanted = current + 1;
+  }
+  return wanted;
+}
+
 void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
 
   int old_c2_count = 0, new_c2_count = 0, old_c1_count = 0, new_c1_count = 0;
@@ -1046,11 +1070,17 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   // Numbers may change concurrently, so we read them again after we have the lock.
   if (_c2_compile_queue != nullptr) {
     old_c2_count = get_c2_thread_count();
-    new_c2_count = MIN2(_c2_count, _c2_compile_queue->size() / c2_tasks_per_thread);
   }
   if (_c1_compile_queue != nullptr) {
     old_c1_count = get_c1_thread_count();
-    new_c1_count = MIN2(_c1_count, _c1_compile_queue->size() / c1_tasks_per_thread);
+  }
+  if (_c2_compile_queue != nullptr) {
+    new_c2_count = MIN2(_c2_count, wanted_compiler_threads(_c2_compile_queue, old_c2_count, c2_tasks_per_thread,
+                                                           old_c1_count + old_c2_count));
+  }
+  if (_c1_compile_queue != nullptr) {
+    new_c1_count = MIN2(_c1_count, wanted_compiler_threads(_c1_compile_queue, old_c1_count, c1_tasks_per_thread,
+                                                           old_c1_count + old_c2_count));
   }
   if (new_c2_count <= old_c2_count && new_c1_count <= old_c1_count) return;
 
@@ -1066,7 +1096,8 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   if (_c2_compile_queue != nullptr) {
     old_c2_count = get_c2_thread_count();
     new_c2_count = MIN4(_c2_count,
-        _c2_compile_queue->size() / c2_tasks_per_thread,
+        wanted_compiler_threads(_c2_compile_queue, old_c2_count, c2_tasks_per_thread,
+                                old_c1_count + old_c2_count),
         (int)(free_memory / (200*M)),
         (int)(available_cc_np / (128*K)));
 
@@ -1127,7 +1158,8 @@ void CompileBroker::possibly_add_compiler_threads(JavaThread* THREAD) {
   if (_c1_compile_queue != nullptr) {
     old_c1_count = get_c1_thread_count();
     new_c1_count = MIN4(_c1_count,
-        _c1_compile_queue->size() / c1_tasks_per_thread,
+        wanted_compiler_threads(_c1_compile_queue, old_c1_count, c1_tasks_per_thread,
+                                old_c1_count + (_c2_compile_queue != nullptr ? get_c2_thread_count() : 0)),
         (int)(free_memory / (100*M)),
         (int)(available_cc_p / (128*K)));
 
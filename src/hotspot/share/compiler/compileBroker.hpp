@@ -104,6 +104,9 @@ class CompileQueue : public CHeapObj<mtCompiler> {
   CompileTask* _first_stale;
 
   volatile int _size;
+  // os::elapsed_counter() when _first was enqueued, 0 if the queue is empty.
+  // The queue is in enqueue order, so this is the longest wait of any task.
+  volatile jlong _first_time_queued;
   int _peak_size;
   uint _total_added;
   uint _total_removed;
@@ -115,6 +118,7 @@ class CompileQueue : public CHeapObj<mtCompiler> {
     _first = nullptr;
     _last = nullptr;
     _size = 0;
+    _first_time_queued = 0;
     _total_added = 0;
     _total_removed = 0;
     _peak_size = 0;
@@ -133,6 +137,8 @@ class CompileQueue : public CHeapObj<mtCompiler> {
 
   bool         is_empty() const                  { return _first == nullptr; }
   int          size()     const                  { return _size;          }
+  // How long has the oldest task been waiting, read without the lock
+  double       oldest_wait_ms() const;
 
   int         get_peak_size()     const          { return _peak_size; }
   uint        get_total_added()   const          { return _total_added; }
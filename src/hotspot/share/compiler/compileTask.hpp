@@ -165,6 +165,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
 
   void         mark_complete()                   { _is_complete = true; }
   void         mark_success()                    { _is_success = true; }
+  jlong        time_queued() const               { return _time_queued; }
   void         mark_started(jlong time)          { _time_started = time; }
 
   int          comp_level()                      { return _comp_level;}
@@ -25,6 +25,7 @@
 #ifndef SHARE_COMPILER_COMPILERTHREAD_HPP
 #define SHARE_COMPILER_COMPILERTHREAD_HPP
 
+#include "memory/arena.hpp"
 #include "runtime/javaThread.hpp"
 
 class AbstractCompiler;
@@ -56,6 +57,7 @@ class CompilerThread : public JavaThread {
   TimeStamp             _idle_time;
 
   ArenaStatCounter*     _arena_stat;
+  RetainedChunks        _retained_chunks;
 
  public:
 
@@ -86,6 +88,7 @@ class CompilerThread : public JavaThread {
   CompilerCounters* counters() const             { return _counters; }
   ArenaStatCounter* arena_stat() const           { return _arena_stat; }
   void set_arenastat(ArenaStatCounter* v)        { _arena_stat = v; }
+  RetainedChunks* retained_chunks()              { return &_retained_chunks; }
 
   // Get/set the thread's compilation environment.
   ciEnv*        env()                            { return _env; }
@@ -94,6 +94,11 @@
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(size_t, CompilerThreadChunkCacheSize, 4*M,                        \
+          "Bytes of large arena chunks a compiler thread keeps for its "    \
+          "next compilations instead of freeing them. 0 disables it")       \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(intx, CICrashAt, -1,                                              \
           "id of compilation to trigger assert in compiler thread for "     \
           "the purpose of testing, e.g. generation of replay data")         \
@@ -249,6 +254,11 @@
           "given timeout in milliseconds")                                  \
           range(0, max_intx)                                                \
                                                                             \
+  product(bool, TieredPromoteQueuedTasks, true, DIAGNOSTIC,                 \
+          "Drop a queued tier 3 compile task if the method is already "     \
+          "profiled enough for tier 4, so that its next event submits "     \
+          "a tier 4 compilation instead")                                   \
+                                                                            \
   product(intx, TieredStopAtLevel, 4,                                       \
           "Stop at given compilation level")                                \
           range(0, 4)                                                       \
@@ -278,6 +288,11 @@
   product(double, Tier2ProfileDelayFactor, 250.0, DIAGNOSTIC,               \
           "Delay profiling of methods that were observed to be lukewarm")   \
                                                                             \
+  product(double, Tier2RecursiveProfileDelayFactor, 10.0, DIAGNOSTIC,       \
+          "Compile directly recursive methods at tier 2 first and keep "    \
+          "them there until their counters reach this multiple of the "     \
+          "tier 3 thresholds. Values up to 1 disable this")                 \
+                                                                            \
   product(bool, SkipTier2IfPossible, false, DIAGNOSTIC,                     \
           "Compile at tier 4 instead of tier 2 in training replay "         \
           "mode if posssible")                                              \
@@ -293,6 +308,10 @@
   product(bool, PrintTieredEvents, false,                                   \
           "Print tiered events notifications")                              \
                                                                             \
+  product(bool, ProfileRecursionDepth, false, DIAGNOSTIC,                   \
+          "Sample the recursion depth of profiled methods on invocation "   \
+          "counter overflow")                                               \
+                                                                            \
   product_pd(intx, OnStackReplacePercentage,                                \
           "NON_TIERED number of method invocations/branches (expressed as " \
           "% of CompileThreshold) before (re-)compiling OSR code")          \
@@ -23,20 +23,34 @@
  *
  */
 
+#include "classfile/classLoaderDataGraph.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
+#include "oops/compressedOops.inline.hpp"
+#include "oops/instanceKlass.hpp"
+#include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/threads.hpp"
+#include "runtime/vmOperation.hpp"
+#include "runtime/vmThread.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/ostream.hpp"
 
 jint EpsilonHeap::initialize() {
@@ -298,6 +312,157 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+// Counts the references into [checkpoint, top), the range to discard.
+class EpsilonCheckpointEscapeClosure : public BasicOopIterateClosure {
+  HeapWord* const _checkpoint;
+  HeapWord* const _top;
+  size_t _escapes;
+
+  template <typename T>
+  void do_oop_work(T* p) {
+    T heap_oop = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(heap_oop)) {
+      if (is_discarded(CompressedOops::decode_not_null(heap_oop))) {
+        _escapes++;
+      }
+    }
+  }
+
+public:
+  EpsilonCheckpointEscapeClosure(HeapWord* checkpoint, HeapWord* top) :
+    _checkpoint(checkpoint), _top(top), _escapes(0) {}
+
+  // Referents are checked separately, see reset_to_checkpoint().
+  ReferenceIterationMode reference_iteration_mode() override { return DO_FIELDS_EXCEPT_REFERENT; }
+
+  void do_oop(oop* p)       override { do_oop_work(p); }
+  void do_oop(narrowOop* p) override { do_oop_work(p); }
+
+  bool is_discarded(oop obj) const {
+    HeapWord* addr = cast_from_oop<HeapWord*>(obj);
+    return addr >= _checkpoint && addr < _top;
+  }
+
+  void count_escape() { _escapes++; }
+  size_t escapes() const { return _escapes; }
+};
+
+class EpsilonIsBelowCheckpointClosure : public BoolObjectClosure {
+  HeapWord* const _checkpoint;
+
+public:
+  EpsilonIsBelowCheckpointClosure(HeapWord* checkpoint) : _checkpoint(checkpoint) {}
+
+  bool do_object_b(oop obj) override {
+    return cast_from_oop<HeapWord*>(obj) < _checkpoint;
+  }
+};
+
+class VM_EpsilonCheckpoint : public VM_Operation {
+  const bool _reset;
+  outputStream* const _st;
+
+public:
+  VM_EpsilonCheckpoint(bool reset, outputStream* st) : _reset(reset), _st(st) {}
+
+  VMOp_Type type() const override { return VMOp_EpsilonCheckpoint; }
+
+  void doit() override {
+    EpsilonHeap* const heap = EpsilonHeap::heap();
+    // Retire all TLABs, so that the checkpoint is an object boundary and
+    // no thread keeps allocating into the space to discard.
+    heap->ensure_parsability(true /* retire_tlabs */);
+    if (_reset) {
+      heap->reset_to_checkpoint(_st);
+    } else {
+      heap->set_checkpoint(_st);
+    }
+  }
+};
+
+void EpsilonHeap::checkpoint(bool reset, outputStream* st) {
+  VM_EpsilonCheckpoint op(reset, st);
+  VMThread::execute(&op);
+}
+
+void EpsilonHeap::set_checkpoint(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  _checkpoint = _space->top();
+  st->print_cr("Checkpoint set at %zu%s used",
+               byte_size_in_proper_unit(used()), proper_unit_for_byte_size(used()));
+}
+
+void EpsilonHeap::reset_to_checkpoint(outputStream* st) {
+  assert(SafepointSynchronize::is_at_safepoint(), "Expected at safepoint");
+  if (_checkpoint == nullptr) {
+    st->print_cr("No checkpoint set");
+    return;
+  }
+
+  HeapWord* const checkpoint = _checkpoint;
+  HeapWord* const top = _space->top();
+
+  // Epsilon has no barriers to track stores, so look for references into the
+  // discarded space in every root and every object that survives the reset.
+  // Nmethod oops are weak for other collectors, but nothing would clear them here.
+  EpsilonCheckpointEscapeClosure cl(checkpoint, top);
+  Threads::oops_do(&cl, nullptr);
+  OopStorageSet::strong_oops_do(&cl);
+  CLDToOopClosure cld_cl(&cl, ClassLoaderData::_claim_none);
+  ClassLoaderDataGraph::cld_do(&cld_cl);
+  NMethodToOopClosure nm_cl(&cl, !NMethodToOopClosure::FixRelocations);
+  CodeCache::nmethods_do(&nm_cl);
+  // A java.lang.ref.Reference that survives the reset does not keep its
+  // referent alive, and is cleared below like the weak roots. Only a
+  // FinalReference keeps it, since the referent is yet to be finalized.
+  ResourceMark rm;
+  GrowableArray<oop> refs_to_clear;
+  for (HeapWord* p = _space->bottom(); p < checkpoint; /* empty */) {
+    oop obj = cast_to_oop(p);
+    p += obj->oop_iterate_size(&cl);
+    if (obj->klass()->is_reference_instance_klass()) {
+      oop referent = java_lang_ref_Reference::unknown_referent_no_keepalive(obj);
+      if (referent != nullptr && cl.is_discarded(referent)) {
+        if (InstanceKlass::cast(obj->klass())->reference_type() == REF_FINAL) {
+          cl.count_escape();
+        } else {
+          refs_to_clear.append(obj);
+        }
+      }
+    }
+  }
+
+  if (cl.escapes() > 0) {
+    st->print_cr("Cannot reset to checkpoint: %zu references into the %zu%s allocated since",
+                 cl.escapes(),
+                 byte_size_in_proper_unit(pointer_delta(top, checkpoint, 1)),
+                 proper_unit_for_byte_size(pointer_delta(top, checkpoint, 1)));
+    return;
+  }
+
+  // Everything allocated since the checkpoint is unreachable. Clear the weak
+  // references to it, the way a collection would for dead objects. Epsilon
+  // has no reference processing, so cleared references are not enqueued.
+  for (int i = 0; i < refs_to_clear.length(); i++) {
+    java_lang_ref_Reference::clear_referent_raw(refs_to_clear.at(i));
+  }
+  EpsilonIsBelowCheckpointClosure is_alive(checkpoint);
+  DoNothingClosure keep_alive;
+  WeakProcessor::weak_oops_do(&is_alive, &keep_alive);
+
+  const size_t discarded = pointer_delta(top, checkpoint, 1);
+  _space->set_top(checkpoint);
+  if (ZapUnusedHeapArea) {
+    _space->mangle_unused_area();
+  }
+  _monitoring_support->update_counters();
+
+  st->print_cr("Reset to checkpoint, discarded %zu%s",
+               byte_size_in_proper_unit(discarded), proper_unit_for_byte_size(discarded));
+  log_info(gc)("Reset to checkpoint, discarded %zu%s",
+               byte_size_in_proper_unit(discarded), proper_unit_for_byte_size(discarded));
+}
+
 void EpsilonHeap::print_heap_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
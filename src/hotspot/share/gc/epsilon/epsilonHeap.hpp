@@ -48,6 +48,7 @@ class EpsilonHeap : public CollectedHeap {
   int64_t _decay_time_ns;
   volatile size_t _last_counter_update;
   volatile size_t _last_heap_print;
+  HeapWord* _checkpoint;
 
   void print_tracing_info() const override;
   void stop() override {};
@@ -57,7 +58,8 @@ class EpsilonHeap : public CollectedHeap {
 
   EpsilonHeap() :
           _memory_manager("Epsilon Heap"),
-          _space(nullptr) {};
+          _space(nullptr),
+          _checkpoint(nullptr) {};
 
   Name kind() const override {
     return CollectedHeap::Epsilon;
@@ -102,6 +104,13 @@ class EpsilonHeap : public CollectedHeap {
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
+  // Checkpoints: everything allocated after a checkpoint can be discarded
+  // in bulk, provided that nothing allocated before it, and no root, strongly
+  // refers to what is discarded. Both run at a safepoint.
+  static void checkpoint(bool reset, outputStream* st);
+  void set_checkpoint(outputStream* st);
+  void reset_to_checkpoint(outputStream* st);
+
   // Object pinning support: every object is implicitly pinned
   void pin_object(JavaThread* thread, oop obj) override { }
   void unpin_object(JavaThread* thread, oop obj) override { }
@@ -24,6 +24,7 @@
 
 #include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1AnalyticsSequences.inline.hpp"
+#include "gc/g1/g1HeapRegion.hpp"
 #include "gc/g1/g1Predictions.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "runtime/globals.hpp"
@@ -225,11 +226,14 @@ void G1Analytics::report_code_root_rs_length(double code_root_rs_length, bool fo
 }
 
 double G1Analytics::predict_alloc_rate_ms() const {
+  double predicted = 0.0;
   if (enough_samples_available(&_alloc_rate_ms_seq)) {
-    return predict_zero_bounded(&_alloc_rate_ms_seq);
-  } else {
-    return 0.0;
+    predicted = predict_zero_bounded(&_alloc_rate_ms_seq);
   }
+  // The application may know about an upcoming increase in load before
+  // past collections can show it.
+  double hinted = (double)G1AllocationRateHint / G1HeapRegion::GrainBytes / MILLIUNITS;
+  return MAX2(predicted, hinted);
 }
 
 double G1Analytics::predict_concurrent_refine_rate_ms() const {
@@ -176,6 +176,13 @@ void G1Arguments::initialize() {
     FLAG_SET_ERGO(ParallelGCThreads, 1);
   }
 
+#ifndef LINUX
+  if (G1UncommitLazily) {
+    log_warning(gc)("G1UncommitLazily is only supported on Linux; ignoring it");
+    FLAG_SET_DEFAULT(G1UncommitLazily, false);
+  }
+#endif
+
   if (!G1UseConcRefinement) {
     if (!FLAG_IS_DEFAULT(G1ConcRefinementThreads)) {
       log_warning(gc, ergo)("Ignoring -XX:G1ConcRefinementThreads "
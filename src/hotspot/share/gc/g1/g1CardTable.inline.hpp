@@ -73,12 +73,14 @@ inline void G1CardTable::mark_range_dirty(size_t start_card_index, size_t num_ca
 }
 
 inline void G1CardTable::change_dirty_cards_to(CardValue* start_card, CardValue* end_card, CardValue which) {
+#ifdef ASSERT
   for (CardValue* i_card = start_card; i_card < end_card; ++i_card) {
     CardValue value = *i_card;
     assert(value == dirty_card_val(),
            "Must have been dirty %d start " PTR_FORMAT " " PTR_FORMAT, value, p2i(start_card), p2i(end_card));
-    *i_card = which;
   }
+#endif
+  memset(start_card, which, pointer_delta(end_card, start_card, sizeof(CardValue)));
 }
 
 #endif /* SHARE_GC_G1_G1CARDTABLE_INLINE_HPP */
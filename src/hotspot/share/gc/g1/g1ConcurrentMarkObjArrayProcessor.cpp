@@ -46,10 +46,24 @@ size_t G1CMObjArrayProcessor::process_array_slice(objArrayOop obj, HeapWord* sta
   return _task->scan_objArray(obj, mr);
 }
 
+size_t G1CMObjArrayProcessor::chunk_size(size_t obj_size) {
+  size_t num_chunks = MAX2(ConcGCThreads, 1u);
+  size_t strides_per_chunk = obj_size / num_chunks / ObjArrayMarkingStride + 1;
+  return strides_per_chunk * ObjArrayMarkingStride;
+}
+
 size_t G1CMObjArrayProcessor::process_obj(oop obj) {
   assert(should_be_sliced(obj), "Must be an array object %d and large %zu", obj->is_objArray(), obj->size());
 
-  return process_array_slice(objArrayOop(obj), cast_from_oop<HeapWord*>(obj), objArrayOop(obj)->size());
+  HeapWord* const start_address = cast_from_oop<HeapWord*>(obj);
+  size_t const size = objArrayOop(obj)->size();
+  size_t const chunk = chunk_size(size);
+
+  // Publish the start of every chunk but the first for other tasks to steal.
+  for (size_t offset = chunk; offset < size; offset += chunk) {
+    push_array_slice(start_address + offset);
+  }
+  return process_array_slice(objArrayOop(obj), start_address, MIN2(chunk, size));
 }
 
 size_t G1CMObjArrayProcessor::process_slice(HeapWord* slice) {
@@ -73,8 +87,11 @@ size_t G1CMObjArrayProcessor::process_slice(HeapWord* slice) {
 
   objArrayOop objArray = objArrayOop(cast_to_oop(start_address));
 
-  size_t already_scanned = pointer_delta(slice, start_address);
-  size_t remaining = objArray->size() - already_scanned;
+  size_t const size = objArray->size();
+  size_t const chunk = chunk_size(size);
+  size_t const already_scanned = pointer_delta(slice, start_address);
+  size_t const chunk_end = MIN2(already_scanned / chunk * chunk + chunk, size);
+  size_t remaining = chunk_end - already_scanned;
 
   return process_array_slice(objArray, slice, remaining);
 }
@@ -33,6 +33,9 @@ class G1CMTask;
 // Instead of pushing large object arrays, we push continuations onto the
 // mark stack. These continuations are identified by having their LSB set.
 // This allows incremental processing of large objects.
+// Large arrays are further divided into up to ConcGCThreads chunks that are
+// pushed up front, so that other marking tasks can steal and scan them in
+// parallel instead of waiting for a single chain of continuations.
 class G1CMObjArrayProcessor {
 private:
   // Reference to the task for doing the actual work.
@@ -43,6 +46,10 @@ class G1CMObjArrayProcessor {
 
   // Process (apply the closure) on the given continuation of the given objArray.
   size_t process_array_slice(objArrayOop const obj, HeapWord* start_from, size_t remaining);
+
+  // Returns the size in words of the chunks an objArray of the given size is
+  // divided into. A continuation never crosses the end of its chunk.
+  static size_t chunk_size(size_t obj_size);
 public:
   static bool should_be_sliced(oop obj);
 
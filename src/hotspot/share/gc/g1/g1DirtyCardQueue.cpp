@@ -36,7 +36,9 @@
 #include "gc/shared/bufferNode.hpp"
 #include "gc/shared/bufferNodeList.hpp"
 #include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
 #include "memory/iterator.hpp"
+#include "memory/resourceArea.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutex.hpp"
@@ -54,7 +56,8 @@
 
 G1DirtyCardQueue::G1DirtyCardQueue(G1DirtyCardQueueSet* qset) :
   PtrQueue(qset),
-  _refinement_stats(new G1ConcurrentRefineStats())
+  _refinement_stats(new G1ConcurrentRefineStats()),
+  _self_refine(false)
 { }
 
 G1DirtyCardQueue::~G1DirtyCardQueue() {
@@ -107,7 +110,7 @@ void G1DirtyCardQueueSet::handle_zero_index(G1DirtyCardQueue& queue) {
     assert(old_node->index() == 0, "invariant");
     G1ConcurrentRefineStats* stats = queue.refinement_stats();
     stats->inc_dirtied_cards(old_node->capacity());
-    handle_completed_buffer(old_node, stats);
+    handle_completed_buffer(old_node, stats, queue.self_refine());
   }
 }
 
@@ -476,11 +479,14 @@ void G1DirtyCardQueueSet::handle_refined_buffer(BufferNode* node,
 }
 
 void G1DirtyCardQueueSet::handle_completed_buffer(BufferNode* new_node,
-                                                  G1ConcurrentRefineStats* stats) {
+                                                  G1ConcurrentRefineStats* stats,
+                                                  bool self_refine) {
   enqueue_completed_buffer(new_node);
 
-  // No need for mutator refinement if number of cards is below limit.
-  if (Atomic::load(&_num_cards) <= Atomic::load(&_mutator_refinement_threshold)) {
+  // No need for mutator refinement if number of cards is below limit, unless
+  // this thread dirties enough cards to pay for them itself.
+  if (!self_refine &&
+      Atomic::load(&_num_cards) <= Atomic::load(&_mutator_refinement_threshold)) {
     return;
   }
 
@@ -576,6 +582,19 @@ G1ConcurrentRefineStats G1DirtyCardQueueSet::concatenate_log_and_stats(Thread* t
 
   G1ConcurrentRefineStats result = *queue.refinement_stats();
   queue.refinement_stats()->reset();
+
+  if (G1SelfRefineDirtiedCardsThreshold > 0) {
+    bool self_refine = result.dirtied_cards() > G1SelfRefineDirtiedCardsThreshold;
+    if (self_refine != queue.self_refine()) {
+      queue.set_self_refine(self_refine);
+      LogTarget(Trace, gc, refine) lt;
+      if (lt.is_enabled()) {
+        ResourceMark rm;
+        lt.print("Self refinement %s for thread %s, dirtied cards: %zu",
+                 self_refine ? "enabled" : "disabled", thread->name(), result.dirtied_cards());
+      }
+    }
+  }
   return result;
 }
 
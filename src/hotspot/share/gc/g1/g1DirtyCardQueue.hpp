@@ -43,6 +43,9 @@ class Thread;
 // A ptrQueue whose elements are "oops", pointers to object heads.
 class G1DirtyCardQueue: public PtrQueue {
   G1ConcurrentRefineStats* _refinement_stats;
+  // Whether the owning thread refines its own completed buffers, see
+  // G1SelfRefineDirtiedCardsThreshold.
+  bool _self_refine;
 
 public:
   G1DirtyCardQueue(G1DirtyCardQueueSet* qset);
@@ -55,6 +58,9 @@ class G1DirtyCardQueue: public PtrQueue {
     return _refinement_stats;
   }
 
+  bool self_refine() const { return _self_refine; }
+  void set_self_refine(bool value) { _self_refine = value; }
+
   // Compiler support.
   static ByteSize byte_offset_of_index() {
     return PtrQueue::byte_offset_of_index<G1DirtyCardQueue>();
@@ -224,13 +230,14 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
 
   // Enqueue the buffer, and optionally perform refinement by the mutator.
   // Mutator refinement is only done by Java threads, and only if there
-  // are more than mutator_refinement_threshold cards in the completed buffers.
+  // are more than mutator_refinement_threshold cards in the completed buffers
+  // or the thread has been selected to refine its own buffers.
   // Updates stats.
   //
   // Mutator refinement, if performed, stops processing a buffer if
   // SuspendibleThreadSet::should_yield(), recording the incompletely
   // processed buffer for later processing of the remainder.
-  void handle_completed_buffer(BufferNode* node, G1ConcurrentRefineStats* stats);
+  void handle_completed_buffer(BufferNode* node, G1ConcurrentRefineStats* stats, bool self_refine);
 
 public:
   G1DirtyCardQueueSet(BufferNode::Allocator* allocator);
@@ -33,6 +33,7 @@
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "logging/log.hpp"
+#include "memory/allocation.hpp"
 #include "memory/iterator.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "utilities/ticks.hpp"
@@ -40,7 +41,16 @@
 G1DetermineCompactionQueueClosure::G1DetermineCompactionQueueClosure(G1FullCollector* collector) :
   _g1h(G1CollectedHeap::heap()),
   _collector(collector),
-  _cur_worker(0) { }
+  _cur_worker(0),
+  _assigned_live_words(NEW_C_HEAP_ARRAY(size_t, collector->workers(), mtGC)) {
+  for (uint i = 0; i < collector->workers(); i++) {
+    _assigned_live_words[i] = 0;
+  }
+}
+
+G1DetermineCompactionQueueClosure::~G1DetermineCompactionQueueClosure() {
+  FREE_C_HEAP_ARRAY(size_t, _assigned_live_words);
+}
 
 bool G1FullGCPrepareTask::G1CalculatePointersClosure::do_heap_region(G1HeapRegion* hr) {
   uint region_idx = hr->hrm_index();
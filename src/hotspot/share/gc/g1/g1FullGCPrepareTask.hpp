@@ -41,21 +41,26 @@ class G1DetermineCompactionQueueClosure : public G1HeapRegionClosure {
   G1CollectedHeap* _g1h;
   G1FullCollector* _collector;
   uint _cur_worker;
+  // Live words in the regions assigned to each worker's compaction queue.
+  size_t* _assigned_live_words;
 
   inline void free_empty_humongous_region(G1HeapRegion* hr);
 
   inline bool should_compact(G1HeapRegion* hr) const;
 
-  // Returns the current worker id to assign a compaction point to, and selects
-  // the next one round-robin style.
-  inline uint next_worker();
+  // Returns the worker id to assign a region with the given amount of live
+  // words to. This is the worker with the least live words assigned so far;
+  // ties are broken round-robin style, starting at the worker after the one
+  // selected last.
+  inline uint next_worker(size_t live_words);
 
-  inline G1FullGCCompactionPoint* next_compaction_point();
+  inline G1FullGCCompactionPoint* next_compaction_point(size_t live_words);
 
   inline void add_to_compaction_queue(G1HeapRegion* hr);
 
 public:
   G1DetermineCompactionQueueClosure(G1FullCollector* collector);
+  ~G1DetermineCompactionQueueClosure();
 
   inline bool do_heap_region(G1HeapRegion* hr) override;
 };
@@ -52,21 +52,32 @@ inline bool G1DetermineCompactionQueueClosure::should_compact(G1HeapRegion* hr)
   return live_words <= live_words_threshold;
 }
 
-inline uint G1DetermineCompactionQueueClosure::next_worker() {
+inline uint G1DetermineCompactionQueueClosure::next_worker(size_t live_words) {
+  // Balance the queues by live words, which are what the prepare and compact
+  // phases spend their time on, instead of by number of regions. Otherwise a
+  // few workers that happen to get the densest regions finish last.
+  uint num_workers = _collector->workers();
   uint result = _cur_worker;
-  _cur_worker = (_cur_worker + 1) % _collector->workers();
+  for (uint i = 1; i < num_workers; i++) {
+    uint worker = (_cur_worker + i) % num_workers;
+    if (_assigned_live_words[worker] < _assigned_live_words[result]) {
+      result = worker;
+    }
+  }
+  _assigned_live_words[result] += live_words;
+  _cur_worker = (result + 1) % num_workers;
   return result;
 }
 
-inline G1FullGCCompactionPoint* G1DetermineCompactionQueueClosure::next_compaction_point() {
-  return _collector->compaction_point(next_worker());
+inline G1FullGCCompactionPoint* G1DetermineCompactionQueueClosure::next_compaction_point(size_t live_words) {
+  return _collector->compaction_point(next_worker(live_words));
 }
 
 inline void G1DetermineCompactionQueueClosure::add_to_compaction_queue(G1HeapRegion* hr) {
   _collector->set_compaction_top(hr, hr->bottom());
   _collector->set_has_compaction_targets();
 
-  G1FullGCCompactionPoint* cp = next_compaction_point();
+  G1FullGCCompactionPoint* cp = next_compaction_point(_collector->live_words(hr->hrm_index()));
   if (!cp->is_initialized()) {
     cp->initialize(hr);
   }
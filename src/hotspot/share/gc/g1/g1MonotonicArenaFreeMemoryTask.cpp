@@ -99,10 +99,13 @@ bool G1MonotonicArenaFreeMemoryTask::return_memory_to_os(jlong deadline) {
 }
 
 bool G1MonotonicArenaFreeMemoryTask::cleanup_return_infos() {
+  size_t returned_to_os_bytes = 0;
   for (int i = 0; i < _return_info->length(); i++) {
      G1ReturnMemoryProcessor* info = _return_info->at(i);
+     returned_to_os_bytes += info->returned_to_os_bytes();
      delete info;
   }
+  G1CollectedHeap::heap()->card_set_freelist_pool()->add_returned_to_os_bytes(returned_to_os_bytes);
   delete _return_info;
 
   _return_info = nullptr;
@@ -27,6 +27,7 @@
 #include "gc/g1/g1MonotonicArenaFreePool.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/formatBuffer.hpp"
 #include "utilities/ostream.hpp"
@@ -141,13 +142,15 @@ bool G1MonotonicArenaFreePool::G1ReturnMemoryProcessor::return_to_os(jlong deadl
     }
   }
 
+  _returned_to_os_bytes += mem_size_deleted;
   log_trace(gc, task)("Monotonic Arena Free Memory: Return to OS %zu segments size %zu", num_delete, mem_size_deleted);
 
   return _first != nullptr;
 }
 
 G1MonotonicArenaFreePool::G1MonotonicArenaFreePool(uint num_free_lists) :
-  _num_free_lists(num_free_lists) {
+  _num_free_lists(num_free_lists),
+  _returned_to_os_bytes(0) {
 
   _free_lists = NEW_C_HEAP_ARRAY(SegmentFreeList, _num_free_lists, mtGC);
   for (uint i = 0; i < _num_free_lists; i++) {
@@ -180,6 +183,14 @@ size_t G1MonotonicArenaFreePool::mem_size() const {
   return result;
 }
 
+void G1MonotonicArenaFreePool::add_returned_to_os_bytes(size_t bytes) {
+  Atomic::add(&_returned_to_os_bytes, bytes, memory_order_relaxed);
+}
+
+size_t G1MonotonicArenaFreePool::returned_to_os_bytes() const {
+  return Atomic::load(&_returned_to_os_bytes);
+}
+
 void G1MonotonicArenaFreePool::print_on(outputStream* out) const {
   out->print_cr("  Free Pool: size %zu", mem_size());
   for (uint i = 0; i < _num_free_lists; i++) {
@@ -61,6 +61,8 @@ class G1MonotonicArenaFreePool {
 
   const uint _num_free_lists;
   SegmentFreeList* _free_lists;
+  // Total memory of segments given back to the OS from these free lists.
+  volatile size_t _returned_to_os_bytes;
 
 public:
   class G1ReturnMemoryProcessor;
@@ -81,6 +83,9 @@ class G1MonotonicArenaFreePool {
   G1MonotonicArenaMemoryStats memory_sizes() const;
   size_t mem_size() const;
 
+  void add_returned_to_os_bytes(size_t bytes);
+  size_t returned_to_os_bytes() const;
+
   void print_on(outputStream* out) const;
 };
 
@@ -95,10 +100,12 @@ class G1MonotonicArenaFreePool::G1ReturnMemoryProcessor : public CHeapObj<mtGC>
   Segment* _first;
   size_t _unlinked_bytes;
   size_t _num_unlinked;
+  size_t _returned_to_os_bytes;
 
 public:
   explicit G1ReturnMemoryProcessor(size_t return_to_vm) :
-    _source(nullptr), _return_to_vm_size(return_to_vm), _first(nullptr), _unlinked_bytes(0), _num_unlinked(0) {
+    _source(nullptr), _return_to_vm_size(return_to_vm), _first(nullptr), _unlinked_bytes(0), _num_unlinked(0),
+    _returned_to_os_bytes(0) {
   }
 
   // Updates the instance members about the given free list for
@@ -119,6 +126,8 @@ class G1MonotonicArenaFreePool::G1ReturnMemoryProcessor : public CHeapObj<mtGC>
   // has been processed after returning.
   // return_to_os() gives back segments to the OS.
   bool return_to_os(jlong deadline);
+
+  size_t returned_to_os_bytes() const { return _returned_to_os_bytes; }
 };
 
 #endif //SHARE_GC_G1_G1MONOTONICARENAFREEPOOL_HPP
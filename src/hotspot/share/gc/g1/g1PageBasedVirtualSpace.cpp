@@ -23,6 +23,7 @@
  */
 
 #include "gc/g1/g1PageBasedVirtualSpace.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/pretouchTask.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "nmt/memTracker.hpp"
@@ -32,6 +33,9 @@
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
+#ifdef LINUX
+#include "os_linux.hpp"
+#endif
 
 G1PageBasedVirtualSpace::G1PageBasedVirtualSpace(ReservedSpace rs, size_t used_size, size_t page_size) :
   _low_boundary(nullptr), _high_boundary(nullptr), _tail_size(0), _page_size(0),
@@ -65,7 +69,7 @@ void G1PageBasedVirtualSpace::initialize_with_page_size(ReservedSpace rs, size_t
   vmassert(_committed.size() == 0, "virtual space initialized more than once");
   BitMap::idx_t size_in_pages = rs.size() / page_size;
   _committed.initialize(size_in_pages);
-  if (_special) {
+  if (_special || uncommits_lazily()) {
     _dirty.initialize(size_in_pages);
   }
 
@@ -168,6 +172,10 @@ void G1PageBasedVirtualSpace::commit_internal(size_t start_page, size_t end_page
   }
 }
 
+bool G1PageBasedVirtualSpace::uncommits_lazily() const {
+  return !_special && G1UncommitLazily;
+}
+
 char* G1PageBasedVirtualSpace::bounded_end_addr(size_t end_page) const {
   return MIN2(_high_boundary, page_start(end_page));
 }
@@ -187,6 +195,22 @@ bool G1PageBasedVirtualSpace::commit(size_t start_page, size_t size_in_pages) {
       zero_filled = false;
       _dirty.par_clear_range(start_page, end_page, BitMap::unknown_range);
     }
+  } else if (uncommits_lazily()) {
+    // Dirty pages are still mapped; only commit the ones in between.
+    size_t cur = start_page;
+    while (cur < end_page) {
+      size_t clean_start = _dirty.find_first_clear_bit(cur, end_page);
+      if (clean_start > cur) {
+        zero_filled = false;
+      }
+      if (clean_start == end_page) {
+        break;
+      }
+      size_t clean_end = _dirty.find_first_set_bit(clean_start, end_page);
+      commit_internal(clean_start, clean_end);
+      cur = clean_end;
+    }
+    _dirty.par_clear_range(start_page, end_page, BitMap::unknown_range);
   } else {
     commit_internal(start_page, end_page);
   }
@@ -213,6 +237,10 @@ void G1PageBasedVirtualSpace::uncommit(size_t start_page, size_t size_in_pages)
     // Mark that memory is dirty. If committed again the memory might
     // need to be cleared explicitly.
     _dirty.par_set_range(start_page, end_page, BitMap::unknown_range);
+  } else if (uncommits_lazily()) {
+    char* start_addr = page_start(start_page);
+    LINUX_ONLY(os::Linux::madvise_free(start_addr, pointer_delta(bounded_end_addr(end_page), start_addr, sizeof(char)));)
+    _dirty.par_set_range(start_page, end_page, BitMap::unknown_range);
   } else {
     uncommit_internal(start_page, end_page);
   }
@@ -65,6 +65,7 @@ class G1PageBasedVirtualSpace {
   // spaces. This is needed because for those spaces the underlying memory
   // will only be zero filled the first time it is committed. Calls to commit
   // will use this bitmap and return whether or not the memory is zero filled.
+  // With G1UncommitLazily, uncommitted pages that are still mapped are dirty.
   CHeapBitMap _dirty;
 
   // Indicates that the entire space has been committed and pinned in memory,
@@ -84,6 +85,9 @@ class G1PageBasedVirtualSpace {
   // Uncommit the given memory range.
   void uncommit_internal(size_t start_page, size_t end_page);
 
+  // Whether uncommitted pages stay mapped, see G1UncommitLazily.
+  bool uncommits_lazily() const;
+
   // Is the given page index the last page?
   bool is_last_page(size_t index) const { return index == (_committed.size() - 1); }
   // Is the given page index the first after last page?
@@ -269,6 +269,20 @@ void G1ParScanThreadState::dispatch_task(ScannerTask task, bool stolen) {
   }
 }
 
+void G1ParScanThreadState::prefetch_task(ScannerTask task) {
+  oop obj;
+  if (task.is_narrow_oop_ptr()) {
+    obj = RawAccess<>::oop_load(task.to_narrow_oop_ptr());
+  } else if (task.is_oop_ptr()) {
+    obj = RawAccess<>::oop_load(task.to_oop_ptr());
+  } else {
+    return;
+  }
+  if (obj != nullptr) {
+    Prefetch::write(obj->mark_addr(), 0);
+  }
+}
+
 // Process tasks until overflow queue is empty and local queue
 // contains no more than threshold entries.  NOINLINE to prevent
 // inlining into steal_and_trim_queue.
@@ -281,8 +295,32 @@ void G1ParScanThreadState::trim_queue_to_threshold(uint threshold) {
         dispatch_task(task, false);
       }
     }
-    while (_task_queue->pop_local(task, threshold)) {
-      dispatch_task(task, false);
+    // Keep a few popped tasks in flight, prefetching the object of each as
+    // it is popped, so that the copy of the oldest one does not stall on its
+    // header. Dispatching may push more tasks, so only stop once the local
+    // queue is at the threshold and nothing is pending.
+    ScannerTask pending[TrimQueuePrefetchDepth];
+    uint head = 0;
+    uint num_pending = 0;
+    while (true) {
+      if (_task_queue->pop_local(task, threshold)) {
+        prefetch_task(task);
+        if (num_pending < TrimQueuePrefetchDepth) {
+          pending[(head + num_pending++) & (TrimQueuePrefetchDepth - 1)] = task;
+          continue;
+        }
+        ScannerTask oldest = pending[head];
+        pending[head] = task;
+        head = (head + 1) & (TrimQueuePrefetchDepth - 1);
+        dispatch_task(oldest, false);
+      } else if (num_pending > 0) {
+        ScannerTask oldest = pending[head];
+        head = (head + 1) & (TrimQueuePrefetchDepth - 1);
+        num_pending--;
+        dispatch_task(oldest, false);
+      } else {
+        break;
+      }
     }
   } while (!_task_queue->overflow_empty());
 }
@@ -197,6 +197,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   template <class T> void do_oop_evac(T* p);
 
   void dispatch_task(ScannerTask task, bool stolen);
+  // Prefetches the header of the object referenced by task, if any, so that
+  // it is likely in cache by the time the task is dispatched.
+  void prefetch_task(ScannerTask task);
 
   // Tries to allocate word_sz in the PLAB of the next "generation" after trying to
   // allocate into dest. Previous_plab_refill_failed indicates whether previous
@@ -215,6 +218,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
                               Klass* klass, size_t word_sz, uint age,
                               HeapWord * const obj_ptr, uint node_index) const;
 
+  // Number of tasks popped ahead of the one being dispatched in
+  // trim_queue_to_threshold(). Must be a power of 2.
+  static const uint TrimQueuePrefetchDepth = 4;
+
   void trim_queue_to_threshold(uint threshold);
 
   inline bool needs_partial_trimming() const;
@@ -191,24 +191,36 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     // underlying OS page. See lock declaration for more details.
     {
       MutexLocker ml(&_lock, Mutex::_no_safepoint_check_flag);
-      for (size_t page = start_page; page <= end_page; page++) {
-        if (!is_page_committed(page)) {
-          // Page not committed.
-          if (num_committed == 0) {
-            first_committed = page;
-          }
-          num_committed++;
-
-          if (!_storage.commit(page, 1)) {
-            // Found dirty region during commit.
-            all_zero_filled = false;
-          }
-
-          // Move memory to correct NUMA node for the heap.
-          numa_request_on_node(page);
-        } else {
+      // Commit runs of uncommitted pages with a single call each, so that
+      // expansion does not pay for one OS and NMT update per page.
+      size_t page = start_page;
+      while (page <= end_page) {
+        if (is_page_committed(page)) {
           // Page already committed.
           all_zero_filled = false;
+          page++;
+          continue;
+        }
+
+        size_t run_end = page + 1;
+        while (run_end <= end_page && !is_page_committed(run_end)) {
+          run_end++;
+        }
+        size_t run_length = run_end - page;
+
+        if (num_committed == 0) {
+          first_committed = page;
+        }
+        num_committed += run_length;
+
+        if (!_storage.commit(page, run_length)) {
+          // Found dirty region during commit.
+          all_zero_filled = false;
+        }
+
+        // Move memory to correct NUMA node for the heap.
+        for (; page < run_end; page++) {
+          numa_request_on_node(page);
         }
       }
 
@@ -240,13 +252,21 @@ class G1RegionsSmallerThanCommitSizeMapper : public G1RegionToSpaceMapper {
     // updates to _region_commit_map for this mapper is protected by _lock.
     _region_commit_map.clear_range(start_idx, region_limit, BitMap::unknown_range);
 
-    for (size_t page = start_page; page <= end_page; page++) {
+    size_t page = start_page;
+    while (page <= end_page) {
       // We know all pages were committed before clearing the map. If the
       // the page is still marked as committed after the clear we should
       // not uncommit it.
-      if (!is_page_committed(page)) {
-        _storage.uncommit(page, 1);
+      if (is_page_committed(page)) {
+        page++;
+        continue;
+      }
+      size_t run_end = page + 1;
+      while (run_end <= end_page && !is_page_committed(run_end)) {
+        run_end++;
       }
+      _storage.uncommit(page, run_end - page);
+      page = run_end;
     }
   }
 };
@@ -54,6 +54,8 @@
 #include "runtime/atomic.hpp"
 #include "runtime/os.hpp"
 #include "utilities/align.hpp"
+#include "utilities/count_leading_zeros.hpp"
+#include "utilities/count_trailing_zeros.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/powerOfTwo.hpp"
 #include "utilities/stack.inline.hpp"
@@ -559,6 +561,17 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
       return ((uintptr_t)addr) % sizeof(Word) == 0;
     }
 
+    // Returns the index of the first card within a word whose bit is set in
+    // the given expanded mask, which must not be zero.
+    static uint first_card_in_word(Word mask) {
+      assert(mask != 0, "must have a card");
+#ifdef VM_LITTLE_ENDIAN
+      return count_trailing_zeros(mask) / BitsPerByte;
+#else
+      return count_leading_zeros(mask) / BitsPerByte;
+#endif
+    }
+
     CardValue* find_first_dirty_card(CardValue* i_card) const {
       while (!is_word_aligned(i_card)) {
         if (is_card_dirty(i_card)) {
@@ -569,16 +582,12 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
 
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
         Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word dirty_cards_in_word = ~word_value & ExpandedToScanMask;
+
+        if (dirty_cards_in_word != 0) {
+          CardValue* result = i_card + first_card_in_word(dirty_cards_in_word);
+          assert(is_card_dirty(result), "must be");
+          return result;
         }
       }
 
@@ -595,16 +604,12 @@ class G1ScanHRForRegionClosure : public G1HeapRegionClosure {
 
       for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
         Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
+        Word non_dirty_cards_in_word = word_value & ExpandedToScanMask;
+
+        if (non_dirty_cards_in_word != 0) {
+          CardValue* result = i_card + first_card_in_word(non_dirty_cards_in_word);
+          assert(!is_card_dirty(result), "must be");
+          return result;
         }
       }
 
@@ -51,6 +51,8 @@ void G1RemSetSummary::update() {
 
   G1CollectedHeap* g1h = G1CollectedHeap::heap();
   g1h->concurrent_refine()->threads_do(&collector);
+
+  _card_set_returned_to_os_bytes = g1h->card_set_freelist_pool()->returned_to_os_bytes();
 }
 
 void G1RemSetSummary::set_refine_thread_cpu_time(uint thread, jlong value) {
@@ -67,7 +69,8 @@ jlong G1RemSetSummary::refine_thread_cpu_time(uint thread) const {
 
 G1RemSetSummary::G1RemSetSummary(bool should_update) :
   _num_refine_threads(G1ConcRefinementThreads),
-  _refine_threads_cpu_times(NEW_C_HEAP_ARRAY(jlong, _num_refine_threads, mtGC)) {
+  _refine_threads_cpu_times(NEW_C_HEAP_ARRAY(jlong, _num_refine_threads, mtGC)),
+  _card_set_returned_to_os_bytes(0) {
 
   memset(_refine_threads_cpu_times, 0, sizeof(jlong) * _num_refine_threads);
 
@@ -85,6 +88,7 @@ void G1RemSetSummary::set(G1RemSetSummary* other) {
   assert(_num_refine_threads == other->_num_refine_threads, "just checking");
 
   memcpy(_refine_threads_cpu_times, other->_refine_threads_cpu_times, sizeof(jlong) * _num_refine_threads);
+  _card_set_returned_to_os_bytes = other->_card_set_returned_to_os_bytes;
 }
 
 void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
@@ -94,6 +98,7 @@ void G1RemSetSummary::subtract_from(G1RemSetSummary* other) {
   for (uint i = 0; i < _num_refine_threads; i++) {
     set_refine_thread_cpu_time(i, other->refine_thread_cpu_time(i) - refine_thread_cpu_time(i));
   }
+  _card_set_returned_to_os_bytes = other->_card_set_returned_to_os_bytes - _card_set_returned_to_os_bytes;
 }
 
 class G1PerRegionTypeRemSetCounters {
@@ -387,6 +392,9 @@ void G1RemSetSummary::print_on(outputStream* out, bool show_thread_times) {
     }
     out->cr();
   }
+  out->print_cr(" Card set memory returned to OS: %zu%s",
+                byte_size_in_proper_unit(_card_set_returned_to_os_bytes),
+                proper_unit_for_byte_size(_card_set_returned_to_os_bytes));
   G1HeapRegionStatsClosure blk;
   G1CollectedHeap::heap()->heap_region_iterate(&blk);
   blk.do_cset_groups();
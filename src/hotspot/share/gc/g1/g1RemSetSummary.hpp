@@ -35,6 +35,8 @@ class G1RemSet;
 class G1RemSetSummary {
   size_t _num_refine_threads;
   jlong* _refine_threads_cpu_times;
+  // Card set memory given back to the OS by the free memory task.
+  size_t _card_set_returned_to_os_bytes;
 
   void set_refine_thread_cpu_time(uint thread, jlong value);
 
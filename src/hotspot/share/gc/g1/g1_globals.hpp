@@ -202,6 +202,14 @@
           "Control whether concurrent refinement is performed. "            \
           "Disabling effectively ignores G1RSetUpdatingPauseTimePercent")   \
                                                                             \
+  product(size_t, G1SelfRefineDirtiedCardsThreshold, 0, EXPERIMENTAL,       \
+          "Java threads that dirtied more than this number of cards "       \
+          "between two garbage collections refine their own completed "     \
+          "update buffers until the next one, even if there are not "       \
+          "enough pending cards for other threads to do so. Zero disables " \
+          "self refinement.")                                               \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(uint, G1RemSetArrayOfCardsEntriesBase, 8,                         \
           "Maximum number of entries per region in the Array of Cards "     \
           "card set container per MB of a heap region.")                    \
@@ -328,6 +336,12 @@
           "perform a concurrent GC as periodic GC, otherwise use a STW "    \
           "Full GC.")                                                       \
                                                                             \
+  product(bool, G1UncommitLazily, false, EXPERIMENTAL,                      \
+          "Keep the memory of uncommitted regions mapped and let the OS "   \
+          "reclaim it when it needs to (MADV_FREE). Committing such "       \
+          "regions again does not fault in memory the OS has not "          \
+          "reclaimed yet. Only supported on Linux.")                        \
+                                                                            \
   product(double, G1PeriodicGCSystemLoadThreshold, 0.0, MANAGEABLE,         \
           "Maximum recent system wide load as returned by the 1m value "    \
           "of getloadavg() at which G1 triggers a periodic GC. A load "     \
@@ -335,6 +349,12 @@
           "disables this check.")                                           \
           range(0.0, (double)max_uintx)                                     \
                                                                             \
+  product(size_t, G1AllocationRateHint, 0, MANAGEABLE,                      \
+          "Expected mutator allocation rate in bytes per second, as "       \
+          "hinted by the application ahead of a change in load. G1 sizes "  \
+          "the young generation for at least this rate. A value of zero "   \
+          "uses the rate predicted from past collections only.")            \
+                                                                            \
   product(uint, G1RemSetFreeMemoryRescheduleDelayMillis, 10, EXPERIMENTAL,  \
           "Time after which the card set free memory task reschedules "     \
           "itself if there is work remaining.")                             \
@@ -41,7 +41,13 @@
           "for a system GC")                                                \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "(Deprecated) Process large arrays in chunks")
+          "(Deprecated) Process large arrays in chunks")                    \
+                                                                            \
+  product(size_t, PSSummaryRegionsPerChunk, 8 * K, DIAGNOSTIC,              \
+          "Number of regions of the old generation that a GC worker "       \
+          "summarizes at a time during a full GC. Old generations with "    \
+          "fewer regions than two chunks are summarized serially")          \
+          range(1, max_uintx)
 
 // end of GC_PARALLEL_FLAGS
 
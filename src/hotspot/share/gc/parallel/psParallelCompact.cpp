@@ -500,27 +500,7 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
                              ? split_info.preceding_destination_count()
                              : 0;
 
-    HeapWord* const last_addr = dest_addr + words - 1;
-    const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-    const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-    // Initially assume that the destination regions will be the same and
-    // adjust the value below if necessary.  Under this assumption, if
-    // cur_region == dest_region_2, then cur_region will be compacted
-    // completely into itself.
-    destination_count += cur_region == dest_region_2 ? 0 : 1;
-    if (dest_region_1 != dest_region_2) {
-      // Destination regions differ; adjust destination_count.
-      destination_count += 1;
-      // Data from cur_region will be copied to the start of dest_region_2.
-      _region_data[dest_region_2].set_source_region(cur_region);
-    } else if (is_region_aligned(dest_addr)) {
-      // Data from cur_region will be copied to the start of the destination
-      // region.
-      _region_data[dest_region_1].set_source_region(cur_region);
-    }
-
-    _region_data[cur_region].set_destination_count(destination_count);
+    summarize_region(cur_region, words, destination_count, dest_addr);
     dest_addr += words;
   }
 
@@ -528,6 +508,54 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(size_t cur_region, size_t words,
+                                           uint destination_count, HeapWord* dest_addr)
+{
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+}
+
+size_t ParallelCompactData::live_words_in_regions(size_t beg_region, size_t end_region) const
+{
+  size_t live_words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    live_words += _region_data[cur_region].data_size();
+  }
+  return live_words;
+}
+
+void ParallelCompactData::summarize_regions(size_t beg_region, size_t end_region, HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    const size_t words = _region_data[cur_region].data_size();
+    if (words == 0) {
+      continue;
+    }
+    _region_data[cur_region].set_destination(dest_addr);
+    summarize_region(cur_region, words, 0, dest_addr);
+    dest_addr += words;
+  }
+}
+
 #ifdef ASSERT
 void ParallelCompactData::verify_clear() {
   for (uint cur_idx = 0; cur_idx < region_count(); ++cur_idx) {
@@ -854,6 +882,91 @@ bool PSParallelCompact::check_maximum_compaction(size_t total_live_words,
   return false;
 }
 
+// Summarizes a space compacted into itself in two parallel passes over
+// chunks of regions: the first counts the live words of each chunk, and,
+// once the destinations of the chunks have been derived from those counts,
+// the second summarizes the regions of each chunk.
+class PSSummarizeSpaceTask : public WorkerTask {
+  const size_t   _beg_region;
+  const size_t   _end_region;
+  const size_t   _num_chunks;
+  size_t* const  _chunk_live_words;
+  HeapWord**     _chunk_dest;
+  volatile size_t _claimed;
+
+  size_t chunk_beg(size_t chunk) const {
+    return _beg_region + chunk * PSSummaryRegionsPerChunk;
+  }
+
+  size_t chunk_end(size_t chunk) const {
+    return MIN2(chunk_beg(chunk) + PSSummaryRegionsPerChunk, _end_region);
+  }
+
+public:
+  PSSummarizeSpaceTask(size_t beg_region, size_t end_region, size_t num_chunks) :
+      WorkerTask("PSSummarizeSpaceTask"),
+      _beg_region(beg_region),
+      _end_region(end_region),
+      _num_chunks(num_chunks),
+      _chunk_live_words(NEW_C_HEAP_ARRAY(size_t, num_chunks, mtGC)),
+      _chunk_dest(nullptr),
+      _claimed(0) {}
+
+  ~PSSummarizeSpaceTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_live_words);
+    FREE_C_HEAP_ARRAY(HeapWord*, _chunk_dest);
+  }
+
+  // Turn the live word counts into chunk destinations and rearm the task
+  // for the second pass. Returns the end of the compacted data.
+  HeapWord* set_destinations(HeapWord* dest_addr) {
+    _chunk_dest = NEW_C_HEAP_ARRAY(HeapWord*, _num_chunks, mtGC);
+    for (size_t chunk = 0; chunk < _num_chunks; ++chunk) {
+      _chunk_dest[chunk] = dest_addr;
+      dest_addr += _chunk_live_words[chunk];
+    }
+    _claimed = 0;
+    return dest_addr;
+  }
+
+  void work(uint worker_id) override {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    for (size_t chunk = Atomic::fetch_then_add(&_claimed, (size_t)1);
+         chunk < _num_chunks;
+         chunk = Atomic::fetch_then_add(&_claimed, (size_t)1)) {
+      if (_chunk_dest == nullptr) {
+        _chunk_live_words[chunk] = sd.live_words_in_regions(chunk_beg(chunk), chunk_end(chunk));
+      } else {
+        sd.summarize_regions(chunk_beg(chunk), chunk_end(chunk), _chunk_dest[chunk]);
+      }
+    }
+  }
+};
+
+void PSParallelCompact::summarize_old_space(HeapWord* dense_prefix_end) {
+  const SpaceId id = old_space_id;
+  MutableSpace* const old_space = _space_info[id].space();
+  assert(!_space_info[id].split_info().is_valid(), "old-space is never split");
+
+  const size_t beg_region = _summary_data.addr_to_region_idx(dense_prefix_end);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(old_space->top()));
+  const size_t num_chunks = (end_region - beg_region + PSSummaryRegionsPerChunk - 1) / PSSummaryRegionsPerChunk;
+
+  WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+  if (num_chunks < 2 || workers.active_workers() < 2) {
+    _summary_data.summarize(_space_info[id].split_info(),
+                            dense_prefix_end, old_space->top(), nullptr,
+                            dense_prefix_end, old_space->end(),
+                            _space_info[id].new_top_addr());
+    return;
+  }
+
+  PSSummarizeSpaceTask task(beg_region, end_region, num_chunks);
+  workers.run_task(&task);
+  _space_info[id].set_new_top(task.set_destinations(dense_prefix_end));
+  workers.run_task(&task);
+}
+
 void PSParallelCompact::summary_phase()
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
@@ -901,10 +1014,7 @@ void PSParallelCompact::summary_phase()
     }
 
     // Compacting objs in [dense_prefix_end, old_space->top())
-    _summary_data.summarize(_space_info[id].split_info(),
-                            dense_prefix_end, old_space->top(), nullptr,
-                            dense_prefix_end, old_space->end(),
-                            _space_info[id].new_top_addr());
+    summarize_old_space(dense_prefix_end);
   }
 
   // Summarize the remaining spaces in the young gen.  The initial target space
@@ -378,8 +378,21 @@ class ParallelCompactData
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Building blocks for summarizing a space that is compacted into itself in
+  // parallel: the live words in regions [beg_region, end_region), and the
+  // summary of those regions given the destination of their first live word.
+  // Nothing may need splitting.
+  size_t live_words_in_regions(size_t beg_region, size_t end_region) const;
+  void summarize_regions(size_t beg_region, size_t end_region, HeapWord* dest_addr);
+
   void clear_range(size_t beg_region, size_t end_region);
 
+private:
+  // Record where the words live in cur_region go, once its destination is known.
+  void summarize_region(size_t cur_region, size_t words, uint destination_count, HeapWord* dest_addr);
+
+public:
+
   // Return the number of words between addr and the start of the region
   // containing addr.
   inline size_t     region_offset(const HeapWord* addr) const;
@@ -742,6 +755,10 @@ class PSParallelCompact : AllStatic {
   // make the heap parsable.
   static void fill_dense_prefix_end(SpaceId id);
 
+  // Summarize the old-space objects above the dense prefix, which are
+  // compacted within the old-space, using the GC workers on large heaps.
+  static void summarize_old_space(HeapWord* dense_prefix_end);
+
   static void summary_phase();
 
   static void adjust_pointers();
@@ -74,6 +74,35 @@ class PromoteFailureClosure : public InHeapScanClosure {
   void do_oop(narrowOop* p) { do_oop_work(p); }
 };
 
+// Copies the not yet copied young objects referenced by a just promoted
+// object. The fields are left alone; the scan of the promoted objects
+// updates them, and marks the cards, later.
+class PromoteChildrenClosure : public BasicOopIterateClosure {
+  DefNewGeneration* _young_gen;
+  HeapWord*         _young_gen_end;
+
+  template <typename T>
+  void do_oop_work(T* p) {
+    T heap_oop = RawAccess<>::oop_load(p);
+    if (!CompressedOops::is_null(heap_oop)) {
+      oop obj = CompressedOops::decode_not_null(heap_oop);
+      if (cast_from_oop<HeapWord*>(obj) < _young_gen_end && !obj->is_forwarded()) {
+        _young_gen->copy_to_survivor_space(obj);
+      }
+    }
+  }
+public:
+  PromoteChildrenClosure(DefNewGeneration* g) :
+    _young_gen(g),
+    _young_gen_end(g->reserved().end()) {}
+
+  // Referents are left to reference discovery.
+  ReferenceIterationMode reference_iteration_mode() override { return DO_FIELDS_EXCEPT_REFERENT; }
+
+  void do_oop(oop* p)       { do_oop_work(p); }
+  void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
 class RootScanClosure : public OffHeapScanClosure {
   template <typename T>
   void do_oop_work(T* p) {
@@ -227,6 +256,7 @@ DefNewGeneration::DefNewGeneration(ReservedSpace rs,
   : Generation(rs, initial_size),
     _promotion_failed(false),
     _promo_failure_drain_in_progress(false),
+    _promote_children_in_progress(false),
     _string_dedup_requests()
 {
   MemRegion cmr((HeapWord*)_virtual_space.low(),
@@ -768,9 +798,25 @@ oop DefNewGeneration::copy_to_survivor_space(oop old) {
     // processing expects to refer to a from-space object.
     _string_dedup_requests.add(old);
   }
+
+  if (new_obj_is_tenured && SerialPromoteChildrenEagerly) {
+    promote_children(obj);
+  }
   return obj;
 }
 
+void DefNewGeneration::promote_children(oop obj) {
+  // Large object arrays would be iterated twice for little locality gain.
+  const size_t MaxParentWords = 64;
+  if (_promote_children_in_progress || obj->size() > MaxParentWords) {
+    return;
+  }
+  _promote_children_in_progress = true;
+  PromoteChildrenClosure cl(this);
+  obj->oop_iterate(&cl);
+  _promote_children_in_progress = false;
+}
+
 void DefNewGeneration::drain_promo_failure_scan_stack() {
   PromoteFailureClosure cl{this};
   while (!_promo_failure_scan_stack.is_empty()) {
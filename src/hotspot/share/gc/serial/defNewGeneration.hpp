@@ -102,6 +102,11 @@ class DefNewGeneration: public Generation {
   void drain_promo_failure_scan_stack(void);
   bool _promo_failure_drain_in_progress;
 
+  // Set while the children of a promoted object are being copied
+  // (SerialPromoteChildrenEagerly), so that their own children are not.
+  bool _promote_children_in_progress;
+  void promote_children(oop obj);
+
   // Performance Counters
   GenerationCounters*  _gen_counters;
   CSpaceCounters*      _eden_counters;
@@ -66,6 +66,7 @@
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/handles.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/java.hpp"
@@ -93,6 +94,7 @@ SerialHeap::SerialHeap() :
     _old_gen(nullptr),
     _rem_set(nullptr),
     _gc_policy_counters(new GCPolicyCounters("Copy:MSC", 2, 2)),
+    _safepoint_workers(nullptr),
     _young_manager(nullptr),
     _old_manager(nullptr),
     _is_heap_almost_full(false),
@@ -201,6 +203,11 @@ jint SerialHeap::initialize() {
   _young_gen = new DefNewGeneration(young_rs, NewSize, MinNewSize, MaxNewSize);
   _old_gen = new TenuredGeneration(old_rs, OldSize, MinOldSize, MaxOldSize, rem_set());
 
+  if (ParallelGCThreads > 1) {
+    _safepoint_workers = new WorkerThreads("Serial Safepoint Worker", ParallelGCThreads);
+    _safepoint_workers->initialize_workers();
+  }
+
   GCInitLogger::print();
 
   FullGCForwarding::initialize(_reserved);
@@ -711,6 +718,47 @@ void SerialHeap::object_iterate(ObjectClosure* cl) {
   _old_gen->object_iterate(cl);
 }
 
+// Hands out eden, the survivor spaces and the old gen blocks in turn, so that
+// the old gen, which is the bulk of a large heap, is walked by all workers.
+class SerialParallelObjectIterator : public ParallelObjectIteratorImpl {
+  static const size_t InvalidIndex = SIZE_MAX;
+  static const size_t EdenIndex = 0;
+  static const size_t SurvivorIndex = 1;
+  static const size_t NumNonOldGenClaims = 2;
+
+  SerialHeap* _heap;
+  volatile size_t _claimed_index;
+
+  size_t claim_and_get_block() {
+    size_t block_index = Atomic::fetch_then_add(&_claimed_index, 1u);
+    size_t num_claims = _heap->old_gen()->num_iterable_blocks() + NumNonOldGenClaims;
+    return block_index < num_claims ? block_index : InvalidIndex;
+  }
+
+public:
+  SerialParallelObjectIterator() :
+      _heap(SerialHeap::heap()),
+      _claimed_index(EdenIndex) {}
+
+  void object_iterate(ObjectClosure* cl, uint worker_id) override {
+    for (size_t block_index = claim_and_get_block();
+         block_index != InvalidIndex;
+         block_index = claim_and_get_block()) {
+      if (block_index == EdenIndex) {
+        _heap->young_gen()->eden()->object_iterate(cl);
+      } else if (block_index == SurvivorIndex) {
+        _heap->young_gen()->from()->object_iterate(cl);
+      } else {
+        _heap->old_gen()->object_iterate_block(cl, block_index - NumNonOldGenClaims);
+      }
+    }
+  }
+};
+
+ParallelObjectIteratorImpl* SerialHeap::parallel_object_iterator(uint thread_num) {
+  return new SerialParallelObjectIterator();
+}
+
 HeapWord* SerialHeap::block_start(const void* addr) const {
   assert(is_in_reserved(addr), "block_start of address outside of heap");
   if (_young_gen->is_in_reserved(addr)) {
@@ -798,6 +846,9 @@ void SerialHeap::print_gc_on(outputStream* st) const {
 }
 
 void SerialHeap::gc_threads_do(ThreadClosure* tc) const {
+  if (_safepoint_workers != nullptr) {
+    _safepoint_workers->threads_do(tc);
+  }
 }
 
 bool SerialHeap::print_location(outputStream* st, void* addr) const {
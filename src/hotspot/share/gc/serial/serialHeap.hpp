@@ -85,6 +85,11 @@ class SerialHeap : public CollectedHeap {
 
   GCPolicyCounters* _gc_policy_counters;
 
+  // Workers for non-GC safepoint operations that walk the heap, such as heap
+  // inspection and dumping. Only created with -XX:ParallelGCThreads=2 or more,
+  // Serial does not otherwise start GC threads.
+  WorkerThreads* _safepoint_workers;
+
   bool do_young_collection(bool clear_soft_refs);
 
   // Reserve aligned space for the heap as needed by the contained generations.
@@ -176,6 +181,9 @@ class SerialHeap : public CollectedHeap {
 
   // Iteration functions.
   void object_iterate(ObjectClosure* cl) override;
+  ParallelObjectIteratorImpl* parallel_object_iterator(uint thread_num) override;
+
+  WorkerThreads* safepoint_workers() override { return _safepoint_workers; }
 
   // A CollectedHeap is divided into a dense sequence of "blocks"; that is,
   // each address in the (reserved) heap is a member of exactly
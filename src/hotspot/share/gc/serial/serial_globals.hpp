@@ -35,6 +35,12 @@
           "When disabled, informs the GC to shrink the java heap directly"  \
           " to the target size at the next full GC rather than requiring"   \
           " smaller steps during multiple full GCs.")                       \
+                                                                            \
+  product(bool, SerialPromoteChildrenEagerly, false, EXPERIMENTAL,          \
+          "When an object is promoted during a young collection, copy "     \
+          "the young objects it references right away, so that those "      \
+          "promoted as well are placed next to their parent in the old "    \
+          "generation rather than in breadth-first order.")                 \
 
 // end of GC_SERIAL_FLAGS
 
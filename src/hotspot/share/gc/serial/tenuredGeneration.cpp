@@ -419,6 +419,29 @@ void TenuredGeneration::object_iterate(ObjectClosure* blk) {
   _the_space->object_iterate(blk);
 }
 
+size_t TenuredGeneration::num_iterable_blocks() const {
+  return (used() + IterateBlockSize - 1) / IterateBlockSize;
+}
+
+void TenuredGeneration::object_iterate_block(ObjectClosure* blk, size_t block_index) {
+  size_t block_word_size = IterateBlockSize / HeapWordSize;
+  assert((block_word_size % CardTable::card_size_in_words()) == 0,
+         "To ensure fast block_start calls");
+
+  HeapWord* begin = _the_space->bottom() + block_index * block_word_size;
+  HeapWord* end = MIN2(_the_space->top(), begin + block_word_size);
+
+  // Get object starting at or reaching into this block.
+  HeapWord* start = block_start(begin);
+  if (start < begin) {
+    start += cast_to_oop(start)->size();
+  }
+  // Iterate all objects until the end.
+  for (HeapWord* p = start; p < end; p += cast_to_oop(p)->size()) {
+    blk->do_object(cast_to_oop(p));
+  }
+}
+
 void TenuredGeneration::complete_loaded_archive_space(MemRegion archive_space) {
   // Create the BOT for the archive space.
   HeapWord* start = archive_space.start();
@@ -120,6 +120,12 @@ class TenuredGeneration: public Generation {
   // Iteration
   void object_iterate(ObjectClosure* blk);
 
+  // Iterate the objects starting in one IterateBlockSize bytes block, for
+  // parallel heap iteration.
+  static const size_t IterateBlockSize = 1024 * 1024;
+  size_t num_iterable_blocks() const;
+  void object_iterate_block(ObjectClosure* blk, size_t block_index);
+
   void complete_loaded_archive_space(MemRegion archive_space);
   inline void update_for_block(HeapWord* start, HeapWord* end);
 
@@ -24,6 +24,7 @@
 
 #include "gc/shared/allocTracer.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
 #if INCLUDE_JFR
@@ -59,3 +60,20 @@ void AllocTracer::send_allocation_requiring_gc_event(size_t size, uint gcId) {
     event.commit();
   }
 }
+
+void AllocTracer::send_tlab_refill_statistics(Thread* thread, unsigned refills, size_t allocated,
+                                              size_t refill_waste, size_t gc_waste,
+                                              unsigned slow_allocations, size_t desired_size) {
+  EventTLABRefillStatistics event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_endtime(JfrTicks::now());
+    event.set_thread(JFR_JVM_THREAD_ID(thread));
+    event.set_refills(refills);
+    event.set_allocated(allocated);
+    event.set_refillWaste(refill_waste);
+    event.set_gcWaste(gc_waste);
+    event.set_slowAllocations(slow_allocations);
+    event.set_desiredSize(desired_size);
+    event.commit();
+  }
+}
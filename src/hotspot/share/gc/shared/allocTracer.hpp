@@ -33,6 +33,9 @@ class AllocTracer : AllStatic {
     static void send_allocation_outside_tlab(Klass* klass, HeapWord* obj, size_t alloc_size, JavaThread* thread);
     static void send_allocation_in_new_tlab(Klass* klass, HeapWord* obj, size_t tlab_size, size_t alloc_size, JavaThread* thread);
     static void send_allocation_requiring_gc_event(size_t size, uint gcId);
+    static void send_tlab_refill_statistics(Thread* thread, unsigned refills, size_t allocated,
+                                            size_t refill_waste, size_t gc_waste,
+                                            unsigned slow_allocations, size_t desired_size);
 };
 
 #endif // SHARE_GC_SHARED_ALLOCTRACER_HPP
@@ -23,6 +23,7 @@
  */
 
 #include "compiler/compilerDefinitions.inline.hpp"
+#include "gc/shared/allocTracer.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "gc/shared/tlab_globals.hpp"
@@ -32,6 +33,7 @@
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/os.hpp"
 #include "runtime/perfData.hpp"
 #include "runtime/threadSMR.hpp"
 #include "utilities/copy.hpp"
@@ -54,7 +56,10 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _gc_waste(0),
   _slow_allocations(0),
   _allocated_size(0),
-  _allocation_fraction(TLABAllocationWeight) {
+  _allocation_fraction(TLABAllocationWeight),
+  _last_refill_nanos(0),
+  _allocated_before_last_refill(0),
+  _allocation_rate(TLABAllocationWeight) {
 
   // do nothing. TLABs must be inited by initialize() calls
 }
@@ -104,6 +109,13 @@ void ThreadLocalAllocBuffer::accumulate_and_reset_statistics(ThreadLocalAllocSta
                                    _allocated_size,
                                    _gc_waste,
                                    _refill_waste);
+
+    AllocTracer::send_tlab_refill_statistics(thr, _number_of_refills,
+                                             _allocated_size * HeapWordSize,
+                                             _refill_waste * HeapWordSize,
+                                             _gc_waste * HeapWordSize,
+                                             _slow_allocations,
+                                             desired_size() * HeapWordSize);
   } else {
     assert(_number_of_refills == 0 && _refill_waste == 0 && _gc_waste == 0,
            "tlab stats == 0");
@@ -164,6 +176,43 @@ void ThreadLocalAllocBuffer::resize() {
   set_refill_waste_limit(initial_refill_waste_limit());
 }
 
+// Sample the rate at which the thread allocated since the last refill, and
+// size the next TLAB so that, at that rate, the thread refills it about
+// target_refills() times between GCs. Unlike resize(), which only runs at
+// GC, this follows threads whose allocation comes in bursts.
+void ThreadLocalAllocBuffer::sample_allocation_rate() {
+  Thread* thr = thread();
+  const jlong now = os::javaTimeNanos();
+  const size_t total_allocated = thr->allocated_bytes();
+  const jlong elapsed = now - _last_refill_nanos;
+  const size_t allocated = total_allocated - _allocated_before_last_refill;
+  const bool first_refill = _last_refill_nanos == 0;
+  _last_refill_nanos = now;
+  _allocated_before_last_refill = total_allocated;
+
+  if (first_refill || elapsed <= 0) {
+    return;
+  }
+  _allocation_rate.sample((float)(allocated / ((double)elapsed / NANOSECS_PER_MILLISEC)));
+
+  const double gc_interval_ms = ThreadLocalAllocStats::gc_interval_ms_avg();
+  if (gc_interval_ms <= 0.0) {
+    // No GC yet, keep the initial size.
+    return;
+  }
+  const double refill_interval_ms = gc_interval_ms / _target_refills;
+  const size_t new_size = (size_t)(_allocation_rate.average() * refill_interval_ms) / HeapWordSize;
+  const size_t aligned_new_size = align_object_size(clamp(new_size, min_size(), max_size()));
+
+  log_trace(gc, tlab)("TLAB new size: thread: " PTR_FORMAT " [id: %2d]"
+                      " rate: %8.1fKB/ms refill interval: %.1fms desired_size: %zu -> %zu",
+                      p2i(thr), thr->osthread()->thread_id(),
+                      _allocation_rate.average() / K, refill_interval_ms,
+                      desired_size(), aligned_new_size);
+
+  set_desired_size(aligned_new_size);
+}
+
 void ThreadLocalAllocBuffer::reset_statistics() {
   _number_of_refills = 0;
   _refill_waste      = 0;
@@ -180,6 +229,10 @@ void ThreadLocalAllocBuffer::fill(HeapWord* start,
   print_stats("fill");
   assert(top <= start + new_size - alignment_reserve(), "size too small");
 
+  if (ResizeTLAB && TLABSizeFromAllocationRate) {
+    sample_allocation_rate();
+  }
+
   initialize(start, top, start + new_size - alignment_reserve());
 
   // Reset amount of internal fragmentation
@@ -336,6 +389,8 @@ PerfVariable* ThreadLocalAllocStats::_perf_max_refill_waste;
 PerfVariable* ThreadLocalAllocStats::_perf_total_slow_allocations;
 PerfVariable* ThreadLocalAllocStats::_perf_max_slow_allocations;
 AdaptiveWeightedAverage ThreadLocalAllocStats::_allocating_threads_avg(0);
+AdaptiveWeightedAverage ThreadLocalAllocStats::_gc_interval_avg(0);
+jlong ThreadLocalAllocStats::_last_publish_nanos = 0;
 
 static PerfVariable* create_perf_variable(const char* name, PerfData::Units unit, TRAPS) {
   ResourceMark rm;
@@ -345,6 +400,7 @@ static PerfVariable* create_perf_variable(const char* name, PerfData::Units unit
 void ThreadLocalAllocStats::initialize() {
   _allocating_threads_avg = AdaptiveWeightedAverage(TLABAllocationWeight);
   _allocating_threads_avg.sample(1); // One allocating thread at startup
+  _gc_interval_avg = AdaptiveWeightedAverage(TLABAllocationWeight);
 
   if (UsePerfData) {
     EXCEPTION_MARK;
@@ -377,6 +433,10 @@ unsigned int ThreadLocalAllocStats::allocating_threads_avg() {
   return MAX2((unsigned int)(_allocating_threads_avg.average() + 0.5), 1U);
 }
 
+double ThreadLocalAllocStats::gc_interval_ms_avg() {
+  return _gc_interval_avg.average();
+}
+
 void ThreadLocalAllocStats::update_fast_allocations(unsigned int refills,
                                        size_t allocations,
                                        size_t gc_waste,
@@ -429,6 +489,12 @@ void ThreadLocalAllocStats::publish() {
 
   _allocating_threads_avg.sample(_allocating_threads);
 
+  const jlong now = os::javaTimeNanos();
+  if (_last_publish_nanos != 0) {
+    _gc_interval_avg.sample((float)((double)(now - _last_publish_nanos) / NANOSECS_PER_MILLISEC));
+  }
+  _last_publish_nanos = now;
+
   const size_t waste = _total_gc_waste + _total_refill_waste;
   const double waste_percent = percent_of(waste, _total_allocations);
   log_debug(gc, tlab)("TLAB totals: thrds: %d  refills: %d max: %d"
@@ -69,6 +69,12 @@ class ThreadLocalAllocBuffer: public CHeapObj<mtThread> {
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
+  jlong     _last_refill_nanos;                  // time of the last refill
+  size_t    _allocated_before_last_refill;       // total bytes allocated up until the last refill
+  AdaptiveWeightedAverage _allocation_rate;      // bytes allocated per millisecond between refills
+
+  void sample_allocation_rate();
+
   void reset_statistics();
 
   void set_start(HeapWord* start)                { _start = start; }
@@ -199,6 +205,9 @@ class ThreadLocalAllocStats : public StackObj {
   static PerfVariable* _perf_total_slow_allocations;
   static PerfVariable* _perf_max_slow_allocations;
 
+  static AdaptiveWeightedAverage _gc_interval_avg;
+  static jlong _last_publish_nanos;
+
   static AdaptiveWeightedAverage _allocating_threads_avg;
 
   unsigned int _allocating_threads;
@@ -215,6 +224,8 @@ class ThreadLocalAllocStats : public StackObj {
 public:
   static void initialize();
   static unsigned int allocating_threads_avg();
+  // Average time between GCs that retired TLABs, in milliseconds.
+  static double gc_interval_ms_avg();
 
   ThreadLocalAllocStats();
 
@@ -62,6 +62,11 @@
           "Size of old gen promotion LAB's (in HeapWords)")                 \
           constraint(OldPLABSizeConstraintFunc,AfterMemoryInit)             \
                                                                             \
+  product(bool, TLABSizeFromAllocationRate, false, EXPERIMENTAL,            \
+          "Size each thread's TLAB from an average of its allocation rate " \
+          "between refills, so that it is refilled as often between GCs "   \
+          "as TLABWasteTargetPercent allows")                               \
+                                                                            \
   product(uintx, TLABAllocationWeight, 35,                                  \
           "Allocation averaging weight")                                    \
           range(0, 100)                                                     \
@@ -33,6 +33,7 @@
 #include "gc/shenandoah/shenandoahOldGeneration.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.hpp"
 #include "gc/shenandoah/shenandoahSimpleBitMap.inline.hpp"
+#include "gc/shenandoah/shenandoahThreadLocalData.hpp"
 #include "gc/shenandoah/shenandoahYoungGeneration.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -891,6 +892,38 @@ HeapWord* ShenandoahFreeSet::allocate_from_regions(Iter& iterator, ShenandoahAll
 }
 
 HeapWord* ShenandoahFreeSet::allocate_for_collector(ShenandoahAllocRequest &req, bool &in_new_region) {
+  // Each thread returns to the region it allocated in last. With many workers refilling their LABs,
+  // this keeps the heap lock hold time independent of how many partially used collector regions
+  // lie before the bias end, and keeps the copies made by one worker together.
+  Thread* const thread = Thread::current();
+  HeapWord* result = allocate_in_affine_region(thread, req, in_new_region);
+  if (result == nullptr) {
+    result = allocate_for_collector_from_partitions(req, in_new_region);
+    if (result != nullptr) {
+      ShenandoahThreadLocalData::set_gc_alloc_region(thread, checked_cast<ssize_t>(_heap->heap_region_index_containing(result)));
+    }
+  }
+  return result;
+}
+
+HeapWord* ShenandoahFreeSet::allocate_in_affine_region(Thread* thread, ShenandoahAllocRequest& req, bool& in_new_region) {
+  shenandoah_assert_heaplocked();
+  const ssize_t idx = ShenandoahThreadLocalData::gc_alloc_region(thread);
+  if (idx < 0) {
+    return nullptr;
+  }
+
+  // The region may have been retired, flipped or recycled since this thread last used it.
+  const ShenandoahFreeSetPartitionId which_partition = req.is_old() ? ShenandoahFreeSetPartitionId::OldCollector : ShenandoahFreeSetPartitionId::Collector;
+  ShenandoahHeapRegion* const r = _heap->get_region(idx);
+  if (!_partitions.in_free_set(which_partition, idx) || r->affiliation() != req.affiliation()) {
+    return nullptr;
+  }
+
+  return try_allocate_in(r, req, in_new_region);
+}
+
+HeapWord* ShenandoahFreeSet::allocate_for_collector_from_partitions(ShenandoahAllocRequest &req, bool &in_new_region) {
   // Fast-path: try to allocate in the collector view first
   HeapWord* result;
   result = allocate_from_partition_with_affiliation(req.affiliation(), req, in_new_region);
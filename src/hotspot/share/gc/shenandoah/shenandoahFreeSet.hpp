@@ -372,6 +372,12 @@ class ShenandoahFreeSet : public CHeapObj<mtGC> {
   // Handle allocation for collector (for evacuation).
   HeapWord* allocate_for_collector(ShenandoahAllocRequest& req, bool& in_new_region);
 
+  // Try to satisfy a collector allocation in the region the current thread allocated in last.
+  HeapWord* allocate_in_affine_region(Thread* thread, ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Search the collector partitions, and the mutator partition if overflow is allowed.
+  HeapWord* allocate_for_collector_from_partitions(ShenandoahAllocRequest& req, bool& in_new_region);
+
   // Search for allocation in region with same affiliation as request, using given iterator.
   template<typename Iter>
   HeapWord* allocate_with_affiliation(Iter& iterator, ShenandoahAffiliation affiliation, ShenandoahAllocRequest& req, bool& in_new_region);
@@ -659,7 +659,17 @@ void ShenandoahGenerationalHeap::compute_old_generation_balance(size_t old_xfer_
 
   // Decide how much space we should reserve for promotions from young
   size_t reserve_for_promo = 0;
-  const size_t promo_load = old_generation()->get_promotion_potential();
+  size_t promo_load = old_generation()->get_promotion_potential();
+  if (ShenandoahPredictPromotionReserve) {
+    // The promotion potential only covers objects that were already old enough at the last mark. Objects
+    // aging into tenure at the next mark are only anticipated by the demand seen in recent cycles.
+    const size_t predicted = old_generation()->predicted_promotion_demand();
+    if (predicted > promo_load) {
+      log_debug(gc, ergo)("Predicted promotion demand " PROPERFMT " exceeds promotion potential " PROPERFMT,
+                          PROPERFMTARGS(predicted), PROPERFMTARGS(promo_load));
+      promo_load = predicted;
+    }
+  }
   const bool doing_promotions = promo_load > 0;
   if (doing_promotions) {
     // We're promoting and have a bound on the maximum amount that can be promoted
@@ -203,6 +203,8 @@ ShenandoahOldGeneration::ShenandoahOldGeneration(uint max_queues, size_t max_cap
     _region_balance(0),
     _promoted_reserve(0),
     _promoted_expended(0),
+    _promotion_failed_bytes(0),
+    _promotion_demand(10 /* length */, ShenandoahAdaptiveDecayFactor),
     _promotion_potential(0),
     _pad_for_promote_in_place(0),
     _promotable_humongous_regions(0),
@@ -241,9 +243,21 @@ void ShenandoahOldGeneration::augment_promoted_reserve(size_t increment) {
 
 void ShenandoahOldGeneration::reset_promoted_expended() {
   shenandoah_assert_heaplocked_or_safepoint();
+  // Whatever is left from the previous cycle is what it promoted, or tried to.
+  const size_t demand = Atomic::load(&_promoted_expended) + Atomic::load(&_promotion_failed_bytes);
+  _promotion_demand.add(double(demand));
+  Atomic::store(&_promotion_failed_bytes, (size_t) 0);
   Atomic::store(&_promoted_expended, (size_t) 0);
 }
 
+size_t ShenandoahOldGeneration::predicted_promotion_demand() const {
+  if (_promotion_demand.num() == 0) {
+    return 0;
+  }
+  // Pad the average by one deviation, so that a burst like the recent ones still fits.
+  return (size_t) (_promotion_demand.davg() + _promotion_demand.dsd());
+}
+
 size_t ShenandoahOldGeneration::expend_promoted(size_t increment) {
   shenandoah_assert_heaplocked_or_safepoint();
   assert(get_promoted_expended() + increment <= get_promoted_reserve(), "Do not expend more promotion than budgeted");
@@ -676,6 +690,8 @@ void ShenandoahOldGeneration::handle_failed_promotion(Thread* thread, size_t siz
   static size_t epoch_report_count = 0;
   auto heap = ShenandoahGenerationalHeap::heap();
 
+  Atomic::add(&_promotion_failed_bytes, size * HeapWordSize, memory_order_relaxed);
+
   size_t promotion_reserve;
   size_t promotion_expended;
 
@@ -31,6 +31,7 @@
 #include "gc/shenandoah/shenandoahGenerationalHeap.hpp"
 #include "gc/shenandoah/shenandoahScanRemembered.hpp"
 #include "gc/shenandoah/shenandoahSharedVariables.hpp"
+#include "utilities/numberSeq.hpp"
 
 class ShenandoahHeapRegion;
 class ShenandoahHeapRegionClosure;
@@ -65,6 +66,15 @@ class ShenandoahOldGeneration : public ShenandoahGeneration {
   // remaining in a PLAB when it is retired.
   size_t _promoted_expended;
 
+  // Bytes of promotions that failed for lack of old-gen memory during the current cycle. This
+  // is updated concurrently by the threads failing to promote, through atomic operations.
+  size_t _promotion_failed_bytes;
+
+  // Promotion demand (expended plus failed bytes) of recent cycles. This is sampled each time
+  // the promotion expenditure is reset and feeds the reserve prediction made when
+  // ShenandoahPredictPromotionReserve is enabled.
+  TruncatedSeq _promotion_demand;
+
   // Represents the quantity of live bytes we expect to promote in place during the next
   // evacuation cycle. This value is used by the young heuristic to trigger mixed collections.
   // It is also used when computing the optimum size for the old generation.
@@ -119,6 +129,9 @@ class ShenandoahOldGeneration : public ShenandoahGeneration {
   // This is used on the allocation path to gate promotions that would exceed the reserve
   size_t get_promoted_expended() const;
 
+  // The promotion demand expected for the next cycle, derived from the demand of recent cycles
+  size_t predicted_promotion_demand() const;
+
   // Test if there is enough memory reserved for this promotion
   bool can_promote(size_t requested_bytes) const {
     size_t promotion_avail = get_promoted_reserve();
@@ -37,6 +37,7 @@ ShenandoahThreadLocalData::ShenandoahThreadLocalData() :
   _card_table(nullptr),
   _gclab(nullptr),
   _gclab_size(0),
+  _gc_alloc_region(-1),
   _paced_time(0),
   _plab(nullptr),
   _plab_desired_size(0),
@@ -58,6 +58,10 @@ class ShenandoahThreadLocalData {
   PLAB* _gclab;
   size_t _gclab_size;
 
+  // Index of the collector region this thread last allocated a GCLAB, PLAB or shared
+  // GC object in, or -1. The free set tries this region first on the next request.
+  ssize_t _gc_alloc_region;
+
   double _paced_time;
 
   // Thread-local allocation buffer only used in generational mode.
@@ -160,6 +164,14 @@ class ShenandoahThreadLocalData {
     data(thread)->_gclab_size = v;
   }
 
+  static ssize_t gc_alloc_region(Thread* thread) {
+    return data(thread)->_gc_alloc_region;
+  }
+
+  static void set_gc_alloc_region(Thread* thread, ssize_t idx) {
+    data(thread)->_gc_alloc_region = idx;
+  }
+
   static void begin_evacuation(Thread* thread, size_t bytes, ShenandoahAffiliation from, ShenandoahAffiliation to) {
     data(thread)->_evacuation_stats->begin_evacuation(bytes, from, to);
   }
@@ -367,6 +367,13 @@
           "failures, which will trigger stop-the-world Full GC passes.")    \
           range(1.0,100.0)                                                  \
                                                                             \
+  product(bool, ShenandoahPredictPromotionReserve, false, EXPERIMENTAL,     \
+          "Size the old generation promotion reserve from a decaying "      \
+          "average of the bytes promoted, or that failed to promote, "      \
+          "in recent cycles, in addition to the promotion potential "       \
+          "found by the last mark. This anticipates bursts of "             \
+          "promotion that would otherwise end in degenerated cycles.")      \
+                                                                            \
   product(bool, ShenandoahEvacReserveOverflow, true, EXPERIMENTAL,          \
           "Allow evacuations to overflow the reserved space. Enabling it "  \
           "will make evacuations more resilient when evacuation "           \
@@ -76,7 +76,7 @@ class ZAllocatorForRelocation : public ZAllocator {
   zaddress alloc_object(size_t size);
   void undo_alloc_object(zaddress addr, size_t size);
 
-  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags);
+  ZPage* alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id);
 };
 
 #endif // SHARE_GC_Z_ZALLOCATOR_HPP
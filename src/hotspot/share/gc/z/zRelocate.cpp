@@ -33,6 +33,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -50,6 +51,7 @@
 #include "utilities/debug.hpp"
 
 static const ZStatCriticalPhase ZCriticalPhaseRelocationStall("Relocation Stall");
+static const ZStatCounter ZCounterRelocationRemoteTargetPage("Memory", "Relocation Remote Target Page", ZStatUnitOpsPerSecond);
 static const ZStatSubPhase ZSubPhaseConcurrentRelocateRememberedSetFlipPromotedYoung("Concurrent Relocate Remset FP", ZGenerationId::young);
 
 ZRelocateQueue::ZRelocateQueue()
@@ -385,7 +387,28 @@ zaddress ZRelocate::forward_object(ZForwarding* forwarding, zaddress_unsafe from
   return to_addr;
 }
 
-static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size) {
+static uint32_t preferred_numa_id(ZForwarding* forwarding) {
+  // Keep relocated objects on the NUMA node their page lived on, so
+  // that threads accessing them do not start paying for remote memory.
+  // Pages spanning several partitions have no single home node.
+  const ZPage* const page = forwarding->page();
+  if (!ZNUMA::is_enabled() || page->is_multi_partition()) {
+    return ZNUMA::id();
+  }
+
+  return page->single_partition_id();
+}
+
+// Target pages are kept per NUMA node and relocation age
+static size_t target_index(uint32_t numa_id, ZPageAge age) {
+  return numa_id * ZAllocator::_relocation_allocators + untype(age - 1);
+}
+
+static size_t target_count() {
+  return ZNUMA::count() * ZAllocator::_relocation_allocators;
+}
+
+static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZForwarding* forwarding, uint32_t numa_id) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -396,7 +419,13 @@ static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, siz
   flags.set_non_blocking();
   flags.set_gc_relocation();
 
-  return allocator->alloc_page_for_relocation(type, size, flags);
+  ZPage* const page = allocator->alloc_page_for_relocation(forwarding->type(), forwarding->size(), flags, numa_id);
+  if (page != nullptr && ZNUMA::is_enabled() &&
+      (page->is_multi_partition() || page->single_partition_id() != numa_id)) {
+    ZStatInc(ZCounterRelocationRemoteTargetPage);
+  }
+
+  return page;
 }
 
 static void retire_target_page(ZGeneration* generation, ZPage* page) {
@@ -425,9 +454,9 @@ class ZRelocateSmallAllocator {
     : _generation(generation),
       _in_place_count(0) {}
 
-  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
+  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, uint32_t numa_id, ZPage* target) {
     ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+    ZPage* const page = alloc_page(allocator, forwarding, numa_id);
     if (page == nullptr) {
       Atomic::inc(&_in_place_count);
     }
@@ -440,7 +469,7 @@ class ZRelocateSmallAllocator {
     return page;
   }
 
-  void share_target_page(ZPage* page) {
+  void share_target_page(uint32_t numa_id, ZPage* page) {
     // Does nothing
   }
 
@@ -467,7 +496,7 @@ class ZRelocateMediumAllocator {
 private:
   ZGeneration* const _generation;
   ZConditionLock     _lock;
-  ZPage*             _shared[ZAllocator::_relocation_allocators];
+  ZPage** const      _shared;
   bool               _in_place;
   volatile size_t    _in_place_count;
 
@@ -475,27 +504,32 @@ class ZRelocateMediumAllocator {
   ZRelocateMediumAllocator(ZGeneration* generation)
     : _generation(generation),
       _lock(),
-      _shared(),
+      _shared(NEW_C_HEAP_ARRAY(ZPage*, target_count(), mtGC)),
       _in_place(false),
-      _in_place_count(0) {}
+      _in_place_count(0) {
+    for (size_t i = 0; i < target_count(); ++i) {
+      _shared[i] = nullptr;
+    }
+  }
 
   ~ZRelocateMediumAllocator() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    for (size_t i = 0; i < target_count(); ++i) {
       if (_shared[i] != nullptr) {
         retire_target_page(_generation, _shared[i]);
       }
     }
+    FREE_C_HEAP_ARRAY(ZPage*, _shared);
   }
 
-  ZPage* shared(ZPageAge age) {
-    return _shared[untype(age - 1)];
+  ZPage* shared(uint32_t numa_id, ZPageAge age) {
+    return _shared[target_index(numa_id, age)];
   }
 
-  void set_shared(ZPageAge age, ZPage* page) {
-    _shared[untype(age - 1)] = page;
+  void set_shared(uint32_t numa_id, ZPageAge age, ZPage* page) {
+    _shared[target_index(numa_id, age)] = page;
   }
 
-  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
+  ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, uint32_t numa_id, ZPage* target) {
     ZLocker<ZConditionLock> locker(&_lock);
 
     // Wait for any ongoing in-place relocation to complete
@@ -508,10 +542,10 @@ class ZRelocateMediumAllocator {
     // current target page if another thread shared a page, or allocated
     // a new page.
     const ZPageAge to_age = forwarding->to_age();
-    if (shared(to_age) == target) {
+    if (shared(numa_id, to_age) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
-      set_shared(to_age, to_page);
+      ZPage* const to_page = alloc_page(allocator, forwarding, numa_id);
+      set_shared(numa_id, to_age, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
         _in_place = true;
@@ -523,18 +557,18 @@ class ZRelocateMediumAllocator {
       }
     }
 
-    return shared(to_age);
+    return shared(numa_id, to_age);
   }
 
-  void share_target_page(ZPage* page) {
+  void share_target_page(uint32_t numa_id, ZPage* page) {
     const ZPageAge age = page->age();
 
     ZLocker<ZConditionLock> locker(&_lock);
     assert(_in_place, "Invalid state");
-    assert(shared(age) == nullptr, "Invalid state");
+    assert(shared(numa_id, age) == nullptr, "Invalid state");
     assert(page != nullptr, "Invalid page");
 
-    set_shared(age, page);
+    set_shared(numa_id, age, page);
     _in_place = false;
 
     _lock.notify_all();
@@ -562,7 +596,8 @@ class ZRelocateWork : public StackObj {
 private:
   Allocator* const    _allocator;
   ZForwarding*        _forwarding;
-  ZPage*              _target[ZAllocator::_relocation_allocators];
+  uint32_t            _numa_id;
+  ZPage** const       _target;
   ZGeneration* const  _generation;
   size_t              _other_promoted;
   size_t              _other_compacted;
@@ -570,11 +605,11 @@ class ZRelocateWork : public StackObj {
 
 
   ZPage* target(ZPageAge age) {
-    return _target[untype(age - 1)];
+    return _target[target_index(_numa_id, age)];
   }
 
   void set_target(ZPageAge age, ZPage* page) {
-    _target[untype(age - 1)] = page;
+    _target[target_index(_numa_id, age)] = page;
   }
 
   size_t object_alignment() const {
@@ -892,7 +927,7 @@ class ZRelocateWork : public StackObj {
       // relocated as the new target, which will cause it to be relocated
       // in-place.
       const ZPageAge to_age = _forwarding->to_age();
-      ZPage* to_page = _allocator->alloc_and_retire_target_page(_forwarding, target(to_age));
+      ZPage* to_page = _allocator->alloc_and_retire_target_page(_forwarding, _numa_id, target(to_age));
       set_target(to_age, to_page);
       if (to_page != nullptr) {
         continue;
@@ -910,15 +945,21 @@ class ZRelocateWork : public StackObj {
   ZRelocateWork(Allocator* allocator, ZGeneration* generation)
     : _allocator(allocator),
       _forwarding(nullptr),
-      _target(),
+      _numa_id(0),
+      _target(NEW_C_HEAP_ARRAY(ZPage*, target_count(), mtGC)),
       _generation(generation),
       _other_promoted(0),
-      _other_compacted(0) {}
+      _other_compacted(0) {
+    for (size_t i = 0; i < target_count(); ++i) {
+      _target[i] = nullptr;
+    }
+  }
 
   ~ZRelocateWork() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    for (size_t i = 0; i < target_count(); ++i) {
       _allocator->free_target_page(_target[i]);
     }
+    FREE_C_HEAP_ARRAY(ZPage*, _target);
     // Report statistics on-behalf of non-worker threads
     _generation->increase_promoted(_other_promoted);
     _generation->increase_compacted(_other_compacted);
@@ -970,6 +1011,10 @@ class ZRelocateWork : public StackObj {
 
   void do_forwarding(ZForwarding* forwarding) {
     _forwarding = forwarding;
+    // Objects from pages on different NUMA nodes go to different target
+    // pages. Pick the node once, so that all target lookups for this
+    // forwarding agree.
+    _numa_id = preferred_numa_id(forwarding);
 
     _forwarding->page()->log_msg(" (relocate page)");
 
@@ -1012,7 +1057,7 @@ class ZRelocateWork : public StackObj {
 
       // Different pages when promoting
       ZPage* const target_page = target(_forwarding->to_age());
-      _allocator->share_target_page(target_page);
+      _allocator->share_target_page(_numa_id, target_page);
 
     } else {
       // Wait for all other threads to call release_page
@@ -25,6 +25,7 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -32,6 +33,9 @@
 #include "utilities/ostream.hpp"
 #include "utilities/vmError.hpp"
 
+static const ZStatCounter ZCounterStoreBarrierBufferFlush("Barrier", "Store Barrier Buffer Flush", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterStoreBarrierBufferFlushEntries("Barrier", "Store Barrier Buffer Flush Entries", ZStatUnitOpsPerSecond);
+
 ByteSize ZStoreBarrierEntry::p_offset() {
   return byte_offset_of(ZStoreBarrierEntry, _p);
 }
@@ -275,12 +279,19 @@ void ZStoreBarrierBuffer::flush() {
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
-  for (size_t i = current(); i < BufferLength; ++i) {
+  const size_t first = current();
+
+  for (size_t i = first; i < BufferLength; ++i) {
     const ZStoreBarrierEntry& entry = _buffer[i];
     const zaddress addr = ZBarrier::make_load_good(entry._prev);
     ZBarrier::mark_and_remember(entry._p, addr);
   }
 
+  if (first < BufferLength) {
+    ZStatInc(ZCounterStoreBarrierBufferFlush);
+    ZStatInc(ZCounterStoreBarrierBufferFlushEntries, BufferLength - first);
+  }
+
   clear();
 }
 
@@ -123,6 +123,7 @@ class BytecodePrinter {
     if (!TraceBytecodesTruncated || method_changed ||
         code == Bytecodes::_athrow ||
         code == Bytecodes::_return_register_finalizer ||
+        Bytecodes::is_fast_return(code) ||
         (code >= Bytecodes::_ireturn && code <= Bytecodes::_return)) {
       int bci = (int)(bcp - method->code_base());
       st->print("[%zu] ", Thread::current()->osthread()->thread_id_for_printing());
@@ -73,6 +73,14 @@
   def(_nofast_aload_0            , "nofast_aload_0"            , "b"    , nullptr    , T_OBJECT ,  1, true , _aload_0           ) \
   def(_nofast_iload              , "nofast_iload"              , "bi"   , nullptr    , T_INT    ,  1, false, _iload             ) \
                                                                                                                                   \
+  def(_fast_ireturn              , "fast_ireturn"              , "b"    , nullptr    , T_INT    , -1, true , _ireturn           ) \
+  def(_fast_lreturn              , "fast_lreturn"              , "b"    , nullptr    , T_LONG   , -2, true , _lreturn           ) \
+  def(_fast_freturn              , "fast_freturn"              , "b"    , nullptr    , T_FLOAT  , -1, true , _freturn           ) \
+  def(_fast_dreturn              , "fast_dreturn"              , "b"    , nullptr    , T_DOUBLE , -2, true , _dreturn           ) \
+  def(_fast_areturn              , "fast_areturn"              , "b"    , nullptr    , T_OBJECT , -1, true , _areturn           ) \
+  def(_fast_return               , "fast_return"               , "b"    , nullptr    , T_VOID   ,  0, true , _return            ) \
+  def(_fast_tailcall             , "fast_tailcall"             , "bJJ"  , nullptr    , T_ILLEGAL,  0, true , _invokestatic      ) \
+                                                                                                                                  \
   def(_shouldnotreachhere        , "_shouldnotreachhere"       , "b"    , nullptr    , T_VOID   ,  0, false, _shouldnotreachhere)
 
 #define BYTECODES_DO(def)                                                                                  \
@@ -301,6 +301,19 @@ class Bytecodes: AllStatic {
     _nofast_aload_0       ,          //  <- _aload_0
     _nofast_iload         ,          //  <- _iload
 
+    // Returns of methods carrying a FastReturn attribute and holding no
+    // monitors. Rewritten at link time; see Rewriter::rewrite_fast_returns.
+    _fast_ireturn         ,
+    _fast_lreturn         ,
+    _fast_freturn         ,
+    _fast_dreturn         ,
+    _fast_areturn         ,
+    _fast_return          ,
+
+    // Self-recursive invokestatic in tail position of such a method.
+    // Rewritten at link time; see Rewriter::rewrite_self_tail_calls.
+    _fast_tailcall        ,          //  <- _invokestatic
+
     _shouldnotreachhere   ,          // For debugging
 
 
@@ -418,6 +431,7 @@ class Bytecodes: AllStatic {
   static bool        is_zero_const  (Code code)    { return (code == _aconst_null || code == _iconst_0
                                                            || code == _fconst_0 || code == _dconst_0); }
   static bool        is_return      (Code code)    { return (_ireturn <= code && code <= _return); }
+  static bool        is_fast_return (Code code)    { return (_fast_ireturn <= code && code <= _fast_return); }
   static bool        is_invoke      (Code code)    { return (_invokevirtual <= code && code <= _invokedynamic); }
   static bool        is_field_code  (Code code)    { return (_getstatic <= java_code(code) && java_code(code) <= _putfield); }
   static bool        has_receiver   (Code code)    { assert(is_invoke(code), "");  return code == _invokevirtual ||
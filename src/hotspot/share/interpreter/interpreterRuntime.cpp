@@ -338,7 +338,11 @@ static Handle get_preinitialized_exception(Klass* k, TRAPS) {
   oop exception_oop = klass->allocate_instance(CHECK_(exception));
   exception = Handle(THREAD, exception_oop);
   if (StackTraceInThrowable) {
-    java_lang_Throwable::fill_in_stack_trace(exception);
+    if (klass == vmClasses::StackOverflowError_klass()) {
+      java_lang_Throwable::fill_in_stack_overflow_trace(exception);
+    } else {
+      java_lang_Throwable::fill_in_stack_trace(exception);
+    }
   }
   return exception;
 }
@@ -454,7 +458,6 @@ JRT_ENTRY(address, InterpreterRuntime::exception_handler_for_exception(JavaThrea
   LastFrameAccessor last_frame(current);
   Handle             h_exception(current, exception);
   methodHandle       h_method   (current, last_frame.method());
-  constantPoolHandle h_constants(current, h_method->constants());
   bool               should_repeat;
   int                handler_bci;
   int                current_bci = last_frame.bci();
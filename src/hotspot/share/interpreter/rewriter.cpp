@@ -368,6 +368,76 @@ void Rewriter::maybe_rewrite_ldc(address bcp, int offset, bool is_wide,
 }
 
 
+// Methods compiled from fastreturn statements carry a FastReturn attribute.
+// If such a method can never hold a monitor when it returns, its returns
+// are rewritten to _fast_*return bytecodes. The interpreter templates for
+// these skip the synchronized-method unlock and the monitor block scan in
+// remove_activation; everything else about the return is unchanged, so the
+// rewrite is invisible to Java semantics and is reverted by java_code().
+bool Rewriter::can_rewrite_fast_returns(Method* method) {
+  return RewriteBytecodes && RewriteFastReturns &&
+         method->has_fastreturn() &&
+         !method->has_monitors() &&
+         !method->has_jsrs() &&
+         !method->is_object_initializer();
+}
+
+void Rewriter::rewrite_fast_returns(const methodHandle& method) {
+  RawBytecodeStream bcs(method);
+  while (!bcs.is_last_bytecode()) {
+    Bytecodes::Code opcode = bcs.raw_next();
+    switch (opcode) {
+      case Bytecodes::_ireturn: *bcs.bcp() = Bytecodes::_fast_ireturn; break;
+      case Bytecodes::_lreturn: *bcs.bcp() = Bytecodes::_fast_lreturn; break;
+      case Bytecodes::_freturn: *bcs.bcp() = Bytecodes::_fast_freturn; break;
+      case Bytecodes::_dreturn: *bcs.bcp() = Bytecodes::_fast_dreturn; break;
+      case Bytecodes::_areturn: *bcs.bcp() = Bytecodes::_fast_areturn; break;
+      case Bytecodes::_return:  *bcs.bcp() = Bytecodes::_fast_return;  break;
+      default: break;
+    }
+  }
+}
+
+// A static FastReturn method that calls itself right before returning does
+// not need a new activation for that call. The _fast_tailcall template
+// overwrites the parameters with the outgoing arguments and restarts the
+// method at bci 0; it falls back to the plain invokestatic whenever the
+// real call is observable or compiled code is available. Exception handlers
+// would see the wrong activation, so methods with handlers are left alone.
+bool Rewriter::can_rewrite_self_tail_calls(Method* method) {
+  return RewriteBytecodes && OptimizeSelfTailCalls &&
+         method->has_fastreturn() &&
+         method->is_static() &&
+         !method->has_monitors() &&
+         !method->has_jsrs() &&
+         !method->has_exception_handler();
+}
+
+void Rewriter::rewrite_self_tail_calls(const methodHandle& method) {
+  Symbol* holder_name = method->method_holder()->name();
+  RawBytecodeStream bcs(method);
+  while (!bcs.is_last_bytecode()) {
+    Bytecodes::Code opcode = bcs.raw_next();
+    if (opcode != Bytecodes::_invokestatic || bcs.next_bci() >= method->code_size()) {
+      continue;
+    }
+    address next_bcp = method->bcp_from(bcs.next_bci());
+    if (!Bytecodes::is_return(Bytecodes::java_code(Bytecodes::code_at(method(), next_bcp)))) {
+      continue;
+    }
+    // The operand has already been rewritten to a method entry index.
+    address bcp = bcs.bcp();
+    int method_entry_index = Bytes::get_native_u2(bcp + 1);
+    int cp_index = _initialized_method_entries.at(method_entry_index).constant_pool_index();
+    if (_pool->klass_name_at(_pool->uncached_klass_ref_index_at(cp_index)) == holder_name &&
+        _pool->uncached_name_ref_at(cp_index) == method->name() &&
+        _pool->uncached_signature_ref_at(cp_index) == method->signature()) {
+      // Resolution of C.m from within C finds this very method.
+      (*bcp) = Bytecodes::_fast_tailcall;
+    }
+  }
+}
+
 // Rewrites a method given the index_map information
 void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* invokespecial_error) {
 
@@ -478,6 +548,11 @@ void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* i
       case Bytecodes::_invokehandle   : // if reverse=true
         rewrite_method_reference(bcp, prefix_length+1, reverse);
         break;
+      case Bytecodes::_fast_tailcall  : // if reverse=true
+        assert(reverse, "only produced by rewrite_self_tail_calls");
+        (*bcp) = Bytecodes::_invokestatic;
+        rewrite_method_reference(bcp, prefix_length+1, reverse);
+        break;
       case Bytecodes::_invokedynamic:
         rewrite_invokedynamic(bcp, prefix_length+1, reverse);
         break;
@@ -489,6 +564,17 @@ void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* i
       case Bytecodes::_fast_aldc_w:  // if reverse=true
         maybe_rewrite_ldc(bcp, prefix_length+1, true, reverse);
         break;
+      case Bytecodes::_fast_ireturn   : // fall through
+      case Bytecodes::_fast_lreturn   : // fall through
+      case Bytecodes::_fast_freturn   : // fall through
+      case Bytecodes::_fast_dreturn   : // fall through
+      case Bytecodes::_fast_areturn   : // fall through
+      case Bytecodes::_fast_return    : {
+        if (reverse) {
+          (*bcp) = Bytecodes::java_code(c);
+        }
+        break;
+      }
       case Bytecodes::_jsr            : // fall through
       case Bytecodes::_jsr_w          : nof_jsrs++;                   break;
       case Bytecodes::_monitorenter   : // fall through
@@ -508,6 +594,18 @@ void Rewriter::scan_method(Thread* thread, Method* method, bool reverse, bool* i
   if (nof_jsrs > 0) {
     method->set_has_jsrs();
   }
+
+#ifndef ZERO
+  if (!reverse && can_rewrite_fast_returns(method)) {
+    rewrite_fast_returns(methodHandle(thread, method));
+  }
+#endif
+
+#ifdef SUPPORT_INTERPRETER_TAIL_CALLS
+  if (!reverse && can_rewrite_self_tail_calls(method)) {
+    rewrite_self_tail_calls(methodHandle(thread, method));
+  }
+#endif
 }
 
 // After constant pool is created, revisit methods containing jsrs.
@@ -126,6 +126,10 @@ class Rewriter: public StackObj {
   void make_constant_pool_cache(TRAPS);
   void scan_method(Thread* thread, Method* m, bool reverse, bool* invokespecial_error);
   void rewrite_Object_init(const methodHandle& m, TRAPS);
+  static bool can_rewrite_fast_returns(Method* m);
+  void rewrite_fast_returns(const methodHandle& m);
+  static bool can_rewrite_self_tail_calls(Method* m);
+  void rewrite_self_tail_calls(const methodHandle& m);
   void rewrite_field_reference(address bcp, int offset, bool reverse);
   void rewrite_method_reference(address bcp, int offset, bool reverse);
   void rewrite_member_reference(address bcp, int offset, bool reverse);
@@ -496,6 +496,15 @@ void TemplateTable::initialize() {
   def(Bytecodes::_nofast_aload_0      , ____|____|clvm|____, vtos, atos, nofast_aload_0      ,  _           );
   def(Bytecodes::_nofast_iload        , ubcp|____|clvm|____, vtos, itos, nofast_iload        ,  _           );
 
+  def(Bytecodes::_fast_ireturn        , ____|disp|clvm|____, itos, itos, _return             , itos         );
+  def(Bytecodes::_fast_lreturn        , ____|disp|clvm|____, ltos, ltos, _return             , ltos         );
+  def(Bytecodes::_fast_freturn        , ____|disp|clvm|____, ftos, ftos, _return             , ftos         );
+  def(Bytecodes::_fast_dreturn        , ____|disp|clvm|____, dtos, dtos, _return             , dtos         );
+  def(Bytecodes::_fast_areturn        , ____|disp|clvm|____, atos, atos, _return             , atos         );
+  def(Bytecodes::_fast_return         , ____|disp|clvm|____, vtos, vtos, _return             , vtos         );
+
+  def(Bytecodes::_fast_tailcall       , ubcp|disp|clvm|____, vtos, vtos, fast_tailcall       , f1_byte      );
+
   def(Bytecodes::_shouldnotreachhere   , ____|____|____|____, vtos, vtos, shouldnotreachhere ,  _           );
 }
 
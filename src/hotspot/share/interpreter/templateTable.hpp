@@ -309,6 +309,7 @@ class TemplateTable: AllStatic {
   static void invokedynamic(int byte_no);
   static void invokehandle(int byte_no);
   static void fast_invokevfinal(int byte_no);
+  static void fast_tailcall(int byte_no);
 
   static void getfield_or_static(int byte_no, bool is_static, RewriteControl rc = may_rewrite);
   static void putfield_or_static(int byte_no, bool is_static, RewriteControl rc = may_rewrite);
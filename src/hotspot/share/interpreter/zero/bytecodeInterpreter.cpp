@@ -3076,6 +3076,20 @@ void BytecodeInterpreter::run(interpreterState istate) {
 
     DECACHE_STATE();
 
+    // Fast path for the common case: a normal return from a method that is not
+    // synchronized and holds no monitors, with no exception pending and no
+    // JVMTI exit event to post. There is nothing to check or unlock, so skip
+    // the handle setup and the monitor scan below.
+    if (istate->msg() != popping_frame && istate->msg() != early_return &&
+        !THREAD->has_pending_exception() &&
+        !THREAD->do_not_unlock_if_synchronized() &&
+        !METHOD->is_synchronized() &&
+        istate->monitor_base() == (BasicObjectLock*) istate->stack_base() &&
+        !(JVMTI_ENABLED && THREAD->is_interp_only_mode())) {
+      istate->set_msg(return_from_method);
+      UPDATE_PC_AND_RETURN(1);
+    }
+
     bool suppress_error = istate->msg() == popping_frame || istate->msg() == early_return;
     bool suppress_exit_event = THREAD->has_pending_exception() || istate->msg() == popping_frame;
     Handle original_exception(THREAD, THREAD->pending_exception());
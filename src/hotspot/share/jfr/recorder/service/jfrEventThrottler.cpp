@@ -37,6 +37,7 @@ constexpr static const JfrSamplerParams _disabled_params = {
 static JfrEventThrottler* _disabled_cpu_time_sample_throttler = nullptr;
 static JfrEventThrottler* _object_allocation_throttler = nullptr;
 static JfrEventThrottler* _safepoint_latency_throttler = nullptr;
+static JfrEventThrottler* _deep_recursion_throttler = nullptr;
 
 JfrEventThrottler::JfrEventThrottler(JfrEventId event_id) :
   JfrAdaptiveSampler(),
@@ -59,7 +60,12 @@ bool JfrEventThrottler::create() {
   }
   assert(_safepoint_latency_throttler == nullptr, "invariant");
   _safepoint_latency_throttler = new JfrEventThrottler(JfrSafepointLatencyEvent);
-  return _safepoint_latency_throttler != nullptr && _safepoint_latency_throttler->initialize();
+  if (_safepoint_latency_throttler == nullptr || !_safepoint_latency_throttler->initialize()) {
+    return false;
+  }
+  assert(_deep_recursion_throttler == nullptr, "invariant");
+  _deep_recursion_throttler = new JfrEventThrottler(JfrDeepRecursionEvent);
+  return _deep_recursion_throttler != nullptr && _deep_recursion_throttler->initialize();
 }
 
 void JfrEventThrottler::destroy() {
@@ -69,16 +75,20 @@ void JfrEventThrottler::destroy() {
   _object_allocation_throttler = nullptr;
   delete _safepoint_latency_throttler;
   _safepoint_latency_throttler = nullptr;
+  delete _deep_recursion_throttler;
+  _deep_recursion_throttler = nullptr;
 }
 
-// There is currently only two throttler instances, one for the jdk.ObjectAllocationSample event
-// and another for the SamplingLatency event.
+// There are currently three throttler instances, for the jdk.ObjectAllocationSample,
+// jdk.SafepointLatency and jdk.DeepRecursion events.
 // When introducing many more throttlers, consider adding a lookup map keyed by event id.
 JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
   assert(_disabled_cpu_time_sample_throttler != nullptr, "Disabled CPU time throttler has not been properly initialized");
   assert(_object_allocation_throttler != nullptr, "ObjectAllocation throttler has not been properly initialized");
   assert(_safepoint_latency_throttler != nullptr, "SafepointLatency throttler has not been properly initialized");
-  assert(event_id == JfrObjectAllocationSampleEvent || event_id == JfrSafepointLatencyEvent || event_id == JfrCPUTimeSampleEvent, "Event type has an unconfigured throttler");
+  assert(_deep_recursion_throttler != nullptr, "DeepRecursion throttler has not been properly initialized");
+  assert(event_id == JfrObjectAllocationSampleEvent || event_id == JfrSafepointLatencyEvent ||
+         event_id == JfrCPUTimeSampleEvent || event_id == JfrDeepRecursionEvent, "Event type has an unconfigured throttler");
   if (event_id == JfrObjectAllocationSampleEvent) {
     return _object_allocation_throttler;
   }
@@ -88,6 +98,9 @@ JfrEventThrottler* JfrEventThrottler::for_event(JfrEventId event_id) {
   if (event_id == JfrCPUTimeSampleEvent) {
     return _disabled_cpu_time_sample_throttler;
   }
+  if (event_id == JfrDeepRecursionEvent) {
+    return _deep_recursion_throttler;
+  }
   return nullptr;
 }
 
@@ -100,6 +113,11 @@ void JfrEventThrottler::configure(JfrEventId event_id, int64_t sample_size, int6
   if (event_id == JfrSafepointLatencyEvent) {
     assert(_safepoint_latency_throttler != nullptr, "SafepointLatency throttler has not been properly initialized");
     _safepoint_latency_throttler->configure(sample_size, period_ms);
+    return;
+  }
+  if (event_id == JfrDeepRecursionEvent) {
+    assert(_deep_recursion_throttler != nullptr, "DeepRecursion throttler has not been properly initialized");
+    _deep_recursion_throttler->configure(sample_size, period_ms);
   }
 }
 
@@ -46,6 +46,11 @@ class JfrStackFrame {
   JfrStackFrame(const traceid& id, int bci, u1 type, int lineno, const InstanceKlass* klass);
 
   bool equals(const JfrStackFrame& rhs) const;
+  traceid hash(traceid seed) const {
+    seed = (seed * 31) + _methodid;
+    seed = (seed * 31) + _bci;
+    return (seed * 31) + _type;
+  }
   void write(JfrChunkWriter& cw) const;
   void write(JfrCheckpointWriter& cpw) const;
   void resolve_lineno() const;
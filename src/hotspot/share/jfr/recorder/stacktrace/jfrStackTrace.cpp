@@ -36,6 +36,7 @@
 #include "oops/instanceKlass.inline.hpp"
 #include "runtime/continuation.hpp"
 #include "runtime/continuationEntry.inline.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/vframe.inline.hpp"
 #include "utilities/growableArray.hpp"
@@ -197,8 +198,12 @@ bool JfrStackTrace::record_inner(JavaThread* jt, const frame& frame, bool in_con
   if (_hash == 0) {
     _hash = 1;
   }
+  const int first_recorded = _frames->length();
+  // Folded frames do not count against the depth, but bound the walk.
+  const u4 max_folded = JfrFoldRecursiveFrames ? _max_frames * 8 : 0;
+  u4 folded = 0;
   while (!vfs.at_end()) {
-    if (_count >= _max_frames) {
+    if (_count >= _max_frames || folded > max_folded) {
       _reached_root = false;
       break;
     }
@@ -225,15 +230,41 @@ bool JfrStackTrace::record_inner(JavaThread* jt, const frame& frame, bool in_con
       // frame, so this frame is inlined into the caller.
       type = JfrStackFrame::FRAME_INLINE;
     }
-    _hash = (_hash * 31) + mid;
-    _hash = (_hash * 31) + bci;
-    _hash = (_hash * 31) + type;
     _frames->append(JfrStackFrame(mid, bci, type, method->method_holder()));
     _count++;
+    if (JfrFoldRecursiveFrames) {
+      folded += fold_recursion(first_recorded);
+    }
+  }
+  for (int i = first_recorded; i < _frames->length(); i++) {
+    _hash = _frames->at(i).hash(_hash);
   }
   return _count > 0;
 }
 
+// If the newest frames repeat the cycle of frames right before them,
+// drop the repetition and return the number of frames dropped. Only
+// frames recorded by this walk, from index first on, are considered.
+u4 JfrStackTrace::fold_recursion(int first) {
+  static const int max_cycle_length = 4;
+  const int length = _frames->length();
+  for (int cycle = 1; cycle <= max_cycle_length && length - 2 * cycle >= first; cycle++) {
+    bool repeated = true;
+    for (int i = length - cycle; i < length; i++) {
+      if (!_frames->at(i).equals(_frames->at(i - cycle))) {
+        repeated = false;
+        break;
+      }
+    }
+    if (repeated) {
+      _frames->trunc_to(length - cycle);
+      _count -= cycle;
+      return cycle;
+    }
+  }
+  return 0;
+}
+
 void JfrStackTrace::resolve_linenos() const {
   assert(!_lineno, "invariant");
   for (int i = 0; i < _frames->length(); i++) {
@@ -71,6 +71,7 @@ class JfrStackTrace : public JfrCHeapObj {
   bool have_lineno() const { return _lineno; }
   bool full_stacktrace() const { return _reached_root; }
   bool record_inner(JavaThread* jt, const frame& frame, bool in_continuation, int skip, int64_t stack_filter_id = -1);
+  u4 fold_recursion(int first);
   bool record(JavaThread* jt, const frame& frame, bool in_continuation, int skip, int64_t stack_filter_id = -1);
   void record_interpreter_top_frame(const JfrSampleRequest& request);
 
@@ -34,6 +34,7 @@
 #include "jfr/recorder/storage/jfrStorage.hpp"
 #include "jfr/recorder/storage/jfrStorageControl.hpp"
 #include "jfr/recorder/storage/jfrStorageUtils.inline.hpp"
+#include "jfr/support/jfrThreadLocal.hpp"
 #include "jfr/utilities/jfrIterator.hpp"
 #include "jfr/utilities/jfrLinkedList.inline.hpp"
 #include "jfr/utilities/jfrTime.hpp"
@@ -211,11 +212,15 @@ static void write_data_loss_event(JfrBuffer* buffer, u8 unflushed_size, Thread*
   assert(buffer != nullptr, "invariant");
   assert(buffer->empty(), "invariant");
   const u8 total_data_loss = thread->jfr_thread_local()->add_data_lost(unflushed_size);
+  const traceid tid = JfrThreadLocal::thread_id(thread);
+  log_debug(jfr, system)("Thread " UINT64_FORMAT " lost " UINT64_FORMAT " bytes of event data (" UINT64_FORMAT " in total)",
+                         (uint64_t)tid, unflushed_size, total_data_loss);
   if (EventDataLoss::is_enabled()) {
     JfrNativeEventWriter writer(buffer, thread);
     writer.begin_event_write(false);
     writer.write<u8>(EventDataLoss::eventId);
     writer.write(JfrTicks::now());
+    writer.write(tid);
     writer.write(unflushed_size);
     writer.write(total_data_loss);
     writer.end_event_write(false);
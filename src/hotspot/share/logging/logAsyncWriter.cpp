@@ -112,8 +112,14 @@ void AsyncLogWriter::enqueue_locked(LogFileStreamOutput* output, const LogDecora
   {
     ConsumerLocker clocker;
     if (_buffer->push_back(output, decorations, msg, msg_len)) {
-      _data_available = true;
-      clocker.notify();
+      // The consumer only waits while no data is available. If there
+      // already was data, it has been notified and will swap the buffer
+      // anyway; skip the notify so busy logsites don't pay for a wakeup
+      // per message.
+      if (!_data_available) {
+        _data_available = true;
+        clocker.notify();
+      }
       return;
     }
 
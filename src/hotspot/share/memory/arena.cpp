@@ -24,6 +24,7 @@
  */
 
 #include "compiler/compilationMemoryStatistic.hpp"
+#include "compiler/compilerThread.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/arena.hpp"
@@ -78,7 +79,7 @@ const char* Arena::tag_desc[] = {
 // NB: not using Mutex because pools are used before Threads are initialized
 class ChunkPool {
   // Our four static pools
-  static constexpr int _num_pools = 4;
+  static constexpr int _num_pools = RetainedChunks::num_pools;
   static ChunkPool _pools[_num_pools];
 
   Chunk*       _first;
@@ -115,6 +116,39 @@ class ChunkPool {
     _first = nullptr;
   }
 
+  int index() const { return (int)(this - _pools); }
+
+  // Takes a chunk from the thread's retained chunks, refilling them with a
+  // batch from this pool under a single lock when they run out.
+  Chunk* take_from_pool(RetainedChunks* retained) {
+    int i = index();
+    if (retained->pooled_count(i) == 0) {
+      ChunkPoolLocker lock;
+      for (int n = 0; n < RetainedChunks::pool_batch && _first != nullptr; n++) {
+        Chunk* c = _first;
+        _first = c->next();
+        retained->add_pooled(i, c);
+      }
+    }
+    return retained->take_pooled(i);
+  }
+
+  // Gives a chunk to the thread's retained chunks, spilling a batch back to
+  // this pool under a single lock when the thread keeps too many.
+  void return_to_pool(Chunk* chunk, RetainedChunks* retained) {
+    assert(chunk->length() == _size, "wrong pool for this chunk");
+    int i = index();
+    retained->add_pooled(i, chunk);
+    if (retained->pooled_count(i) > 2 * RetainedChunks::pool_batch) {
+      ChunkPoolLocker lock;
+      for (int n = 0; n < RetainedChunks::pool_batch; n++) {
+        Chunk* c = retained->take_pooled(i);
+        c->set_next(_first);
+        _first = c;
+      }
+    }
+  }
+
   // Given a (inner payload) size, return the pool responsible for it, or null if the size is non-standard
   static ChunkPool* get_pool_for_size(size_t size) {
     for (int i = 0; i < _num_pools; i++) {
@@ -148,6 +182,55 @@ static bool on_compiler_thread() {
   return false;
 }
 
+// The chunks kept by the current thread, or null if it keeps none.
+static RetainedChunks* retained_chunks() {
+#if defined(COMPILER1) || defined(COMPILER2)
+  if (CompilerThreadChunkCacheSize > 0 && on_compiler_thread()) {
+    return CompilerThread::current()->retained_chunks();
+  }
+#endif // COMPILER1 || COMPILER2
+  return nullptr;
+}
+
+Chunk* RetainedChunks::take(size_t length) {
+  for (Chunk** p = &_first; *p != nullptr; p = (*p)->next_addr()) {
+    Chunk* c = *p;
+    if (c->length() >= length && c->length() / 2 <= length) {
+      *p = c->next();
+      _bytes -= c->length();
+      return c;
+    }
+  }
+  return nullptr;
+}
+
+bool RetainedChunks::retain(Chunk* chunk) {
+  if (_bytes + chunk->length() > CompilerThreadChunkCacheSize) {
+    return false;
+  }
+  chunk->set_next(_first);
+  _first = chunk;
+  _bytes += chunk->length();
+  return true;
+}
+
+void RetainedChunks::release() {
+  // Free chunks under a lock so that NMT adjustment is stable.
+  ChunkPoolLocker lock;
+  while (_first != nullptr) {
+    Chunk* next = _first->next();
+    os::free(_first);
+    _first = next;
+  }
+  _bytes = 0;
+  for (int i = 0; i < num_pools; i++) {
+    Chunk* c;
+    while ((c = take_pooled(i)) != nullptr) {
+      os::free(c);
+    }
+  }
+}
+
 Chunk* ChunkPool::allocate_chunk(Arena* arena, size_t length, AllocFailType alloc_failmode) {
   // - requested_size = sizeof(Chunk)
   // - length = payload size
@@ -172,11 +255,21 @@ Chunk* ChunkPool::allocate_chunk(Arena* arena, size_t length, AllocFailType allo
   ChunkPool* pool = ChunkPool::get_pool_for_size(length);
   Chunk* chunk = nullptr;
   if (pool != nullptr) {
-    Chunk* c = pool->take_from_pool();
+    RetainedChunks* retained = retained_chunks();
+    Chunk* c = (retained != nullptr) ? pool->take_from_pool(retained) : pool->take_from_pool();
     if (c != nullptr) {
       assert(c->length() == length, "wrong length?");
       chunk = c;
     }
+  } else {
+    // Non-standard lengths may be served by a somewhat larger retained chunk.
+    RetainedChunks* retained = retained_chunks();
+    if (retained != nullptr) {
+      chunk = retained->take(length);
+      if (chunk != nullptr) {
+        length = chunk->length();
+      }
+    }
   }
   if (chunk == nullptr) {
     // Either the pool was empty, or this is a non-standard length. Allocate a new Chunk from C-heap.
@@ -213,8 +306,15 @@ void ChunkPool::deallocate_chunk(Chunk* c) {
 
   // If this is a standard-sized chunk, return it to its pool; otherwise free it.
   ChunkPool* pool = ChunkPool::get_pool_for_size(c->length());
+  RetainedChunks* retained = retained_chunks();
   if (pool != nullptr) {
-    pool->return_to_pool(c);
+    if (retained != nullptr) {
+      pool->return_to_pool(c, retained);
+    } else {
+      pool->return_to_pool(c);
+    }
+  } else if (retained != nullptr && retained->retain(c)) {
+    // Kept for the next compilation of this thread.
   } else {
     // Free chunks under a lock so that NMT adjustment is stable.
     ChunkPoolLocker lock;
@@ -341,7 +441,7 @@ void* Arena::grow(size_t x, AllocFailType alloc_failmode) {
   }
   _hwm  = _chunk->bottom();     // Save the cached hwm, max
   _max =  _chunk->top();
-  set_size_in_bytes(size_in_bytes() + len);
+  set_size_in_bytes(size_in_bytes() + _chunk->length()); // may exceed len for a retained chunk
   void* result = _hwm;
   _hwm += x;
   return result;
@@ -85,6 +85,7 @@ class Chunk {
 
   size_t length() const         { return _len;  }
   Chunk* next() const           { return _next;  }
+  Chunk** next_addr()           { return &_next; }
   void set_next(Chunk* n)       { _next = n;  }
   // Boundaries of data area (possibly unused)
   char* bottom() const          { return ((char*) this) + aligned_overhead_size();  }
@@ -95,6 +96,61 @@ class Chunk {
   uint64_t stamp() const     { return _stamp; }
 };
 
+// Large, non-standard sized chunks a thread keeps after its arenas are
+// done with them, up to CompilerThreadChunkCacheSize bytes. Compiler
+// threads use this so that compiling big methods does not malloc and free
+// chunks of the same sizes over and over. Only used by the owning thread.
+//
+// The thread also keeps a few standard sized chunks per ChunkPool, which
+// it takes from and gives back to the global pools in batches, so that
+// busy compiler threads do not contend on the ChunkPoolLocker.
+class RetainedChunks {
+ public:
+  static constexpr int num_pools = 4;
+  static constexpr int pool_batch = 4;
+
+ private:
+  Chunk* _first;
+  size_t _bytes;
+  Chunk* _pooled[num_pools];
+  int    _pooled_count[num_pools];
+
+ public:
+  NONCOPYABLE(RetainedChunks);
+
+  RetainedChunks() : _first(nullptr), _bytes(0), _pooled(), _pooled_count() {}
+  ~RetainedChunks() { release(); }
+
+  int pooled_count(int pool) const { return _pooled_count[pool]; }
+  inline Chunk* take_pooled(int pool);
+  inline void add_pooled(int pool, Chunk* chunk);
+
+  // Returns a chunk with a payload of at least length and at most twice
+  // that, or null.
+  Chunk* take(size_t length);
+  // Keeps the chunk if that stays within the budget, returns false otherwise.
+  bool retain(Chunk* chunk);
+  // Frees all retained chunks.
+  void release();
+
+  size_t bytes() const { return _bytes; }
+};
+
+inline Chunk* RetainedChunks::take_pooled(int pool) {
+  Chunk* c = _pooled[pool];
+  if (c != nullptr) {
+    _pooled[pool] = c->next();
+    _pooled_count[pool]--;
+  }
+  return c;
+}
+
+inline void RetainedChunks::add_pooled(int pool, Chunk* chunk) {
+  chunk->set_next(_pooled[pool]);
+  _pooled[pool] = chunk;
+  _pooled_count[pool]++;
+}
+
 // Arena types (for Compilation Memory Statistic)
 #define DO_ARENA_TAG(FN) \
   FN(ra,          Resource areas) \
@@ -597,6 +597,7 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   if (_freelist == nullptr) {
     b->set_link(nullptr);
     _freelist = b;
+    release_free_tail();
     return;
   }
 
@@ -608,6 +609,7 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
     b->set_link(_freelist);
     _freelist = b;
     merge_right(_freelist);
+    release_free_tail();
     return;
   }
 
@@ -630,6 +632,44 @@ void CodeHeap::add_to_freelist(HeapBlock* a) {
   assert((prev < b) && (cur == nullptr || b < cur), "free-list must be ordered");
   insert_after(prev, b);
   _last_insert_point = prev;
+  release_free_tail();
+}
+
+// If the highest block in the heap is free, give it back to the
+// unallocated space above _next_segment. Otherwise the free blocks
+// at the top of a long-running heap keep growing the address range
+// that holds live code, and large requests are served from there
+// instead of from contiguous space.
+void CodeHeap::release_free_tail() {
+  if (_next_segment == 0) {
+    return;
+  }
+  FreeBlock* last = (FreeBlock*)find_block_for(block_at(_next_segment - 1));
+  if (last == nullptr || !last->free()) {
+    return;
+  }
+  assert(last->link() == nullptr, "highest free block must be last in freelist");
+
+  // Unlink it. The freelist is ordered by address, so it is the last element.
+  if (_freelist == last) {
+    _freelist = nullptr;
+  } else {
+    FreeBlock* prev = _freelist;
+    while (prev->link() != last) {
+      prev = prev->link();
+      assert(prev != nullptr, "block must be in freelist");
+    }
+    prev->set_link(nullptr);
+  }
+
+  size_t beg = segment_for(last);
+  size_t len = last->length();
+  assert(beg + len == _next_segment, "must be the highest block");
+  _freelist_length--;
+  _freelist_segments -= len;
+  _next_segment = beg;
+  // _last_insert_point is re-validated via the segment map before use.
+  clear(beg, beg + len);
 }
 
 /**
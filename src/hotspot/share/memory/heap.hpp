@@ -137,6 +137,7 @@ class CodeHeap : public CHeapObj<mtCode> {
   FreeBlock* following_block(FreeBlock* b);
   void insert_after(FreeBlock* a, FreeBlock* b);
   bool merge_right (FreeBlock* a);
+  void release_free_tail();
 
   // Toplevel freelist management
   void add_to_freelist(HeapBlock* b);
@@ -93,9 +93,12 @@ class MallocHeader {
   const size_t _size;
   const uint32_t _mst_marker;
   const MemTag _mem_tag;
-  const uint8_t _unused;
+  const uint8_t _flags;
   uint16_t _canary;
 
+  // The block was recorded in the MallocSiteTable by NMT malloc site sampling
+  static const uint8_t _flag_sampled = 1;
+
   static const uint16_t _header_canary_live_mark = 0xE99E;
   static const uint16_t _header_canary_dead_mark = 0xD99D;
   static const uint16_t _footer_canary_live_mark = 0xE88E;
@@ -123,18 +126,20 @@ class MallocHeader {
     const size_t size;
     const MemTag mem_tag;
     const uint32_t mst_marker;
+    const bool sampled;
   };
 
-  inline MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker);
+  inline MallocHeader(size_t size, MemTag mem_tag, uint32_t mst_marker, bool sampled = false);
 
   inline static size_t malloc_overhead() { return sizeof(MallocHeader) + sizeof(uint16_t); }
   inline size_t size()  const { return _size; }
   inline MemTag mem_tag() const { return _mem_tag; }
   inline uint32_t mst_marker() const { return _mst_marker; }
+  inline bool is_sampled() const { return (_flags & _flag_sampled) != 0; }
 
   // Return the necessary data to deaccount the block with NMT.
   FreeInfo free_info() {
-    return FreeInfo{this->size(), this->mem_tag(), this->mst_marker()};
+    return FreeInfo{this->size(), this->mem_tag(), this->mst_marker(), this->is_sampled()};
   }
   inline void mark_block_as_dead();
   inline void revive();
@@ -155,6 +155,43 @@ bool MallocMemorySummary::category_limit_reached(MemTag mem_tag, size_t s, size_
   return true;
 }
 
+bool MallocTracker::_sampling = false;
+
+// Bytes the current thread may still malloc before its next sampled allocation.
+// Zero until the thread first allocates.
+static THREAD_LOCAL ssize_t _bytes_until_sample = 0;
+
+// Exponentially distributed with mean NativeMemorySampleInterval, so that each
+// malloced byte is equally likely to be sampled.
+static ssize_t next_sample_distance() {
+  double u = ((double)os::random() + 1.0) / ((double)max_jint + 2.0);
+  double distance = -log(u) * (double)NativeMemorySampleInterval;
+  return MAX2((ssize_t)1, (ssize_t)MIN2(distance, (double)(max_intx / 2)));
+}
+
+bool MallocTracker::should_sample(size_t size) {
+  ssize_t left = _bytes_until_sample;
+  if (left == 0) {
+    left = next_sample_distance();
+  }
+  left -= (ssize_t)size;
+  if (left > 0) {
+    _bytes_until_sample = left;
+    return false;
+  }
+  _bytes_until_sample = next_sample_distance();
+  return size > 0;
+}
+
+// A block of the given size is sampled with probability 1 - e^(-size / interval).
+// Scaling by the inverse of that makes the per-site sizes unbiased estimates.
+// This depends only on the size, so a block is deaccounted with the same
+// weight it was recorded with.
+size_t MallocTracker::sample_weight(size_t size) {
+  double p = -expm1(-(double)size / (double)NativeMemorySampleInterval);
+  return (size_t)((double)size / p);
+}
+
 bool MallocTracker::initialize(NMT_TrackingLevel level) {
   if (level >= NMT_summary) {
     MallocMemorySummary::initialize();
@@ -163,6 +200,9 @@ bool MallocTracker::initialize(NMT_TrackingLevel level) {
   if (level == NMT_detail) {
     return MallocSiteTable::initialize();
   }
+  if (level == NMT_summary && NativeMemorySampleInterval > 0) {
+    _sampling = MallocSiteTable::initialize();
+  }
   return true;
 }
 
@@ -175,12 +215,17 @@ void* MallocTracker::record_malloc(void* malloc_base, size_t size, MemTag mem_ta
 
   MallocMemorySummary::record_malloc(size, mem_tag);
   uint32_t mst_marker = 0;
+  bool sampled = false;
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::allocation_at(stack, size, &mst_marker, mem_tag);
+  } else if (_sampling && should_sample(size)) {
+    // Summary mode passes no stack; take one here, skipping this frame and os::malloc.
+    NativeCallStack sampled_stack(2);
+    sampled = MallocSiteTable::allocation_at(sampled_stack, sample_weight(size), &mst_marker, mem_tag);
   }
 
   // Uses placement global new operator to initialize malloc header
-  MallocHeader* const header = ::new (malloc_base)MallocHeader(size, mem_tag, mst_marker);
+  MallocHeader* const header = ::new (malloc_base)MallocHeader(size, mem_tag, mst_marker, sampled);
   void* const memblock = (void*)((char*)malloc_base + sizeof(MallocHeader));
 
   // The alignment check: 8 bytes alignment for 32 bit systems.
@@ -216,6 +261,8 @@ void MallocTracker::deaccount(MallocHeader::FreeInfo free_info) {
   MallocMemorySummary::record_free(free_info.size, free_info.mem_tag);
   if (MemTracker::tracking_level() == NMT_detail) {
     MallocSiteTable::deallocation_at(free_info.size, free_info.mst_marker);
+  } else if (free_info.sampled) {
+    MallocSiteTable::deallocation_at(sample_weight(free_info.size), free_info.mst_marker);
   }
 }
 
@@ -300,7 +347,7 @@ bool MallocTracker::print_pointer_information(const void* p, outputStream* st) {
                  (block->is_dead() ? "dead" : "live"),
                  p2i(block + 1), // lets print the payload start, not the header
                  block->size(), NMTUtil::tag_to_enum_name(block->mem_tag()));
-    if (MemTracker::tracking_level() == NMT_detail) {
+    if (MemTracker::tracking_level() == NMT_detail || block->is_sampled()) {
       NativeCallStack ncs;
       if (MallocSiteTable::access_stack(ncs, *block)) {
         ncs.print_on(st);
@@ -262,10 +262,20 @@ class MallocMemorySummary : AllStatic {
 
 // Main class called from MemTracker to track malloc activities
 class MallocTracker : AllStatic {
+  friend class NMTSamplingTest;
+
+  // True if summary tracking samples malloc sites, see NativeMemorySampleInterval
+  static bool _sampling;
+
+  static bool should_sample(size_t size);
+  static size_t sample_weight(size_t size);
+
  public:
   // Initialize malloc tracker for specific tracking level
   static bool initialize(NMT_TrackingLevel level);
 
+  static bool is_sampling() { return _sampling; }
+
   // The overhead that is incurred by switching on NMT (we need, per malloc allocation,
   // space for header and 16-bit footer)
   static inline size_t overhead_per_malloc() { return MallocHeader::malloc_overhead(); }
@@ -147,8 +147,7 @@ void MemBaseline::baseline_summary() {
   _metaspace_stats = MetaspaceUtils::get_combined_statistics();
 }
 
-bool MemBaseline::baseline_allocation_sites() {
-  // Malloc allocation sites
+bool MemBaseline::baseline_malloc_sites() {
   MallocAllocationSiteWalker malloc_walker;
   if (!MallocSiteTable::walk_malloc_site(&malloc_walker)) {
     return false;
@@ -157,6 +156,14 @@ bool MemBaseline::baseline_allocation_sites() {
   _malloc_sites.move(malloc_walker.malloc_sites());
   // The malloc sites are collected in size order
   _malloc_sites_order = by_size;
+  return true;
+}
+
+bool MemBaseline::baseline_allocation_sites() {
+  // Malloc allocation sites
+  if (!baseline_malloc_sites()) {
+    return false;
+  }
 
   // Virtual memory allocation sites
   VirtualMemoryAllocationWalker virtual_memory_walker;
@@ -187,10 +194,15 @@ void MemBaseline::baseline(bool summaryOnly) {
   _baseline_type = Summary_baselined;
 
   // baseline details
-  if (!summaryOnly &&
-      MemTracker::tracking_level() == NMT_detail) {
-    baseline_allocation_sites();
-    _baseline_type = Detail_baselined;
+  if (!summaryOnly) {
+    if (MemTracker::tracking_level() == NMT_detail) {
+      baseline_allocation_sites();
+      _baseline_type = Detail_baselined;
+    } else if (MallocTracker::is_sampling()) {
+      // Only malloc sites are sampled
+      baseline_malloc_sites();
+      _baseline_type = Detail_baselined;
+    }
   }
 }
 
@@ -194,6 +194,7 @@ class MemBaseline {
 
   // Baseline allocation sites (detail tracking only)
   bool baseline_allocation_sites();
+  bool baseline_malloc_sites();
 
   // Aggregate virtual memory allocation by allocation sites
   bool aggregate_virtual_memory_allocation_sites();
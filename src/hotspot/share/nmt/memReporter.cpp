@@ -313,6 +313,11 @@ void MemDetailReporter::report_detail() {
   // Start detail report
   outputStream* out = output();
   out->print_cr("Details:\n");
+  if (MallocTracker::is_sampling()) {
+    out->print_cr("(Malloc sites sampled about every %zu bytes; sizes and counts are estimates)",
+                  NativeMemorySampleInterval);
+    out->cr();
+  }
 
   int num_omitted =
       report_malloc_sites() +
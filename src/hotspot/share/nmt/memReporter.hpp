@@ -160,8 +160,10 @@ class MemDetailReporter : public MemSummaryReporter {
   // The report contains summary and detail sections.
   virtual void report() {
     MemSummaryReporter::report();
-    report_virtual_memory_map();
-    report_memory_file_allocations();
+    if (!MallocTracker::is_sampling()) {
+      report_virtual_memory_map();
+      report_memory_file_allocations();
+    }
     report_detail();
   }
 
@@ -116,7 +116,7 @@ void NMTDCmd::execute(DCmdSource source, TRAPS) {
     report(false, scale_unit);
   } else if (_baseline.value()) {
     MemBaseline& baseline = MemTracker::get_baseline();
-    baseline.baseline(MemTracker::tracking_level() != NMT_detail);
+    baseline.baseline(MemTracker::tracking_level() != NMT_detail && !MallocTracker::is_sampling());
     output()->print_cr("Baseline taken");
   } else if (_summary_diff.value()) {
     MemBaseline& baseline = MemTracker::get_baseline();
@@ -178,7 +178,7 @@ void NMTDCmd::report_diff(bool summaryOnly, size_t scale_unit) {
 }
 
 bool NMTDCmd::check_detail_tracking_level(outputStream* out) {
-  if (MemTracker::tracking_level() != NMT_detail) {
+  if (MemTracker::tracking_level() != NMT_detail && !MallocTracker::is_sampling()) {
     out->print_cr("Detail tracking is not enabled");
     return false;
   }
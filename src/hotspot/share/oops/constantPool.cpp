@@ -810,6 +810,7 @@ int ConstantPool::to_cp_index(int index, Bytecodes::Code code) {
     case Bytecodes::_invokestatic:
     case Bytecodes::_invokevirtual:
     case Bytecodes::_fast_invokevfinal: // Bytecode interpreter uses this
+    case Bytecodes::_fast_tailcall:
       return resolved_method_entry_at(index)->constant_pool_index();
     default:
       fatal("Unexpected bytecode: %s", Bytecodes::name(code));
@@ -982,6 +982,7 @@ bool InstanceKlass::link_class_impl(TRAPS) {
                              jt->get_thread_stat()->perf_recursion_counts_addr(),
                              jt->get_thread_stat()->perf_timers_addr(),
                              PerfClassTraceTime::CLASS_LINK);
+  EventClassLink link_event;
 
   // verification & rewriting
   {
@@ -1063,6 +1064,10 @@ bool InstanceKlass::link_class_impl(TRAPS) {
       if (JvmtiExport::should_post_class_prepare()) {
         JvmtiExport::post_class_prepare(THREAD, this);
       }
+      if (link_event.should_commit()) {
+        link_event.set_linkedClass(this);
+        link_event.commit();
+      }
     }
   }
   return true;
@@ -1318,7 +1323,12 @@ void InstanceKlass::initialize_impl(TRAPS) {
                                jt->get_thread_stat()->perf_recursion_counts_addr(),
                                jt->get_thread_stat()->perf_timers_addr(),
                                PerfClassTraceTime::CLASS_CLINIT);
+      EventClassInitialization event;
       call_class_initializer(THREAD);
+      if (event.should_commit()) {
+        event.set_initializedClass(this);
+        event.commit();
+      }
     } else {
       // The elapsed time is so small it's not worth counting.
       if (UsePerfData) {
@@ -2519,8 +2529,9 @@ inline DependencyContext InstanceKlass::dependencies() {
   return dep_context;
 }
 
-void InstanceKlass::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes) {
-  dependencies().mark_dependent_nmethods(deopt_scope, changes);
+void InstanceKlass::mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes,
+                                            CheckedNMethods* checked) {
+  dependencies().mark_dependent_nmethods(deopt_scope, changes, checked);
 }
 
 void InstanceKlass::add_dependent_nmethod(nmethod* nm) {
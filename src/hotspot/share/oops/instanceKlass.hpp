@@ -62,6 +62,7 @@ class RecordComponent;
 #if INCLUDE_JVMTI
 class BreakpointInfo;
 #endif
+class CheckedNMethods;
 class ClassFileParser;
 class ClassFileStream;
 class KlassDepChange;
@@ -837,7 +838,8 @@ class InstanceKlass: public Klass {
  public:
   // maintenance of deoptimization dependencies
   inline DependencyContext dependencies();
-  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes);
+  void mark_dependent_nmethods(DeoptimizationScope* deopt_scope, KlassDepChange& changes,
+                               CheckedNMethods* checked = nullptr);
   void add_dependent_nmethod(nmethod* nm);
   void clean_dependency_context();
   // Setup link to hierarchy and deoptimize
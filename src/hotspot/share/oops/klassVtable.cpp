@@ -194,13 +194,27 @@ void klassVtable::initialize_vtable(GrowableArray<InstanceKlass*>* supers) {
     int len = methods->length();
     int initialized = super_vtable_len;
 
+    // Every method below is matched by name against all inherited entries.
+    // Gather the inherited names once so that the scan does not have to
+    // chase Method* and ConstMethod* for each entry. Overriding an entry
+    // never changes its name, so the array stays valid while we update it.
+    ResourceMark rm(current);
+    Symbol** super_names = NEW_RESOURCE_ARRAY(Symbol*, super_vtable_len);
+    if (super_vtable_len > 0) {
+      klassVtable super_vtable = is_preinitialized_vtable() ? super->vtable() : *this;
+      for (int i = 0; i < super_vtable_len; i++) {
+        Method* m = super_vtable.unchecked_method_at(i);
+        super_names[i] = (m != nullptr) ? m->name() : nullptr;
+      }
+    }
+
     // Check each of this class's methods against super;
     // if override, replace in copy of super vtable, otherwise append to end
     for (int i = 0; i < len; i++) {
       // update_inherited_vtable can stop for gc - ensure using handles
       methodHandle mh(current, methods->at(i));
 
-      bool needs_new_entry = update_inherited_vtable(current, mh, super_vtable_len, -1, supers);
+      bool needs_new_entry = update_inherited_vtable(current, mh, super_vtable_len, -1, supers, super_names);
 
       if (needs_new_entry) {
         put_method_at(mh(), initialized);
@@ -225,7 +239,7 @@ void klassVtable::initialize_vtable(GrowableArray<InstanceKlass*>* supers) {
             // we're using it.
             methodHandle mh(current, default_methods->at(i));
             assert(!mh->is_private(), "private interface method in the default method list");
-            needs_new_entry = update_inherited_vtable(current, mh, super_vtable_len, i, supers);
+            needs_new_entry = update_inherited_vtable(current, mh, super_vtable_len, i, supers, super_names);
           }
 
           // needs new entry
@@ -382,7 +396,8 @@ static void log_vtables(int i, bool overrides, const methodHandle& target_method
 bool klassVtable::update_inherited_vtable(Thread* current,
                                           const methodHandle& target_method,
                                           int super_vtable_len, int default_index,
-                                          GrowableArray<InstanceKlass*>* supers) {
+                                          GrowableArray<InstanceKlass*>* supers,
+                                          Symbol** super_names) {
   bool allocate_new = true;
 
   InstanceKlass* klass = ik();
@@ -460,6 +475,9 @@ bool klassVtable::update_inherited_vtable(Thread* current,
 
   Symbol* target_classname = target_klass->name();
   for(int i = 0; i < super_vtable_len; i++) {
+    if (super_names[i] != name) {
+      continue;
+    }
     Method* super_method;
     if (is_preinitialized_vtable()) {
       // If this is a shared class, the vtable is already in the final state (fully
@@ -126,7 +126,8 @@ class klassVtable {
                                const methodHandle& target_method,
                                int super_vtable_len,
                                int default_index,
-                               GrowableArray<InstanceKlass*>* supers);
+                               GrowableArray<InstanceKlass*>* supers,
+                               Symbol** super_names);
  InstanceKlass* find_transitive_override(InstanceKlass* initialsuper,
                                          const methodHandle& target_method, int vtable_index,
                                          Handle target_loader, Symbol* target_classname);
@@ -238,6 +238,12 @@ int Method::fast_exception_handler_bci_for(const methodHandle& mh, Klass* ex_kla
     log_debug(exceptions)("Looking for catch handler for exception of type \"%s\" in method \"%s\"",
                           ex_klass == nullptr ? "null" : ex_klass->external_name(), mh->name()->as_C_string());
   }
+  // Exceptions unwinding through deep recursions of handler-free methods
+  // (e.g. FastReturn methods) come here once per frame, so don't touch the
+  // constant pool or the exception table unless there is one.
+  if (!mh->has_exception_handler()) {
+    return -1;
+  }
   // exception table holds quadruple entries of the form (beg_bci, end_bci, handler_bci, klass_index)
   // access exception table
   ExceptionTable table(mh());
@@ -795,6 +801,34 @@ bool Method::compute_has_loops_flag() {
   return false;
 }
 
+bool Method::compute_is_self_recursive_flag() {
+  methodHandle mh(Thread::current(), this);
+  BytecodeStream bcs(mh);
+  Bytecodes::Code bc;
+  bool recursive = false;
+
+  while (!recursive && (bc = bcs.next()) >= 0) {
+    switch (bc) {
+      case Bytecodes::_invokestatic:
+      case Bytecodes::_invokespecial:
+      case Bytecodes::_invokevirtual:
+      case Bytecodes::_invokeinterface: {
+        Bytecode_invoke invoke(mh, bcs.bci());
+        recursive = invoke.name() == name() &&
+                    invoke.signature() == signature() &&
+                    invoke.klass() == method_holder()->name();
+        break;
+      }
+      default:
+        break;
+    }
+  }
+
+  _flags.set_is_self_recursive_flag(recursive);
+  _flags.set_is_self_recursive_flag_init(true);
+  return recursive;
+}
+
 bool Method::is_final_method(AccessFlags class_access_flags) const {
   // or "does_not_require_vtable_entry"
   // default method or overpass can occur, is not final (reuses vtable entry)
@@ -560,6 +560,13 @@ class Method : public Metadata {
     return true;
   }
 
+  // returns true if the method has an invoke bytecode that names the method itself.
+  bool is_self_recursive() {
+    return is_self_recursive_flag_init() ? is_self_recursive_flag() : compute_is_self_recursive_flag();
+  };
+
+  bool compute_is_self_recursive_flag();
+
   // returns true if the method has any monitors.
   bool has_monitors() const                      { return is_synchronized() || has_monitor_bytecodes(); }
 
@@ -613,6 +620,7 @@ class Method : public Metadata {
   // interpreter support
   static ByteSize const_offset()                 { return byte_offset_of(Method, _constMethod       ); }
   static ByteSize access_flags_offset()          { return byte_offset_of(Method, _access_flags      ); }
+  static ByteSize flags_offset()                 { return byte_offset_of(Method, _flags             ); }
   static ByteSize from_compiled_offset()         { return byte_offset_of(Method, _from_compiled_entry); }
   static ByteSize code_offset()                  { return byte_offset_of(Method, _code); }
 
@@ -766,6 +774,10 @@ class Method : public Metadata {
   bool has_reserved_stack_access() const { return constMethod()->reserved_stack_access(); }
   void set_has_reserved_stack_access() { constMethod()->set_reserved_stack_access(); }
 
+  // True if the class file carried a FastReturn attribute for this method.
+  bool has_fastreturn() const { return constMethod()->has_fastreturn(); }
+  void set_has_fastreturn() { constMethod()->set_has_fastreturn(); }
+
   JFR_ONLY(DEFINE_TRACE_FLAG_ACCESSOR;)
 
   ConstMethod::MethodType method_type() const {
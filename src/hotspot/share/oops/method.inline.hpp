@@ -82,8 +82,9 @@ inline void CompressedLineNumberWriteStream::write_pair(int bci, int line) {
 inline bool Method::has_compiled_code() const { return code() != nullptr; }
 
 inline bool Method::is_empty_method() const {
+  // The Rewriter may have turned the return into a _fast_return
   return  code_size() == 1
-      && *code_base() == Bytecodes::_return;
+      && (*code_base() == Bytecodes::_return || *code_base() == Bytecodes::_fast_return);
 }
 
 inline bool Method::is_continuation_enter_intrinsic() const {
@@ -1421,6 +1421,9 @@ void MethodData::init() {
   _num_loops = 0;
   _num_blocks = 0;
   _would_profile = unknown;
+  for (int i = 0; i < recursion_depth_buckets; i++) {
+    _recursion_depth[i] = 0;
+  }
 
 #if INCLUDE_JVMCI
   _jvmci_ir_size = 0;
@@ -2130,6 +2130,15 @@ class MethodData : public Metadata {
   enum WouldProfile {unknown, no_profile, profile};
   WouldProfile      _would_profile;
 
+public:
+  // Recursion depth histogram, sampled on invocation counter overflow
+  // (see CompilationPolicy::sample_recursion_depth). Bucket i counts the
+  // samples that found i + 1 activations of the method on the stack; the
+  // last bucket also counts all deeper samples.
+  enum { recursion_depth_buckets = 5 };
+private:
+  uint              _recursion_depth[recursion_depth_buckets];
+
 #if INCLUDE_JVMCI
   // Support for HotSpotMethodData.setCompiledIRSize(int)
   FailedSpeculation* _failed_speculations;
@@ -2327,6 +2336,18 @@ class MethodData : public Metadata {
   int num_blocks() const                      { return _num_blocks; }
   void set_num_blocks(short n)                { _num_blocks = n;    }
 
+  uint recursion_depth_count(int bucket) const {
+    assert(bucket >= 0 && bucket < recursion_depth_buckets, "out of bounds");
+    return _recursion_depth[bucket];
+  }
+  void record_recursion_depth(int depth) {
+    assert(depth > 0, "the sampled method is on the stack");
+    uint* count = &_recursion_depth[MIN2(depth, (int)recursion_depth_buckets) - 1];
+    if (*count < max_juint) {
+      (*count)++;
+    }
+  }
+
   bool is_mature() const;
 
   // Support for interprocedural escape analysis, from Thomas Kotzmann.
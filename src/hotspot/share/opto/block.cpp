@@ -1489,7 +1489,7 @@ void UnionFind::Union( uint idx1, uint idx2 ) {
 
 #ifndef PRODUCT
 void Trace::dump( ) const {
-  tty->print_cr("Trace (freq %f)", first_block()->_freq);
+  tty->print_cr("Trace (freq %f)%s", first_block()->_freq, is_cold() ? " cold" : "");
   for (Block *b = first_block(); b != nullptr; b = next(b)) {
     tty->print("  B%d", b->_pre_order);
     if (b->head()->is_Loop()) {
@@ -1696,6 +1696,24 @@ void PhaseBlockLayout::grow_traces() {
   }
 }
 
+// Mark the traces that consist of uncommon blocks only, e.g. exception
+// paths, slow-path allocation and paths the profile says are rarely taken.
+// The connector trace and the entry trace are never cold.
+void PhaseBlockLayout::mark_cold_traces(int count) {
+  Trace* entry = trace(_cfg.get_root_block());
+  for (int i = 0; i < count; i++) {
+    Trace* tr = traces[i];
+    if (tr == nullptr || tr == entry || tr->first_block()->is_connector()) {
+      continue;
+    }
+    bool cold = true;
+    for (Block* b = tr->first_block(); b != nullptr && cold; b = tr->next(b)) {
+      cold = _cfg.is_uncommon(b);
+    }
+    tr->set_cold(cold);
+  }
+}
+
 // Embed one trace into another, if the fork or join points are sufficiently
 // balanced.
 void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
@@ -1717,6 +1735,13 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
     Trace *targ_trace  = trace(targ_block);
     bool targ_at_start = targ_trace->first_block() == targ_block;
 
+    if (!fall_thru_only && BlockLayoutSplitColdTraces &&
+        src_trace->is_cold() != targ_trace->is_cold()) {
+      // Keep cold traces apart so that reorder_traces() can move them out
+      // of the way of the rest of the code.
+      continue;
+    }
+
     if (src_trace == targ_trace) {
       // This may be a loop, but we can't do much about it.
       e->set_state(CFGEdge::interior);
@@ -1791,6 +1816,30 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  if (BlockLayoutSplitColdTraces) {
+    // Move the cold traces behind all other traces but the connector trace,
+    // keeping the frequency order within both groups.
+    Trace** cold_traces = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    int cold_count = 0;
+    int hot_count = 1;
+    int end = new_count;
+    if (new_traces[end - 1]->first_block()->is_connector()) {
+      end--;
+    }
+    for (int i = 1; i < end; i++) {
+      Trace* tr = new_traces[i];
+      if (tr->is_cold()) {
+        cold_traces[cold_count++] = tr;
+      } else {
+        new_traces[hot_count++] = tr;
+      }
+    }
+    for (int i = 0; i < cold_count; i++) {
+      new_traces[hot_count++] = cold_traces[i];
+    }
+    assert(hot_count == end, "lost traces");
+  }
+
   // Collect all blocks from existing Traces
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -1836,6 +1885,10 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   // This may make diamonds and other related shapes in a trace.
   merge_traces(true);
 
+  if (BlockLayoutSplitColdTraces) {
+    mark_cold_traces(size);
+  }
+
   // Run merge again, allowing two traces to be catenated, even if
   // one does not fall through into the other. This appends loosely
   // related traces to be near each other.
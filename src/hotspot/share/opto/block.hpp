@@ -815,6 +815,7 @@ class Trace : public ResourceObj {
   Block ** _prev_list;  // Array mapping index to previous block
   Block * _first;       // First block in the trace
   Block * _last;        // Last block in the trace
+  bool _cold;           // All blocks in the trace are uncommon
 
   void set_next(Block *b, Block *n) const { _next_list[b->_pre_order] = n; }
 
@@ -838,7 +839,8 @@ class Trace : public ResourceObj {
     _next_list(next_list),
     _prev_list(prev_list),
     _first(b),
-    _last(b) {
+    _last(b),
+    _cold(false) {
     set_next(b, nullptr);
     set_prev(b, nullptr);
   };
@@ -853,6 +855,10 @@ class Trace : public ResourceObj {
   // Return the last block in the trace
   Block * last_block() const { return _last; }
 
+  // Is every block in the trace uncommon?
+  bool is_cold() const { return _cold; }
+  void set_cold(bool cold) { _cold = cold; }
+
   // Return the block that follows "b" in the trace.
   Block * next(Block *b) const { return _next_list[b->_pre_order]; }
 
@@ -916,6 +922,7 @@ class PhaseBlockLayout : public Phase {
 
   void find_edges();
   void grow_traces();
+  void mark_cold_traces(int count);
   void merge_traces(bool loose_connections);
   void reorder_traces(int count);
   void union_traces(Trace* from, Trace* to);
@@ -355,6 +355,17 @@ bool InlineTree::is_not_reached(ciMethod* callee_method, ciMethod* caller_method
   return true; // give up and treat the call site as not reached
 }
 
+// Number of recursive inlining levels justified by the sampled recursion
+// depth of the callee: a recursion that usually reaches depth N fits into
+// one compiled frame once N - 1 levels are inlined.
+static int profiled_recursive_inline_level(ciMethod* callee_method) {
+  ciMethodData* md = callee_method->method_data();
+  if (md == nullptr || !md->is_mature()) {
+    return 0;
+  }
+  return MIN2((int)MaxProfiledRecursiveInlineLevel, md->recursion_depth() - 1);
+}
+
 //-----------------------------try_to_inline-----------------------------------
 // return true if ok
 // Relocated from "InliningClosure::try_to_inline"
@@ -462,7 +473,8 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
         }
       }
     }
-    if (inline_level > MaxRecursiveInlineLevel) {
+    if (inline_level > MaxRecursiveInlineLevel &&
+        (is_compiled_lambda_form || inline_level > profiled_recursive_inline_level(callee_method))) {
       set_msg("recursive inlining is too deep");
       return false;
     }
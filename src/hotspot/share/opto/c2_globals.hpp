@@ -359,6 +359,10 @@
   develop(bool, TraceLoopMultiversioning, false,                            \
           "Trace loop multiversioning")                                     \
                                                                             \
+  product(bool, UseAutoVectorizationAliasingChecks, true, DIAGNOSTIC,       \
+          "Vectorize array references that may alias, checking at "         \
+          "runtime that their arrays are different objects")                \
+                                                                            \
   product(bool, AllowVectorizeOnDemand, true,                               \
           "Globally suppress vectorization set in VectorizeMethod")         \
                                                                             \
@@ -452,6 +456,15 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UseMegamorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for the most frequent receivers of a "  \
+          "megamorphic call site, with a virtual call for the others")      \
+                                                                            \
+  product(intx, MegamorphicInliningWidth, 4, EXPERIMENTAL,                  \
+          "Max number of receivers inlined at a megamorphic call site. "    \
+          "Receivers are only profiled up to TypeProfileWidth")             \
+          range(1, 4)                                                       \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -603,6 +616,10 @@
   product(bool, BlockLayoutRotateLoops, true,                               \
           "Allow back branches to be fall throughs in the block layout")    \
                                                                             \
+  product(bool, BlockLayoutSplitColdTraces, true, DIAGNOSTIC,               \
+          "Keep traces made only of uncommon blocks apart from the other "  \
+          "traces and place them after all of them in the block layout")    \
+                                                                            \
   product(bool, InlineReflectionGetCallerClass, true, DIAGNOSTIC,           \
           "inline sun.reflect.Reflection.getCallerClass(), known to be "    \
           "part of base library DLL")                                       \
@@ -727,6 +744,17 @@
           "high tier compiler")                                             \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, UseStackBangWatermark, true, DIAGNOSTIC,                    \
+          "Skip the entry stack bang of self-recursive compiled methods "   \
+          "while the stack pointer is above the shadow zone growth "        \
+          "watermark. Only used on x86_64.")                                \
+                                                                            \
+  product(intx, MaxProfiledRecursiveInlineLevel, 4,                         \
+          "maximum number of nested recursive calls that are inlined by "   \
+          "high tier compiler when the sampled recursion depth of the "     \
+          "callee shows that the recursion goes deeper")                    \
+          range(0, max_jint)                                                \
+                                                                            \
   product_pd(intx, InlineSmallCode,                                         \
           "Only inline already compiled methods if their code size is "     \
           "less than this")                                                 \
@@ -356,6 +356,7 @@ class IfNode : public MultiBranchNode {
   Node* search_identical(int dist, PhaseIterGVN* igvn);
 
   Node* simple_subsuming(PhaseIterGVN* igvn);
+  Node* fold_overflow_check(PhaseIterGVN* igvn);
 
 public:
 
@@ -447,6 +448,7 @@ class IfNode : public MultiBranchNode {
   // by if_proj and returns a more refined type if one is produced.
   // Returns null is it couldn't improve the type.
   static const TypeInt* filtered_int_type(PhaseGVN* phase, Node* val, Node* if_proj);
+  static const TypeLong* filtered_long_type(PhaseGVN* phase, Node* val, Node* if_proj);
 
   AssertionPredicateType assertion_predicate_type() const {
     return _assertion_predicate_type;
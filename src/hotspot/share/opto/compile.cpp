@@ -42,6 +42,7 @@
 #include "gc/shared/c2/barrierSetC2.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm_io.h"
+#include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/arena.hpp"
 #include "memory/resourceArea.hpp"
@@ -81,6 +82,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -692,6 +694,7 @@ Compile::Compile(ciEnv* ci_env, ciMethod* target, int osr_bci,
       _replay_inline_data(nullptr),
       _inline_printer(this),
       _java_calls(0),
+      _self_calls(0),
       _inner_loops(0),
       _interpreter_frame_size(0),
       _output(nullptr)
@@ -953,6 +956,7 @@ Compile::Compile(ciEnv* ci_env,
       _replay_inline_data(nullptr),
       _inline_printer(this),
       _java_calls(0),
+      _self_calls(0),
       _inner_loops(0),
       _interpreter_frame_size(0),
       _output(nullptr),
@@ -3140,24 +3144,27 @@ struct Final_Reshape_Counts : public StackObj {
   int  _float_count;            // count float ops requiring 24-bit precision
   int  _double_count;           // count double ops requiring more precision
   int  _java_call_count;        // count non-inlined 'java' calls
+  int  _self_call_count;        // count non-inlined calls of the method itself
   int  _inner_loop_count;       // count loops which need alignment
   VectorSet _visited;           // Visitation flags
   Node_List _tests;             // Set of IfNodes & PCTableNodes
 
   Final_Reshape_Counts() :
     _call_count(0), _float_count(0), _double_count(0),
-    _java_call_count(0), _inner_loop_count(0) { }
+    _java_call_count(0), _self_call_count(0), _inner_loop_count(0) { }
 
   void inc_call_count  () { _call_count  ++; }
   void inc_float_count () { _float_count ++; }
   void inc_double_count() { _double_count++; }
   void inc_java_call_count() { _java_call_count++; }
+  void inc_self_call_count() { _self_call_count++; }
   void inc_inner_loop_count() { _inner_loop_count++; }
 
   int  get_call_count  () const { return _call_count  ; }
   int  get_float_count () const { return _float_count ; }
   int  get_double_count() const { return _double_count; }
   int  get_java_call_count() const { return _java_call_count; }
+  int  get_self_call_count() const { return _self_call_count; }
   int  get_inner_loop_count() const { return _inner_loop_count; }
 };
 
@@ -3326,6 +3333,9 @@ void Compile::final_graph_reshaping_main_switch(Node* n, Final_Reshape_Counts& f
   case Op_CallJava:
   case Op_CallDynamicJava:
     frc.inc_java_call_count(); // Count java call site;
+    if (n->as_CallJava()->method() == method()) {
+      frc.inc_self_call_count();
+    }
   case Op_CallRuntime:
   case Op_CallLeaf:
   case Op_CallLeafVector:
@@ -4144,6 +4154,7 @@ bool Compile::final_graph_reshaping() {
   }
 
   set_java_calls(frc.get_java_call_count());
+  set_self_calls(frc.get_self_call_count());
   set_inner_loops(frc.get_inner_loop_count());
 
   // No infinite loops, no reason to bail out.
@@ -4436,13 +4447,19 @@ Compile::TracePhase::TracePhase(const char* name, PhaseTraceId id)
   : TraceTime(name, &Phase::timers[id], CITime, CITimeVerbose),
     _compile(Compile::current()),
     _log(nullptr),
-    _dolog(CITimeVerbose)
+    _dolog(CITimeVerbose),
+    _start_counter(0),
+    _start_live_nodes(0)
 {
   assert(_compile != nullptr, "sanity check");
   assert(id != PhaseTraceId::_t_none, "Don't use none");
   if (_dolog) {
     _log = _compile->log();
   }
+  if (log_is_enabled(Debug, jit, compilation)) {
+    _start_counter = os::elapsed_counter();
+    _start_live_nodes = _compile->live_nodes();
+  }
   if (_log != nullptr) {
     _log->begin_head("phase name='%s' nodes='%d' live='%d'", phase_name(), _compile->unique(), _compile->live_nodes());
     _log->stamp();
@@ -4485,6 +4502,14 @@ Compile::TracePhase::~TracePhase() {
   if (_log != nullptr) {
     _log->done("phase name='%s' nodes='%d' live='%d'", phase_name(), _compile->unique(), _compile->live_nodes());
   }
+
+  if (_start_counter != 0) {
+    jlong ticks = os::elapsed_counter() - _start_counter;
+    log_debug(jit, compilation)("C2 %d: phase %s %.3f ms, live nodes %d -> %d",
+                                _compile->compile_id(), phase_name(),
+                                TimeHelper::counter_to_millis(ticks),
+                                _start_live_nodes, _compile->live_nodes());
+  }
 }
 
 //----------------------------static_subtype_check-----------------------------
@@ -239,6 +239,9 @@ class Compile : public Phase {
     Compile* const _compile;
     CompileLog* _log;
     const bool _dolog;
+    // For -Xlog:jit+compilation=debug
+    jlong _start_counter;
+    int _start_live_nodes;
    public:
     TracePhase(PhaseTraceId phaseTraceId);
     TracePhase(const char* name, PhaseTraceId phaseTraceId);
@@ -518,6 +521,7 @@ class Compile : public Phase {
   // Matching, CFG layout, allocation, code generation
   PhaseCFG*             _cfg;                   // Results of CFG finding
   int                   _java_calls;            // Number of java calls in the method
+  int                   _self_calls;            // Number of those that call the method itself
   int                   _inner_loops;           // Number of inner loops in the method
   Matcher*              _matcher;               // Engine to map ideal to machine instructions
   PhaseRegAlloc*        _regalloc;              // Results of register allocation.
@@ -1109,6 +1113,7 @@ class Compile : public Phase {
   PhaseCFG*         cfg()                       { return _cfg; }
   bool              has_java_calls() const      { return _java_calls > 0; }
   int               java_calls() const          { return _java_calls; }
+  bool              has_self_calls() const      { return _self_calls > 0; }
   int               inner_loops() const         { return _inner_loops; }
   Matcher*          matcher()                   { return _matcher; }
   PhaseRegAlloc*    regalloc()                  { return _regalloc; }
@@ -1129,6 +1134,7 @@ class Compile : public Phase {
   void          set_indexSet_free_block_list(void* p)   { _indexSet_free_block_list = p; }
 
   void  set_java_calls(int z) { _java_calls  = z; }
+  void  set_self_calls(int z) { _self_calls  = z; }
   void set_inner_loops(int z) { _inner_loops = z; }
 
   Dependencies* dependencies() { return env()->dependencies(); }
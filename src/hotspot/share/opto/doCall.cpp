@@ -110,7 +110,9 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   // Note: When we get profiling during stage-1 compiles, we want to pull
   // from more specific profile data which pertains to this inlining.
   // Right now, ignore the information in jvms->caller(), and do method[bci].
-  ciCallProfile profile = caller->call_profile_at_bci(bci);
+  // Only megamorphic inlining looks at more than two receivers.
+  ciCallProfile profile = UseMegamorphicInlining ? caller->call_profile_at_bci(bci, ciCallProfile::ReceiverLimit)
+                                                 : caller->call_profile_at_bci(bci);
 
   // See how many times this site has been invoked.
   int site_count = profile.count();
@@ -318,6 +320,41 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           }
         }
       }
+      if (receiver_method == nullptr && morphism == 0 && UseMegamorphicInlining &&
+          profile.has_receiver(0)) {
+        // Megamorphic call site: test for the most frequent receivers in turn,
+        // inline each of them and make a virtual call for all others.
+        int width = 0;
+        float reaching[ciCallProfile::ReceiverLimit];
+        float remaining = (float)site_count;
+        for (; width < MegamorphicInliningWidth && profile.has_receiver(width); width++) {
+          reaching[width] = remaining;
+          remaining -= profile.receiver_count(width);
+        }
+        CallGenerator* cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                                      : CallGenerator::for_virtual_call(callee, vtable_index));
+        bool inlined = false;
+        for (int i = width - 1; i >= 0 && cg != nullptr; i--) {
+          ciMethod* hit_method = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+          if (hit_method == nullptr) {
+            continue;
+          }
+          CallGenerator* hit_cg = this->call_generator(hit_method,
+                vtable_index, !call_does_dispatch, jvms, allow_inline, prof_factor);
+          if (hit_cg == nullptr || !hit_cg->is_inline()) {
+            // A test that only leads to another call is not worth it
+            continue;
+          }
+          trace_type_profile(C, jvms->method(), jvms, hit_method, profile.receiver(i), site_count, profile.receiver_count(i));
+          // Probability of the receiver, given that the tests before it failed
+          float hit_prob = reaching[i] > 0 ? clamp(profile.receiver_count(i) / reaching[i], PROB_MIN, PROB_MAX) : PROB_FAIR;
+          cg = CallGenerator::for_predicted_call(profile.receiver(i), cg, hit_cg, hit_prob);
+          inlined = true;
+        }
+        if (inlined && cg != nullptr) {
+          return cg;
+        }
+      }
     }
 
     // If there is only one implementor of this interface then we
@@ -511,6 +548,41 @@ static bool check_call_consistency(JVMState* jvms, CallGenerator* cg) {
 }
 #endif // ASSERT
 
+//------------------------------do_self_tail_call------------------------------
+// The call site was vetted by ciMethod::is_self_tail_call_site: the callee is
+// this very method and its result is returned unchanged.  Instead of calling,
+// move the outgoing arguments into the parameter slots and jump back to the
+// entry block, which type flow already records as this block's successor.
+void Parse::do_self_tail_call() {
+  assert(method()->is_static(), "no receiver");
+  const int arg_size = method()->arg_size();
+  assert(sp() >= arg_size, "arguments must be on the stack");
+
+  // Copy word by word; the second half of a long or double stays top.
+  for (int i = 0; i < arg_size; i++) {
+    set_local(i, peek(arg_size - 1 - i));
+  }
+  for (uint i = arg_size; i < jvms()->loc_size(); i++) {
+    set_local(i, top());
+  }
+  set_sp(0);
+
+  // Poll as for any backward branch.  The state now describes a fresh
+  // activation at bci 0, so a deoptimization must reexecute from there.
+  {
+    PreserveReexecuteState preexecs(this);
+    jvms()->set_should_reexecute(true);
+    int tail_call_bci = bci();
+    set_parse_bci(0);
+    add_safepoint();
+    set_parse_bci(tail_call_bci);
+  }
+
+  // The back edge is not visible in the bytecodes, so tell loop opts.
+  C->set_has_loops(true);
+  merge(0);
+}
+
 //------------------------------do_call----------------------------------------
 // Handle your basic call.  Inline if we can & want to, else just setup call.
 void Parse::do_call() {
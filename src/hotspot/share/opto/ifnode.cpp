@@ -30,6 +30,7 @@
 #include "opto/cfgnode.hpp"
 #include "opto/connode.hpp"
 #include "opto/loopnode.hpp"
+#include "opto/mathexactnode.hpp"
 #include "opto/phaseX.hpp"
 #include "opto/predicates_enums.hpp"
 #include "opto/rootnode.hpp"
@@ -715,6 +716,57 @@ const TypeInt* IfNode::filtered_int_type(PhaseGVN* gvn, Node* val, Node* if_proj
   return nullptr;
 }
 
+//------------------------------filtered_long_type-------------------------------
+// Same as filtered_int_type() for a CmpL of val against a long
+const TypeLong* IfNode::filtered_long_type(PhaseGVN* gvn, Node* val, Node* if_proj) {
+  assert(if_proj &&
+         (if_proj->Opcode() == Op_IfTrue || if_proj->Opcode() == Op_IfFalse), "expecting an if projection");
+  if (if_proj->in(0) && if_proj->in(0)->is_If()) {
+    IfNode* iff = if_proj->in(0)->as_If();
+    if (iff->in(1) && iff->in(1)->is_Bool()) {
+      BoolNode* bol = iff->in(1)->as_Bool();
+      if (bol->in(1) && bol->in(1)->Opcode() == Op_CmpL) {
+        const CmpNode* cmp  = bol->in(1)->as_Cmp();
+        if (cmp->in(1) == val) {
+          const TypeLong* cmp2_t = gvn->type(cmp->in(2))->isa_long();
+          if (cmp2_t != nullptr) {
+            jlong lo = cmp2_t->_lo;
+            jlong hi = cmp2_t->_hi;
+            BoolTest::mask msk = if_proj->Opcode() == Op_IfTrue ? bol->_test._test : bol->_test.negate();
+            switch (msk) {
+            case BoolTest::eq:
+              return cmp2_t;
+            case BoolTest::lt:
+              lo = TypeLong::LONG->_lo;
+              if (hi != min_jlong) {
+                hi = hi - 1;
+              }
+              break;
+            case BoolTest::le:
+              lo = TypeLong::LONG->_lo;
+              break;
+            case BoolTest::gt:
+              if (lo != max_jlong) {
+                lo = lo + 1;
+              }
+              hi = TypeLong::LONG->_hi;
+              break;
+            case BoolTest::ge:
+              hi = TypeLong::LONG->_hi;
+              break;
+            default:
+              // Can't refine type
+              return nullptr;
+            }
+            return TypeLong::make(lo, hi, cmp2_t->_widen);
+          }
+        }
+      }
+    }
+  }
+  return nullptr;
+}
+
 //------------------------------fold_compares----------------------------
 // See if a pair of CmpIs can be converted into a CmpU.  In some cases
 // the direction of this if is determined by the preceding if so it
@@ -1506,6 +1558,11 @@ Node* IfNode::Ideal(PhaseGVN *phase, bool can_reshape) {
     return result;
   }
 
+  result = fold_overflow_check(igvn);
+  if (result != nullptr) {
+    return result;
+  }
+
   // Scan for an equivalent test
   int dist = 4;               // Cutoff limit for search
   if (is_If() && in(1)->is_Bool()) {
@@ -1764,6 +1821,47 @@ Node* IfNode::simple_subsuming(PhaseIterGVN* igvn) {
   return this;
 }
 
+//------------------------------fold_overflow_check----------------------------
+// The Overflow node of a Math.*Exact check is commoned across paths, so its
+// Value() only sees the global types of the inputs. Narrow them with the tests
+// that dominate this If and fold the check if it can't overflow on this path.
+Node* IfNode::fold_overflow_check(PhaseIterGVN* igvn) {
+  Node* bol = in(1);
+  if (!bol->is_Bool()) {
+    return nullptr;
+  }
+  Node* cmp = bol->in(1);
+  bool may_overflow;
+  switch (cmp->Opcode()) {
+  case Op_OverflowAddI:
+  case Op_OverflowSubI:
+  case Op_OverflowMulI:
+    may_overflow = static_cast<OverflowINode*>(cmp)->may_overflow_at(igvn, in(0));
+    break;
+  case Op_OverflowAddL:
+  case Op_OverflowSubL:
+  case Op_OverflowMulL:
+    may_overflow = static_cast<OverflowLNode*>(cmp)->may_overflow_at(igvn, in(0));
+    break;
+  default:
+    return nullptr;
+  }
+  if (may_overflow) {
+    return nullptr;
+  }
+#ifndef PRODUCT
+  if (TraceIterativeGVN) {
+    tty->print("   Folded overflow check: "); dump();
+  }
+#endif
+  const Type* t = bol->as_Bool()->_test.cc2logical(TypeInt::ZERO);
+  set_req(1, igvn->intcon(t->is_int()->get_con()));
+  if (bol->outcnt() == 0) {
+    igvn->remove_dead_node(bol);
+  }
+  return this;
+}
+
 // Map BoolTest to local table encoding. The BoolTest (e)numerals
 //   { eq = 0, ne = 4, le = 5, ge = 7, lt = 3, gt = 1 }
 // are mapped to table indices, while the remaining (e)numerals in BoolTest
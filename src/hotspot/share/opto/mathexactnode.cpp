@@ -180,11 +180,69 @@ const Type* OverflowNode::sub(const Type* t1, const Type* t2) const {
   return TypeInt::CC;
 }
 
+// Only signed compares bound the value the way Overflow nodes need it.
+static const TypeInt* filtered_type(PhaseGVN* phase, Node* val, Node* if_proj, const TypeInt*) {
+  Node* bol = if_proj->in(0)->in(1);
+  if (!bol->is_Bool() || bol->in(1)->Opcode() != Op_CmpI) {
+    return nullptr;
+  }
+  return IfNode::filtered_int_type(phase, val, if_proj);
+}
+
+static const TypeLong* filtered_type(PhaseGVN* phase, Node* val, Node* if_proj, const TypeLong*) {
+  return IfNode::filtered_long_type(phase, val, if_proj);
+}
+
 template <typename OverflowOp>
 struct IdealHelper {
   typedef typename OverflowOp::TypeClass TypeClass; // TypeInt, TypeLong
   typedef typename TypeClass::NativeType NativeType;
 
+  // All of add, sub and mul reach their extremes at the corners of the
+  // input ranges.
+  static bool corners_overflow(const OverflowOp* node, const TypeClass* i1, const TypeClass* i2) {
+    return node->will_overflow(i1->_lo, i2->_lo) ||
+           node->will_overflow(i1->_lo, i2->_hi) ||
+           node->will_overflow(i1->_hi, i2->_lo) ||
+           node->will_overflow(i1->_hi, i2->_hi);
+  }
+
+  // Narrow the type of val with the test ending at if_proj
+  static const TypeClass* narrow(PhaseGVN* phase, Node* val, Node* if_proj, const TypeClass* t) {
+    const TypeClass* filtered = filtered_type(phase, val, if_proj, t);
+    if (filtered == nullptr) {
+      return t;
+    }
+    const Type* joined = t->join(filtered);
+    if (joined->empty()) {
+      // Dead path, leave it to IGVN
+      return t;
+    }
+    return TypeClass::as_self(joined);
+  }
+
+  static bool may_overflow_at(const OverflowOp* node, PhaseGVN* phase, Node* ctrl) {
+    const Type* t1 = phase->type(node->in(1));
+    const Type* t2 = phase->type(node->in(2));
+    if (t1 == Type::TOP || t2 == Type::TOP) {
+      return true;
+    }
+    const TypeClass* i1 = TypeClass::as_self(t1);
+    const TypeClass* i2 = TypeClass::as_self(t2);
+    // Same cutoff as the search for an identical dominating test
+    for (int i = 0; i < 10 && ctrl != nullptr; i++) {
+      if (ctrl->Opcode() == Op_IfTrue || ctrl->Opcode() == Op_IfFalse) {
+        i1 = narrow(phase, node->in(1), ctrl, i1);
+        i2 = narrow(phase, node->in(2), ctrl, i2);
+      }
+      ctrl = IfNode::up_one_dom(ctrl);
+    }
+    if (i1 == TypeClass::TYPE_DOMAIN || i2 == TypeClass::TYPE_DOMAIN) {
+      return true;
+    }
+    return corners_overflow(node, i1, i2);
+  }
+
   static Node* Ideal(const OverflowOp* node, PhaseGVN* phase, bool can_reshape) {
     Node* arg1 = node->in(1);
     Node* arg2 = node->in(2);
@@ -229,16 +287,7 @@ struct IdealHelper {
       }
       return TypeInt::ZERO;
     } else if (i1 != TypeClass::TYPE_DOMAIN && i2 != TypeClass::TYPE_DOMAIN) {
-      if (node->will_overflow(i1->_lo, i2->_lo)) {
-        return TypeInt::CC;
-      } else if (node->will_overflow(i1->_lo, i2->_hi)) {
-        return TypeInt::CC;
-      } else if (node->will_overflow(i1->_hi, i2->_lo)) {
-        return TypeInt::CC;
-      } else if (node->will_overflow(i1->_hi, i2->_hi)) {
-        return TypeInt::CC;
-      }
-      return TypeInt::ZERO;
+      return corners_overflow(node, i1, i2) ? TypeInt::CC : TypeInt::ZERO;
     }
 
     if (!node->can_overflow(t1, t2)) {
@@ -264,3 +313,10 @@ const Type* OverflowLNode::Value(PhaseGVN* phase) const {
   return IdealHelper<OverflowLNode>::Value(this, phase);
 }
 
+bool OverflowINode::may_overflow_at(PhaseGVN* phase, Node* ctrl) const {
+  return IdealHelper<OverflowINode>::may_overflow_at(this, phase, ctrl);
+}
+
+bool OverflowLNode::may_overflow_at(PhaseGVN* phase, Node* ctrl) const {
+  return IdealHelper<OverflowLNode>::may_overflow_at(this, phase, ctrl);
+}
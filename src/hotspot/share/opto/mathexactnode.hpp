@@ -48,6 +48,10 @@ class OverflowINode : public OverflowNode {
 
   virtual bool will_overflow(jint v1, jint v2) const = 0;
   virtual bool can_overflow(const Type* t1, const Type* t2) const = 0;
+
+  // False if the tests that dominate ctrl keep the inputs in ranges
+  // where the operation can't overflow.
+  bool may_overflow_at(PhaseGVN* phase, Node* ctrl) const;
 };
 
 
@@ -61,6 +65,10 @@ class OverflowLNode : public OverflowNode {
 
   virtual bool will_overflow(jlong v1, jlong v2) const = 0;
   virtual bool can_overflow(const Type* t1, const Type* t2) const = 0;
+
+  // False if the tests that dominate ctrl keep the inputs in ranges
+  // where the operation can't overflow.
+  bool may_overflow_at(PhaseGVN* phase, Node* ctrl) const;
 };
 
 class OverflowAddINode : public OverflowINode {
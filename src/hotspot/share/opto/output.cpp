@@ -375,6 +375,18 @@ bool PhaseOutput::need_stack_bang(int frame_size_in_bytes) const {
            DEBUG_ONLY(|| true)));
 }
 
+bool PhaseOutput::use_stack_bang_watermark(int frame_size_in_bytes) const {
+  // Self-recursive methods bang on every level of the recursion, even
+  // though the stack below them was usually banged by an earlier descent.
+  // If the platform supports it, skip the bang while the stack pointer is
+  // above the shadow zone growth watermark (see stackOverflow.hpp). That
+  // only covers the shadow zone, so frames that need more than the bang at
+  // the end of the shadow zone keep banging unconditionally.
+  return (UseStackBangWatermark &&
+          C->has_self_calls() &&
+          frame_size_in_bytes <= (int)os::vm_page_size());
+}
+
 bool PhaseOutput::need_register_stack_bang() const {
   // Determine if we need to generate a register stack overflow check.
   // This is only used on architectures which have split register
@@ -109,6 +109,7 @@ class PhaseOutput : public Phase {
   // Convert Nodes to instruction bits and pass off to the VM
   void Output();
   bool need_stack_bang(int frame_size_in_bytes) const;
+  bool use_stack_bang_watermark(int frame_size_in_bytes) const;
   bool need_register_stack_bang() const;
   void compute_loop_first_inst_sizes();
 
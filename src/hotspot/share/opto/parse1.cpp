@@ -40,6 +40,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepointMechanism.hpp"
 #include "runtime/sharedRuntime.hpp"
+#include "services/runtimeService.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/copy.hpp"
 
@@ -2195,6 +2196,13 @@ void Parse::return_current(Node* value) {
   if (C->env()->dtrace_method_probes()) {
     make_dtrace_method_exit(method());
   }
+  // Only count returns that pop a frame, like the interpreter and C1 do.
+  if (depth() == 1 && method()->has_fastreturn()) {
+    address counter = RuntimeService::c2_fast_returns_addr();
+    if (counter != nullptr) {
+      increment_counter(counter);
+    }
+  }
   SafePointNode* exit_return = _exits.map();
   exit_return->in( TypeFunc::Control  )->add_req( control() );
   exit_return->in( TypeFunc::I_O      )->add_req( i_o    () );
@@ -2716,6 +2716,12 @@ void Parse::do_one_bytecode() {
     break;
 
   case Bytecodes::_invokestatic:
+    if (method()->is_self_tail_call_site(bci())) {
+      do_self_tail_call();
+      break;
+    }
+    do_call();
+    break;
   case Bytecodes::_invokedynamic:
   case Bytecodes::_invokespecial:
   case Bytecodes::_invokevirtual:
@@ -24,6 +24,7 @@
 
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/c2/barrierSetC2.hpp"
+#include "logging/log.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "opto/addnode.hpp"
@@ -1066,6 +1067,8 @@ void PhaseIterGVN::optimize() {
     }
     loop_count++;
   }
+  log_trace(jit, compilation)("C2 %d: igvn processed %u worklist entries, live nodes %d",
+                              C->compile_id(), loop_count, C->live_nodes());
   NOT_PRODUCT(verify_PhaseIterGVN();)
   C->print_method(PHASE_AFTER_ITER_GVN, 3);
 }
@@ -63,12 +63,6 @@ static bool check_vbox(const TypeInstPtr* vbox_type) {
     tty->print_cr(__VA_ARGS__);   \
   }
 
-#ifndef PRODUCT
-#define non_product_log_if_needed(...) log_if_needed(__VA_ARGS__)
-#else
-#define non_product_log_if_needed(...)
-#endif
-
 static bool is_vector_mask(ciKlass* klass) {
   return klass->is_subclass_of(ciEnv::current()->vector_VectorMask_klass());
 }
@@ -91,8 +85,8 @@ bool LibraryCallKit::arch_supports_vector_rotate(int opc, int num_elem, BasicTyp
     if ((mask_use_type & VecMaskUseLoad) != 0) {
       if (!Matcher::match_rule_supported_vector(Op_VectorLoadMask, num_elem, elem_bt) ||
           !Matcher::match_rule_supported_vector(Op_LoadVector, num_elem, T_BOOLEAN)) {
-        non_product_log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
-                                  NodeClassNames[Op_VectorLoadMask], type2name(elem_bt), num_elem);
+        log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
+                      NodeClassNames[Op_VectorLoadMask], type2name(elem_bt), num_elem);
         return false;
       }
     }
@@ -100,8 +94,8 @@ bool LibraryCallKit::arch_supports_vector_rotate(int opc, int num_elem, BasicTyp
     if ((mask_use_type & VecMaskUsePred) != 0) {
       if (!Matcher::has_predicated_vectors() ||
           !Matcher::match_rule_supported_vector_masked(opc, num_elem, elem_bt)) {
-        non_product_log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
-                                  NodeClassNames[opc], type2name(elem_bt), num_elem);
+        log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
+                      NodeClassNames[opc], type2name(elem_bt), num_elem);
         return false;
       }
     }
@@ -183,27 +177,27 @@ Node* GraphKit::vector_shift_count(Node* cnt, int shift_op, BasicType bt, int nu
 bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type, VectorMaskUseType mask_use_type, bool has_scalar_args) {
   // Check that the operation is valid.
   if (sopc <= 0) {
-    non_product_log_if_needed("  ** Rejected intrinsification because no valid vector op could be extracted");
+    log_if_needed("  ** Rejected intrinsification because no valid vector op could be extracted");
     return false;
   }
 
   if (VectorNode::is_vector_rotate(sopc)) {
     if(!arch_supports_vector_rotate(sopc, num_elem, type, mask_use_type, has_scalar_args)) {
-      non_product_log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
-                                NodeClassNames[sopc], type2name(type), num_elem);
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support variable vector shifts",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   } else if (VectorNode::is_vector_integral_negate(sopc)) {
     if (!VectorNode::is_vector_integral_negate_supported(sopc, num_elem, type, false)) {
-      non_product_log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support integral vector negate",
-                                NodeClassNames[sopc], type2name(type), num_elem);
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support integral vector negate",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   } else {
     // Check that architecture supports this op-size-type combination.
     if (!Matcher::match_rule_supported_vector(sopc, num_elem, type)) {
-      non_product_log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support it",
-                                NodeClassNames[sopc], type2name(type), num_elem);
+      log_if_needed("  ** Rejected vector op (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     } else {
       assert(Matcher::match_rule_supported(sopc), "must be supported");
@@ -212,15 +206,15 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
 
   if (num_elem == 1) {
     if (mask_use_type != VecMaskNotUsed) {
-      non_product_log_if_needed("  ** Rejected vector mask op (%s,%s,%d) because architecture does not support it",
-                                NodeClassNames[sopc], type2name(type), num_elem);
+      log_if_needed("  ** Rejected vector mask op (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
 
     if (sopc != 0) {
       if (sopc != Op_LoadVector && sopc != Op_StoreVector) {
-        non_product_log_if_needed("  ** Not a svml call or load/store vector op (%s,%s,%d)",
-                                  NodeClassNames[sopc], type2name(type), num_elem);
+        log_if_needed("  ** Not a svml call or load/store vector op (%s,%s,%d)",
+                      NodeClassNames[sopc], type2name(type), num_elem);
         return false;
       }
     }
@@ -239,8 +233,8 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
   if ((mask_use_type & VecMaskUseLoad) != 0) {
     if (!Matcher::match_rule_supported_vector(Op_VectorLoadMask, num_elem, type) ||
         !Matcher::match_rule_supported_vector(Op_LoadVector, num_elem, T_BOOLEAN)) {
-      non_product_log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
-                                NodeClassNames[Op_VectorLoadMask], type2name(type), num_elem);
+      log_if_needed("  ** Rejected vector mask loading (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[Op_VectorLoadMask], type2name(type), num_elem);
       return false;
     }
   }
@@ -251,8 +245,8 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
   if ((mask_use_type & VecMaskUseStore) != 0) {
     if (!Matcher::match_rule_supported_vector(Op_VectorStoreMask, num_elem, type) ||
         !Matcher::match_rule_supported_vector(Op_StoreVector, num_elem, T_BOOLEAN)) {
-      non_product_log_if_needed("Rejected vector mask storing (%s,%s,%d) because architecture does not support it",
-                                NodeClassNames[Op_VectorStoreMask], type2name(type), num_elem);
+      log_if_needed("Rejected vector mask storing (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[Op_VectorStoreMask], type2name(type), num_elem);
       return false;
     }
   }
@@ -269,8 +263,8 @@ bool LibraryCallKit::arch_supports_vector(int sopc, int num_elem, BasicType type
     is_supported |= Matcher::supports_vector_predicate_op_emulation(sopc, num_elem, type);
 
     if (!is_supported) {
-      non_product_log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
-                                NodeClassNames[sopc], type2name(type), num_elem);
+      log_if_needed("Rejected vector mask predicate using (%s,%s,%d) because architecture does not support it",
+                    NodeClassNames[sopc], type2name(type), num_elem);
       return false;
     }
   }
@@ -3119,5 +3113,4 @@ bool LibraryCallKit::inline_index_partially_in_upper_range() {
   return true;
 }
 
-#undef non_product_log_if_needed
 #undef log_if_needed
@@ -256,7 +256,8 @@ void VLoopVPointers::print() const {
 //    - No edges between different slices.
 //    - No Load-Load edges.
 //    - Inside a slice, add all Store-Load, Load-Store, Store-Store edges,
-//      except if we can prove that the memory does not overlap.
+//      except if we can prove that the memory does not overlap, or we can
+//      speculate that it does not (see speculate_disjoint).
 void VLoopDependencyGraph::construct() {
   const GrowableArray<PhiNode*>& mem_slice_heads = _memory_slices.heads();
   const GrowableArray<MemNode*>& mem_slice_tails = _memory_slices.tails();
@@ -286,7 +287,8 @@ void VLoopDependencyGraph::construct() {
         if (n1->is_Load() && n2->is_Load()) { continue; }
 
         const VPointer& p2 = _vpointers.vpointer(n2);
-        if (!p1.never_overlaps_with(p2)) {
+        if (!p1.never_overlaps_with(p2) &&
+            !speculate_disjoint(n1, p1, n2, p2)) {
           // Possibly overlapping memory
           memory_pred_edges.append(_body.bb_idx(n2));
         }
@@ -305,6 +307,47 @@ void VLoopDependencyGraph::construct() {
   NOT_PRODUCT( if (_vloop.is_trace_dependency_graph()) { print(); } )
 }
 
+// Two array references with different base nodes may still be into the same
+// array, for example when both arrays are parameters. Different arrays never
+// overlap though, so if we can check at runtime that the bases are different
+// objects, we can drop the memory edge. If the check fails, we trap or take
+// the slow loop of the multiversioned loop.
+bool VLoopDependencyGraph::speculate_disjoint(const MemNode* n1, const VPointer& p1,
+                                              const MemNode* n2, const VPointer& p2) {
+  if (!UseAutoVectorizationAliasingChecks ||
+      !_vloop.are_speculative_checks_possible() ||
+      !p1.is_valid() || !p2.is_valid()) {
+    return false;
+  }
+  const MemPointer::Base& b1 = p1.mem_pointer().base();
+  const MemPointer::Base& b2 = p2.mem_pointer().base();
+  if (!b1.is_object() || !b2.is_object() || b1.object() == b2.object()) {
+    return false;
+  }
+  if (!_vloop.is_available_for_speculative_check(b1.object()) ||
+      !_vloop.is_available_for_speculative_check(b2.object())) {
+    return false;
+  }
+  // Unsafe and other mismatched accesses can reach outside of their base object.
+  if (n1->is_mismatched_access() || n2->is_mismatched_access() ||
+      n1->adr_type()->isa_aryptr() == nullptr || n2->adr_type()->isa_aryptr() == nullptr) {
+    return false;
+  }
+
+  for (int i = 0; i < _speculative_disjoint_bases.length(); i++) {
+    const DisjointBases& d = _speculative_disjoint_bases.at(i);
+    if ((d._base1 == b1.object() && d._base2 == b2.object()) ||
+        (d._base1 == b2.object() && d._base2 == b1.object())) {
+      return true;
+    }
+  }
+  DisjointBases d;
+  d._base1 = b1.object();
+  d._base2 = b2.object();
+  _speculative_disjoint_bases.append(d);
+  return true;
+}
+
 void VLoopDependencyGraph::add_node(MemNode* n, GrowableArray<int>& memory_pred_edges) {
   assert(_dependency_nodes.at_grow(_body.bb_idx(n), nullptr) == nullptr, "not yet created");
   assert(!memory_pred_edges.is_empty(), "no need to create a node without edges");
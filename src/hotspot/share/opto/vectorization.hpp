@@ -161,6 +161,17 @@ class VLoop : public StackObj {
            _multiversioning_fast_proj != nullptr;
   }
 
+  // Speculative checks are inserted above the auto vectorization Parse Predicate,
+  // or below the multiversion_if. Nodes used in the check must be available there.
+  bool is_available_for_speculative_check(Node* n) const {
+    assert(are_speculative_checks_possible(), "must have a place for the checks");
+    Node* check_ctrl = _auto_vectorization_parse_predicate_proj != nullptr
+                       ? _auto_vectorization_parse_predicate_proj->in(0)->in(0)
+                       : _multiversioning_fast_proj;
+    Node* ctrl = _phase->has_ctrl(n) ? _phase->get_ctrl(n) : n;
+    return _phase->is_dominator(ctrl, check_ctrl);
+  }
+
   // Estimate maximum size for data structures, to avoid repeated reallocation
   int estimated_body_length() const { return lpt()->_body.size(); };
   int estimated_node_count()  const { return (int)(1.10 * phase()->C->unique()); };
@@ -570,6 +581,15 @@ class VLoopVPointers : public StackObj {
 //                         stores are serialized, even if their memory does not overlap. Thus,
 //                         we refine the memory-dependencies (see construct method).
 class VLoopDependencyGraph : public StackObj {
+public:
+  // Two array bases whose references we assume not to overlap, which holds
+  // as long as the arrays are different objects. The assumption is checked
+  // with a speculative runtime check, see VTransform::apply_speculative_runtime_checks.
+  struct DisjointBases {
+    Node* _base1;
+    Node* _base2;
+  };
+
 private:
   class DependencyNode;
 
@@ -585,6 +605,8 @@ class VLoopDependencyGraph : public StackObj {
   // Node depth in DAG: bb_idx -> depth
   GrowableArray<int> _depths;
 
+  GrowableArray<DisjointBases> _speculative_disjoint_bases;
+
 public:
   VLoopDependencyGraph(Arena* arena,
                        const VLoop& vloop,
@@ -603,15 +625,22 @@ class VLoopDependencyGraph : public StackObj {
     _depths(arena,
             vloop.estimated_body_length(),
             vloop.estimated_body_length(),
-            0) {}
+            0),
+    _speculative_disjoint_bases(arena, 0, 0, DisjointBases()) {}
   NONCOPYABLE(VLoopDependencyGraph);
 
   void construct();
   bool independent(Node* s1, Node* s2) const;
   bool mutually_independent(const Node_List* nodes) const;
 
+  const GrowableArray<DisjointBases>& speculative_disjoint_bases() const {
+    return _speculative_disjoint_bases;
+  }
+
 private:
   void add_node(MemNode* n, GrowableArray<int>& memory_pred_edges);
+  bool speculate_disjoint(const MemNode* n1, const VPointer& p1,
+                          const MemNode* n2, const VPointer& p2);
   int depth(const Node* n) const { return _depths.at(_body.bb_idx(n)); }
   void set_depth(const Node* n, int d) { _depths.at_put(_body.bb_idx(n), d); }
   int find_max_pred_depth(const Node* n) const;
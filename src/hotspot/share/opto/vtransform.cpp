@@ -169,6 +169,17 @@ void VTransform::apply_speculative_runtime_checks() {
       add_speculative_alignment_check(vp.mem_pointer().base().native(), ObjectAlignmentInBytes);
     }
   }
+
+  const GrowableArray<VLoopDependencyGraph::DisjointBases>& disjoint_bases =
+    _vloop_analyzer.dependency_graph().speculative_disjoint_bases();
+#ifdef ASSERT
+  if (_trace._speculative_runtime_checks && disjoint_bases.is_nonempty()) {
+    tty->print_cr("\nVTransform::apply_speculative_runtime_checks: aliasing");
+  }
+#endif
+  for (int i = 0; i < disjoint_bases.length(); i++) {
+    add_speculative_aliasing_check(disjoint_bases.at(i)._base1, disjoint_bases.at(i)._base2);
+  }
 }
 
 #define TRACE_SPECULATIVE_ALIGNMENT_CHECK(node) {                     \
@@ -216,6 +227,33 @@ void VTransform::add_speculative_alignment_check(Node* node, juint alignment) {
   add_speculative_check(bol_alignment);
 }
 
+#define TRACE_SPECULATIVE_ALIASING_CHECK(node) {                       \
+  DEBUG_ONLY(                                                         \
+    if (_trace._speculative_runtime_checks) {                         \
+      tty->print("  " #node ": ");                                    \
+      node->dump();                                                   \
+    }                                                                 \
+  )                                                                   \
+}                                                                     \
+
+// Check: base1 != base2. Different arrays never overlap.
+void VTransform::add_speculative_aliasing_check(Node* base1, Node* base2) {
+  TRACE_SPECULATIVE_ALIASING_CHECK(base1);
+  TRACE_SPECULATIVE_ALIASING_CHECK(base2);
+  Node* ctrl1 = phase()->get_ctrl(base1);
+  Node* ctrl2 = phase()->get_ctrl(base2);
+  Node* ctrl = phase()->is_dominator(ctrl1, ctrl2) ? ctrl2 : ctrl1;
+
+  Node* cmp_aliasing = CmpNode::make(base1, base2, T_OBJECT, false);
+  BoolNode* bol_aliasing = new BoolNode(cmp_aliasing, BoolTest::ne);
+  phase()->register_new_node(cmp_aliasing, ctrl);
+  phase()->register_new_node(bol_aliasing, ctrl);
+  TRACE_SPECULATIVE_ALIASING_CHECK(cmp_aliasing);
+  TRACE_SPECULATIVE_ALIASING_CHECK(bol_aliasing);
+
+  add_speculative_check(bol_aliasing);
+}
+
 void VTransform::add_speculative_check(BoolNode* bol) {
   assert(_vloop.are_speculative_checks_possible(), "otherwise we cannot make speculative assumptions");
   ParsePredicateSuccessProj* parse_predicate_proj = _vloop.auto_vectorization_parse_predicate_proj();
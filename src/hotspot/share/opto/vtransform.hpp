@@ -250,6 +250,7 @@ class VTransform : public StackObj {
 
   void apply_speculative_runtime_checks();
   void add_speculative_alignment_check(Node* node, juint alignment);
+  void add_speculative_aliasing_check(Node* base1, Node* base2);
   void add_speculative_check(BoolNode* bol);
 
   void apply_vectorization() const;
@@ -29,6 +29,7 @@
 #include "oops/oop.inline.hpp"
 #include "prims/forte.hpp"
 #include "prims/jvmtiExport.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/javaThread.inline.hpp"
@@ -49,6 +50,29 @@ typedef struct {
     ASGCT_CallFrame *frames;          // frames
 } ASGCT_CallTrace;
 
+// An entry of the caller-provided ring that AsyncGetStackSample() fills in.
+// Every sample is a header entry (method_id == nullptr) followed by its
+// frame entries, callee first.
+typedef struct {
+    jmethodID method_id;              // method of the frame, null for a sample header
+    jint bci;                         // frame: bci, -1 if unknown, -3 if native
+                                      // header: frames walked, or < 0 as for ASGCT
+    jint repeat;                      // frame: number of identical caller frames folded
+                                      //        into this entry (direct recursion)
+                                      // header: number of frame entries that follow
+} ASGST_Frame;
+
+// The ring is written only by the signal handler of the sampled thread, so
+// a profiler uses one ring per thread. 'head' counts the entries written so
+// far and is published after the sample: a consumer that is more than
+// 'capacity' entries behind it has lost the oldest samples. A power of two
+// capacity keeps entry positions continuous when 'head' wraps around.
+typedef struct {
+    ASGST_Frame *frames;              // 'capacity' entries, owned by the caller
+    jint capacity;                    // number of entries in 'frames'
+    volatile juint head;              // entries written so far
+} ASGST_Ring;
+
 // These name match the names reported by the forte quality kit
 enum {
   ticks_no_Java_frame         =  0,
@@ -465,8 +489,17 @@ static bool find_initial_Java_frame(JavaThread* thread,
 
 }
 
+// Walks the Java frames starting at 'top_frame' and hands them to 'sink',
+// which is either the ASGCT_CallTrace of AsyncGetCallTrace() or the ring
+// of AsyncGetStackSample(). A sink provides
+//
+//   bool add_frame(jmethodID method_id, jint lineno); // false if full
+//   void set_num_frames(jint num_frames);
+//
+// Both are called from a signal handler and must not lock or allocate.
+template <typename FrameSink>
 static void forte_fill_call_trace_given_top(JavaThread* thd,
-                                            ASGCT_CallTrace* trace,
+                                            FrameSink* sink,
                                             int depth,
                                             frame top_frame) {
   NoHandleMark nhm;
@@ -478,7 +511,6 @@ static void forte_fill_call_trace_given_top(JavaThread* thd,
   int count;
 
   count = 0;
-  assert(trace->frames != nullptr, "trace->frames must be non-null");
 
   // Walk the stack starting from 'top_frame' and search for an initial Java frame.
   find_initial_Java_frame(thd, &top_frame, &initial_Java_frame, &method, &bci);
@@ -487,7 +519,7 @@ static void forte_fill_call_trace_given_top(JavaThread* thd,
   if (method == nullptr) return;
 
   if (!Method::is_valid_method(method)) {
-    trace->num_frames = ticks_GC_active; // -2
+    sink->set_num_frames(ticks_GC_active); // -2
     return;
   }
 
@@ -500,21 +532,178 @@ static void forte_fill_call_trace_given_top(JavaThread* thd,
     if (!Method::is_valid_method(method)) {
       // we throw away everything we've gathered in this sample since
       // none of it is safe
-      trace->num_frames = ticks_GC_active; // -2
+      sink->set_num_frames(ticks_GC_active); // -2
       return;
     }
 
-    trace->frames[count].method_id = method->find_jmethod_id_or_null();
-    if (!method->is_native()) {
-      trace->frames[count].lineno = bci;
-    } else {
-      trace->frames[count].lineno = -3;
+    if (!sink->add_frame(method->find_jmethod_id_or_null(),
+                         method->is_native() ? -3 : bci)) {
+      break;
     }
   }
-  trace->num_frames = count;
+  sink->set_num_frames(count);
   return;
 }
 
+// Fills the frames of an ASGCT_CallTrace; the caller bounds the depth.
+class CallTraceFrameSink : public StackObj {
+  ASGCT_CallTrace* _trace;
+  int _count;
+
+ public:
+  CallTraceFrameSink(ASGCT_CallTrace* trace) : _trace(trace), _count(0) {
+    assert(trace->frames != nullptr, "trace->frames must be non-null");
+  }
+
+  bool add_frame(jmethodID method_id, jint lineno) {
+    _trace->frames[_count].method_id = method_id;
+    _trace->frames[_count].lineno = lineno;
+    _count++;
+    return true;
+  }
+
+  void set_num_frames(jint num_frames) {
+    _trace->num_frames = num_frames;
+  }
+};
+
+// Appends a sample to an ASGST_Ring. Runs of frames with the same method and
+// bci, as left by direct recursion, are folded into one entry, so a deep
+// recursion does not push the rest of the stack out of a small ring.
+class RingFrameSink : public StackObj {
+  ASGST_Ring* _ring;
+  juint _header;
+  juint _next;
+  juint _limit;
+  jint _num_frames;
+
+  ASGST_Frame* at(juint index) const {
+    return &_ring->frames[index % (juint)_ring->capacity];
+  }
+
+ public:
+  RingFrameSink(ASGST_Ring* ring) :
+    _ring(ring),
+    _header(ring->head),
+    _next(ring->head + 1),
+    _limit(ring->head + (juint)ring->capacity),
+    _num_frames(ticks_unknown_state) {}
+
+  bool add_frame(jmethodID method_id, jint lineno) {
+    if (_next != _header + 1) {
+      ASGST_Frame* last = at(_next - 1);
+      if (last->method_id == method_id && last->bci == lineno) {
+        last->repeat++;
+        return true;
+      }
+    }
+    if (_next == _limit) {
+      return false;
+    }
+    ASGST_Frame* frame = at(_next++);
+    frame->method_id = method_id;
+    frame->bci = lineno;
+    frame->repeat = 0;
+    return true;
+  }
+
+  void set_num_frames(jint num_frames) {
+    _num_frames = num_frames;
+  }
+
+  jint publish() {
+    ASGST_Frame* header = at(_header);
+    header->method_id = nullptr;
+    header->bci = _num_frames;
+    header->repeat = (jint)(_next - _header - 1);
+    Atomic::release_store(&_ring->head, _next);
+    return _num_frames;
+  }
+};
+
+// Samples the stack of the current thread, which has been interrupted at
+// 'ucontext', into 'sink'. The thread must be a live JavaThread.
+template <typename FrameSink>
+static void forte_sample_current_thread(JavaThread* thread, FrameSink* sink,
+                                        jint depth, void* ucontext) {
+  if (thread->in_deopt_handler()) {
+    // thread is in the deoptimization handler so return no frames
+    sink->set_num_frames(ticks_deopt); // -9
+    return;
+  }
+
+  if (!JvmtiExport::should_post_class_load()) {
+    sink->set_num_frames(ticks_no_class_load); // -1
+    return;
+  }
+
+  if (Universe::heap()->is_stw_gc_active()) {
+    sink->set_num_frames(ticks_GC_active); // -2
+    return;
+  }
+
+  // signify to other code in the VM that we're in ASGCT
+  ThreadInAsgct tia(thread);
+
+  switch (thread->thread_state()) {
+  case _thread_new:
+  case _thread_uninitialized:
+  case _thread_new_trans:
+    // We found the thread on the threads list above, but it is too
+    // young to be useful so return that there are no Java frames.
+    sink->set_num_frames(0);
+    break;
+  case _thread_in_native:
+  case _thread_in_native_trans:
+  case _thread_blocked:
+  case _thread_blocked_trans:
+  case _thread_in_vm:
+  case _thread_in_vm_trans:
+    {
+      frame fr;
+
+      // param isInJava == false - indicate we aren't in Java code
+      if (!thread->pd_get_top_frame_for_signal_handler(&fr, ucontext, false)) {
+        sink->set_num_frames(ticks_unknown_not_Java);  // -3 unknown frame
+      } else {
+        if (!thread->has_last_Java_frame()) {
+          sink->set_num_frames(0); // No Java frames
+        } else {
+          sink->set_num_frames(ticks_not_walkable_not_Java);    // -4 non walkable frame by default
+          forte_fill_call_trace_given_top(thread, sink, depth, fr);
+
+          // This assert would seem to be valid but it is not.
+          // It would be valid if we weren't possibly racing a gc
+          // thread. A gc thread can make a valid interpreted frame
+          // look invalid. It's a small window but it does happen.
+          // The assert is left here commented out as a reminder.
+          // assert(trace->num_frames != ticks_not_walkable_not_Java, "should always be walkable");
+
+        }
+      }
+    }
+    break;
+  case _thread_in_Java:
+  case _thread_in_Java_trans:
+    {
+      frame fr;
+
+      // param isInJava == true - indicate we are in Java code
+      if (!thread->pd_get_top_frame_for_signal_handler(&fr, ucontext, true)) {
+        sink->set_num_frames(ticks_unknown_Java);  // -5 unknown frame
+      } else {
+        sink->set_num_frames(ticks_not_walkable_Java);  // -6, non walkable frame by default
+        forte_fill_call_trace_given_top(thread, sink, depth, fr);
+      }
+    }
+    break;
+  default:
+    // Unknown thread state
+    sink->set_num_frames(ticks_unknown_state); // -7
+    break;
+  }
+}
+
 
 // Forte Analyzer AsyncGetCallTrace() entry point. Currently supported
 // on Linux X86, Solaris SPARC and Solaris X86.
@@ -586,89 +775,49 @@ void AsyncGetCallTrace(ASGCT_CallTrace *trace, jint depth, void* ucontext) {
     return;
   }
 
-  if (thread->in_deopt_handler()) {
-    // thread is in the deoptimization handler so return no frames
-    trace->num_frames = ticks_deopt; // -9
-    return;
-  }
-
   // This is safe now as the thread has not terminated and so no VM exit check occurs.
   assert(thread == JavaThread::thread_from_jni_environment(trace->env_id),
          "AsyncGetCallTrace must be called by the current interrupted thread");
 
-  if (!JvmtiExport::should_post_class_load()) {
-    trace->num_frames = ticks_no_class_load; // -1
-    return;
-  }
+  CallTraceFrameSink sink(trace);
+  forte_sample_current_thread(thread, &sink, depth, ucontext);
+}
 
-  if (Universe::heap()->is_stw_gc_active()) {
-    trace->num_frames = ticks_GC_active; // -2
-    return;
+// AsyncGetStackSample() entry point.
+//
+// Like AsyncGetCallTrace(), but appends the sample to a ring owned by the
+// profiler instead of a per-call trace buffer, and folds directly
+// recursive frames (see ASGST_Frame above). The same JVM/TI CLASS_LOAD
+// requirement applies.
+//
+// jint (*AsyncGetStackSample)(ASGST_Ring* ring, jint depth, void* ucontext)
+//
+// Arguments:
+//
+//   ring     - ring of the interrupted thread, see ASGST_Ring above.
+//   depth    - maximum number of frames to walk.
+//   ucontext - ucontext_t of the LWP
+//
+// Returns the number of frames walked, or one of the negative codes that
+// AsyncGetCallTrace() stores in num_frames. The same value is stored in
+// the header entry of the sample. Nothing is written if the ring has no
+// room for a header entry.
+JNIEXPORT
+jint AsyncGetStackSample(ASGST_Ring* ring, jint depth, void* ucontext) {
+  if (ring == nullptr || ring->frames == nullptr || ring->capacity < 1) {
+    return ticks_unknown_state; // -7
   }
 
-  // signify to other code in the VM that we're in ASGCT
-  ThreadInAsgct tia(thread);
-
-  switch (thread->thread_state()) {
-  case _thread_new:
-  case _thread_uninitialized:
-  case _thread_new_trans:
-    // We found the thread on the threads list above, but it is too
-    // young to be useful so return that there are no Java frames.
-    trace->num_frames = 0;
-    break;
-  case _thread_in_native:
-  case _thread_in_native_trans:
-  case _thread_blocked:
-  case _thread_blocked_trans:
-  case _thread_in_vm:
-  case _thread_in_vm_trans:
-    {
-      frame fr;
-
-      // param isInJava == false - indicate we aren't in Java code
-      if (!thread->pd_get_top_frame_for_signal_handler(&fr, ucontext, false)) {
-        trace->num_frames = ticks_unknown_not_Java;  // -3 unknown frame
-      } else {
-        if (!thread->has_last_Java_frame()) {
-          trace->num_frames = 0; // No Java frames
-        } else {
-          trace->num_frames = ticks_not_walkable_not_Java;    // -4 non walkable frame by default
-          forte_fill_call_trace_given_top(thread, trace, depth, fr);
-
-          // This assert would seem to be valid but it is not.
-          // It would be valid if we weren't possibly racing a gc
-          // thread. A gc thread can make a valid interpreted frame
-          // look invalid. It's a small window but it does happen.
-          // The assert is left here commented out as a reminder.
-          // assert(trace->num_frames != ticks_not_walkable_not_Java, "should always be walkable");
-
-        }
-      }
-    }
-    break;
-  case _thread_in_Java:
-  case _thread_in_Java_trans:
-    {
-      frame fr;
-
-      // param isInJava == true - indicate we are in Java code
-      if (!thread->pd_get_top_frame_for_signal_handler(&fr, ucontext, true)) {
-        trace->num_frames = ticks_unknown_Java;  // -5 unknown frame
-      } else {
-        trace->num_frames = ticks_not_walkable_Java;  // -6, non walkable frame by default
-        forte_fill_call_trace_given_top(thread, trace, depth, fr);
-      }
-    }
-    break;
-  default:
-    // Unknown thread state
-    trace->num_frames = ticks_unknown_state; // -7
-    break;
+  RingFrameSink sink(ring);
+  Thread* raw_thread = Thread::current_or_null_safe();
+  if (raw_thread == nullptr || !raw_thread->is_Java_thread() ||
+      JavaThread::cast(raw_thread)->is_exiting()) {
+    sink.set_num_frames(ticks_thread_exit); // -8
+  } else {
+    forte_sample_current_thread(JavaThread::cast(raw_thread), &sink, depth, ucontext);
   }
+  return sink.publish();
 }
-
-
 #ifndef _WINDOWS
 // Support for the Forte(TM) Performance Tools collector.
 //
@@ -725,5 +874,10 @@ extern "C" {
   void AsyncGetCallTrace(ASGCT_CallTrace *trace, jint depth, void* ucontext) {
     trace->num_frames = ticks_no_class_load; // -1
   }
+
+  JNIEXPORT
+  jint AsyncGetStackSample(ASGST_Ring* ring, jint depth, void* ucontext) {
+    return ticks_no_class_load; // -1
+  }
 }
 #endif // INCLUDE_JVMTI
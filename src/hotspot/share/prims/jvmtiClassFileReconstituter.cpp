@@ -565,6 +565,16 @@ void JvmtiClassFileReconstituter::write_synthetic_attribute() {
   write_u4(0); //length always zero
 }
 
+// Write FastReturn attribute
+// JVMSpec|   FastReturn_attribute {
+// JVMSpec|     u2 attribute_name_index;
+// JVMSpec|     u4 attribute_length;
+// JVMSpec|   }
+void JvmtiClassFileReconstituter::write_fast_return_attribute() {
+  write_attribute_name_index("FastReturn");
+  write_u4(0); //length always zero
+}
+
 // Compute size of LineNumberTable
 u2 JvmtiClassFileReconstituter::line_number_table_entries(const methodHandle& method) {
   // The line number table is compressed so we don't know how big it is until decompressed.
@@ -738,6 +748,9 @@ void JvmtiClassFileReconstituter::write_method_info(const methodHandle& method)
   if (type_anno != nullptr) {
     ++attr_count;     // has RuntimeVisibleTypeAnnotations attribute
   }
+  if (const_method->has_fastreturn()) {
+    ++attr_count;     // has FastReturn attribute
+  }
 
   write_u2(checked_cast<u2>(attr_count));
   if (const_method->code_size() > 0) {
@@ -768,6 +781,9 @@ void JvmtiClassFileReconstituter::write_method_info(const methodHandle& method)
   if (type_anno != nullptr) {
     write_annotations_attribute("RuntimeVisibleTypeAnnotations", type_anno);
   }
+  if (const_method->has_fastreturn()) {
+    write_fast_return_attribute();
+  }
 }
 
 // Write the class attributes portion of ClassFile structure
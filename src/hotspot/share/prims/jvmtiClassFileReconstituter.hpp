@@ -104,6 +104,7 @@ class JvmtiClassFileReconstituter : public JvmtiConstantPoolReconstituter {
   void write_exceptions_attribute(ConstMethod* const_method);
   void write_method_parameter_attribute(const ConstMethod* const_method);
   void write_synthetic_attribute();
+  void write_fast_return_attribute();
   void write_class_attributes();
   void write_source_file_attribute();
   void write_source_debug_extension_attribute();
@@ -57,8 +57,10 @@ void JvmtiFramePop::print() {
 
 void
 JvmtiFramePops::set(JvmtiFramePop& fp) {
-  if (_pops->find(fp.frame_number()) < 0) {
-    _pops->append(fp.frame_number());
+  bool found;
+  int index = _pops->find_sorted<int, compare_frame_numbers>(fp.frame_number(), found);
+  if (!found) {
+    _pops->insert_before(index, fp.frame_number());
   }
 }
 
@@ -67,7 +69,13 @@ void
 JvmtiFramePops::clear(JvmtiFramePop& fp) {
   assert(_pops->length() > 0, "No more frame pops");
 
-  _pops->remove(fp.frame_number());
+  bool found;
+  int index = _pops->find_sorted<int, compare_frame_numbers>(fp.frame_number(), found);
+  assert(found, "frame pop not set");
+  if (found) {
+    // Frames are popped from the top of the stack, so this is usually the last element.
+    _pops->remove_at(index);
+  }
 }
 
 void
@@ -77,17 +85,14 @@ JvmtiFramePops::clear_all() {
 
 int
 JvmtiFramePops::clear_to(JvmtiFramePop& fp) {
-  int cleared = 0;
-  int index = 0;
-  while (index < _pops->length()) {
-    JvmtiFramePop pop = JvmtiFramePop(_pops->at(index));
-    if (pop.above_on_stack(fp)) {
-      _pops->remove_at(index);
-      ++cleared;
-    } else {
-      ++index;
-    }
+  // Everything above fp on the stack is at the end of the sorted array.
+  bool found;
+  int index = _pops->find_sorted<int, compare_frame_numbers>(fp.frame_number(), found);
+  if (found) {
+    index++;
   }
+  int cleared = _pops->length() - index;
+  _pops->trunc_to(index);
   return cleared;
 }
 
@@ -106,6 +111,13 @@ JvmtiFramePops::~JvmtiFramePops() {
   delete _pops;
 }
 
+bool
+JvmtiFramePops::contains(JvmtiFramePop& fp) {
+  bool found;
+  _pops->find_sorted<int, compare_frame_numbers>(fp.frame_number(), found);
+  return found;
+}
+
 
 #ifndef PRODUCT
 void JvmtiFramePops::print() {
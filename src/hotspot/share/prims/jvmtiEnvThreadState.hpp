@@ -78,8 +78,11 @@ class JvmtiFramePop {
 
 class JvmtiFramePops : public CHeapObj<mtInternal> {
  private:
+  // Frame numbers, kept sorted so lookups stay cheap in deep recursion.
   GrowableArray<int>* _pops;
 
+  static int compare_frame_numbers(const int& a, const int& b) { return a - b; }
+
   // should only be used by JvmtiEventControllerPrivate
   // to insure they only occur at safepoints.
   // Todo: add checks for safepoint
@@ -93,7 +96,7 @@ class JvmtiFramePops : public CHeapObj<mtInternal> {
   JvmtiFramePops();
   ~JvmtiFramePops();
 
-  bool contains(JvmtiFramePop& fp) { return _pops->contains(fp.frame_number()); }
+  bool contains(JvmtiFramePop& fp);
   int length() { return _pops->length(); }
   void print() PRODUCT_RETURN;
 };
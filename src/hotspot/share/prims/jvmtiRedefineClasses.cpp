@@ -37,6 +37,8 @@
 #include "classfile/vmSymbols.hpp"
 #include "code/codeCache.hpp"
 #include "compiler/compileBroker.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "interpreter/oopMapCache.hpp"
 #include "interpreter/rewriter.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -62,6 +64,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/jniHandles.inline.hpp"
 #include "runtime/relocator.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/checkedCast.hpp"
@@ -277,8 +280,7 @@ void VM_RedefineClasses::doit() {
   // that reference methods of the evolved classes.
   // Have to do this after all classes are redefined and all methods that
   // are redefined are marked as old.
-  AdjustAndCleanMetadata adjust_and_clean_metadata(current);
-  ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+  adjust_and_clean_metadata(current);
 
   // JSR-292 support
   if (_any_class_has_resolved_methods) {
@@ -3786,6 +3788,62 @@ void VM_RedefineClasses::AdjustAndCleanMetadata::do_klass(Klass* k) {
   }
 }
 
+// Each class only has its own vtable, itable, constant pool caches and
+// MethodData adjusted, so classes can be processed independently.
+class VM_RedefineClasses::AdjustAndCleanMetadataTask : public WorkerTask {
+  GrowableArray<Klass*>* _klasses;
+  volatile int           _claimed;
+
+ public:
+  AdjustAndCleanMetadataTask(GrowableArray<Klass*>* klasses) :
+    WorkerTask("Adjust and Clean Metadata"),
+    _klasses(klasses),
+    _claimed(0) {}
+
+  void work(uint worker_id) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(Thread::current());
+    for (int i = Atomic::fetch_then_add(&_claimed, 1);
+         i < _klasses->length();
+         i = Atomic::fetch_then_add(&_claimed, 1)) {
+      adjust_and_clean_metadata.do_klass(_klasses->at(i));
+    }
+  }
+};
+
+class CollectKlassesClosure : public KlassClosure {
+  GrowableArray<Klass*>* _klasses;
+ public:
+  CollectKlassesClosure(GrowableArray<Klass*>* klasses) : _klasses(klasses) {}
+  void do_klass(Klass* k) { _klasses->append(k); }
+};
+
+// Below this many classes the walk is cheaper than waking the workers.
+static const int parallel_adjust_min_classes = 1000;
+
+void VM_RedefineClasses::adjust_and_clean_metadata(Thread* current) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers == nullptr || workers->active_workers() <= 1) {
+    AdjustAndCleanMetadata adjust_and_clean_metadata(current);
+    ClassLoaderDataGraph::classes_do(&adjust_and_clean_metadata);
+    return;
+  }
+
+  ResourceMark rm(current);
+  GrowableArray<Klass*> klasses(parallel_adjust_min_classes);
+  CollectKlassesClosure collect(&klasses);
+  ClassLoaderDataGraph::classes_do(&collect);
+
+  AdjustAndCleanMetadataTask task(&klasses);
+  if (klasses.length() >= parallel_adjust_min_classes) {
+    log_debug(redefine, class, update)("adjusting metadata of %d classes with %u workers",
+                                       klasses.length(), workers->active_workers());
+    workers->run_task(&task);
+  } else {
+    task.work(0);
+  }
+}
+
 void VM_RedefineClasses::update_jmethod_ids() {
   for (int j = 0; j < _matching_methods_length; ++j) {
     Method* old_method = _matching_old_methods[j];
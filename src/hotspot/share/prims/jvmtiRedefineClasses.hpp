@@ -519,6 +519,11 @@ class VM_RedefineClasses: public VM_Operation {
     AdjustAndCleanMetadata(Thread* t) : _thread(t) {}
     void do_klass(Klass* k);
   };
+  class AdjustAndCleanMetadataTask;
+
+  // Apply AdjustAndCleanMetadata to all loaded classes, in parallel
+  // on the safepoint workers when there are enough of them.
+  void adjust_and_clean_metadata(Thread* current);
 
  public:
   VM_RedefineClasses(jint class_count,
@@ -47,8 +47,36 @@
 
 // setup and cleanup actions
 BaseFrameStream::BaseFrameStream(JavaThread* thread, Handle continuation)
-  : _thread(thread), _continuation(continuation), _anchor(0L) {
+  : _thread(thread), _continuation(continuation), _anchor(0L), _next_resolved_method(0) {
     assert(thread != nullptr, "");
+    for (int i = 0; i < resolved_method_cache_size; i++) {
+      _resolved_methods[i] = nullptr;
+    }
+}
+
+// The frames of earlier batches may have been consumed and reused by
+// the Java side, so only the frames of the current batch are looked at.
+void BaseFrameStream::begin_batch(objArrayHandle frames_array) {
+  _batch_frames = frames_array;
+  for (int i = 0; i < resolved_method_cache_size; i++) {
+    _resolved_methods[i] = nullptr;
+  }
+  _next_resolved_method = 0;
+}
+
+oop BaseFrameStream::cached_resolved_method(Method* method) {
+  for (int i = 0; i < resolved_method_cache_size; i++) {
+    if (_resolved_methods[i] == method) {
+      return java_lang_ClassFrameInfo::classOrMemberName(_batch_frames->obj_at(_resolved_method_frames[i]));
+    }
+  }
+  return nullptr;
+}
+
+void BaseFrameStream::cache_resolved_method(Method* method, int index) {
+  _resolved_methods[_next_resolved_method] = method;
+  _resolved_method_frames[_next_resolved_method] = index;
+  _next_resolved_method = (_next_resolved_method + 1) % resolved_method_cache_size;
 }
 
 void BaseFrameStream::setup_magic_on_entry(objArrayHandle frames_array) {
@@ -170,6 +198,8 @@ int StackWalk::fill_in_frames(jint mode, BaseFrameStream& stream,
   assert(buffer_size > 0, "invalid buffer_size");
   assert(buffer_size <= frames_array->length(), "oob");
 
+  stream.begin_batch(frames_array);
+
   int frames_decoded = 0;
   for (; !stream.at_end(); stream.next()) {
     if (stream.continuation() != nullptr && stream.continuation() != stream.reg_map()->cont()) {
@@ -215,7 +245,7 @@ void LiveFrameStream::fill_frame(int index, objArrayHandle  frames_array,
                                  const methodHandle& method, TRAPS) {
   HandleMark hm(THREAD);
   Handle stackFrame(THREAD, frames_array->obj_at(index));
-  fill_live_stackframe(stackFrame, method, CHECK);
+  fill_live_stackframe(index, stackFrame, method, CHECK);
 }
 
 // Fill in the StackFrameInfo at the given index in frames_array
@@ -224,7 +254,7 @@ void JavaFrameStream::fill_frame(int index, objArrayHandle  frames_array,
   if (_need_method_info) {
     HandleMark hm(THREAD);
     Handle stackFrame(THREAD, frames_array->obj_at(index));
-    fill_stackframe(stackFrame, method, CHECK);
+    fill_stackframe(index, stackFrame, method, CHECK);
   } else {
     HandleMark hm(THREAD);
     Handle stackFrame(THREAD, frames_array->obj_at(index));
@@ -329,14 +359,19 @@ objArrayHandle LiveFrameStream::monitors_to_object_array(GrowableArray<MonitorIn
 }
 
 // Fill StackFrameInfo with bci and initialize ResolvedMethodName
-void BaseFrameStream::fill_stackframe(Handle stackFrame, const methodHandle& method, TRAPS) {
-  java_lang_StackFrameInfo::set_method_and_bci(stackFrame, method, bci(), cont(), THREAD);
+void BaseFrameStream::fill_stackframe(int index, Handle stackFrame, const methodHandle& method, TRAPS) {
+  oop resolved_method = cached_resolved_method(method());
+  bool cached = resolved_method != nullptr;
+  java_lang_StackFrameInfo::set_method_and_bci(stackFrame, method, bci(), cont(), resolved_method, CHECK);
+  if (!cached) {
+    cache_resolved_method(method(), index);
+  }
 }
 
 // Fill LiveStackFrameInfo with locals, monitors, and expressions
-void LiveFrameStream::fill_live_stackframe(Handle stackFrame,
+void LiveFrameStream::fill_live_stackframe(int index, Handle stackFrame,
                                            const methodHandle& method, TRAPS) {
-  fill_stackframe(stackFrame, method, CHECK);
+  fill_stackframe(index, stackFrame, method, CHECK);
   if (_jvf != nullptr) {
     ResourceMark rm(THREAD);
     HandleMark hm(THREAD);
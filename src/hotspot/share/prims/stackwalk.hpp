@@ -42,18 +42,32 @@
 class BaseFrameStream : public StackObj {
 private:
   enum {
-    magic_pos = 0
+    magic_pos = 0,
+    resolved_method_cache_size = 4
   };
 
   JavaThread*           _thread;
   Handle                _continuation;
   jlong                 _anchor;
 
+  // Frames of the batch being filled in that already refer to the
+  // ResolvedMethodName of a method. Recursive stacks keep filling in the
+  // same few methods, and the frames buffer keeps their names alive.
+  objArrayHandle        _batch_frames;
+  Method*               _resolved_methods[resolved_method_cache_size];
+  int                   _resolved_method_frames[resolved_method_cache_size];
+  int                   _next_resolved_method;
+
+  oop cached_resolved_method(Method* method);
+  void cache_resolved_method(Method* method, int index);
+
 protected:
-  void fill_stackframe(Handle stackFrame, const methodHandle& method, TRAPS);
+  void fill_stackframe(int index, Handle stackFrame, const methodHandle& method, TRAPS);
 public:
   BaseFrameStream(JavaThread* thread, Handle continuation);
 
+  void begin_batch(objArrayHandle frames_array);
+
   virtual void    next()=0;
   virtual bool    at_end()=0;
 
@@ -118,7 +132,7 @@ class LiveFrameStream : public BaseFrameStream {
   javaVFrame*         _jvf;
   ContinuationEntry*  _cont_entry;
 
-  void fill_live_stackframe(Handle stackFrame, const methodHandle& method, TRAPS);
+  void fill_live_stackframe(int index, Handle stackFrame, const methodHandle& method, TRAPS);
   static oop create_primitive_slot_instance(StackValueCollection* values,
                                             int i, BasicType type, TRAPS);
   static objArrayHandle monitors_to_object_array(GrowableArray<MonitorInfo*>* monitors,
@@ -2337,7 +2337,7 @@ WB_ENTRY(void, WB_AsyncHandshakeWalkStack(JNIEnv* env, jobject wb, jobject threa
     void do_thread(Thread* th) {
       assert(th->is_Java_thread(), "sanity");
       // AsynchHandshake handshakes are only executed by target.
-      assert(_self == th, "Must be");
+      assert(_self == nullptr || _self == th, "Must be");
       assert(Thread::current() == th, "Must be");
       JavaThread* jt = JavaThread::cast(th);
       ResourceMark rm;
@@ -2357,6 +2357,8 @@ WB_ENTRY(void, WB_AsyncHandshakeWalkStack(JNIEnv* env, jobject wb, jobject threa
       TraceSelfHandshakeClosure* tshc = new TraceSelfHandshakeClosure(target);
       Handshake::execute(tshc, target);
     }
+  } else {
+    Handshake::execute_async(new TraceSelfHandshakeClosure(nullptr));
   }
 WB_END
 
@@ -35,6 +35,7 @@
 #include "gc/shared/threadLocalAllocBuffer.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "oops/access.inline.hpp"
@@ -2152,7 +2153,9 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     chunk->print_on(true, &ls);
   }
 
-  // Below this heuristic, we thaw the whole chunk, above it we thaw just one frame.
+  // Below this heuristic, we thaw the whole chunk, above it we thaw frames from
+  // the top until about this much has been thawed. Returning past them hits the
+  // return barrier, so a deep stack is thawed a few frames at a time on demand.
   static const int threshold = 500; // words
 
   const int full_chunk_size = chunk->stack_size() - chunk->sp(); // this initial size could be reduced if it's a partial thaw
@@ -2169,10 +2172,18 @@ NOINLINE intptr_t* Thaw<ConfigT>::thaw_fast(stackChunkOop chunk) {
     clear_chunk(chunk);
     thaw_size = full_chunk_size;
     empty = true;
-  } else { // thaw a single frame
+  } else { // thaw the top frames
     partial = true;
     thaw_size = remove_top_compiled_frame_from_chunk<check_stub>(chunk, argsize);
     empty = chunk->is_empty();
+    while (!TEST_THAW_ONE_CHUNK_FRAME && !empty && thaw_size < threshold) {
+      // The frames are contiguous in the chunk, so the arguments the previous
+      // frame got from this one are already included in this frame's size.
+      int prev_argsize = argsize;
+      int size = remove_top_compiled_frame_from_chunk<false>(chunk, argsize);
+      thaw_size += size - prev_argsize - frame::metadata_words_at_top;
+      empty = chunk->is_empty();
+    }
   }
 
   // Are we thawing the last frame(s) in the continuation
@@ -2804,6 +2815,30 @@ void ThawBase::push_return_frame(frame& f) { // see generate_cont_thaw
   assert(ContinuationHelper::Frame::assert_frame_laid_out(f), "");
 }
 
+// Remember the carrier a virtual thread is being mounted on, so schedulers
+// and diagnostics can tell when it moved to a different carrier since it
+// last ran. Only the move is reported; the first mount is not.
+static void record_vthread_carrier(JavaThread* thread) {
+  oop vthread = thread->vthread();
+  assert(java_lang_VirtualThread::is_instance(vthread), "must be mounted");
+  jlong carrier = java_lang_Thread::thread_id(thread->threadObj());
+  jlong previous = java_lang_VirtualThread::last_carrier(vthread);
+  if (previous == carrier) {
+    return;
+  }
+  java_lang_VirtualThread::set_last_carrier(vthread, carrier);
+#if INCLUDE_JFR
+  if (previous != 0) {
+    EventVirtualThreadCarrierMigration event;
+    if (event.should_commit()) {
+      event.set_previousCarrier(previous);
+      event.set_carrierThread(JFR_JVM_THREAD_ID(thread));
+      event.commit();
+    }
+  }
+#endif
+}
+
 // returns new top sp
 // called after preparations (stack overflow check and making room)
 template<typename ConfigT>
@@ -2824,6 +2859,10 @@ static inline intptr_t* thaw_internal(JavaThread* thread, const Continuation::th
 
   assert(entry->is_virtual_thread() == (entry->scope(thread) == java_lang_VirtualThread::vthread_scope()), "");
 
+  if (kind == Continuation::thaw_top && entry->is_virtual_thread()) {
+    record_vthread_carrier(thread);
+  }
+
   ContinuationWrapper cont(thread, oopCont);
   log_develop_debug(continuations)("THAW #" INTPTR_FORMAT " " INTPTR_FORMAT, cont.hash(), p2i((oopDesc*)oopCont));
 
@@ -434,6 +434,16 @@ const int ObjectAlignmentInBytes = 8;
           "Time out and warn or fail after SafepointTimeoutDelay "          \
           "milliseconds if failed to reach safepoint")                      \
                                                                             \
+  product(bool, TimeToSafepointProfile, false, DIAGNOSTIC,                  \
+          "Record the compiled safepoint polls that were reached only "     \
+          "after TimeToSafepointProfileThreshold milliseconds, and report " \
+          "them with VM.safepoint_stats and the SafepointLatePoll event")   \
+                                                                            \
+  product(double, TimeToSafepointProfileThreshold, 1.0, DIAGNOSTIC,         \
+          "Time in milliseconds a safepoint must have been pending for a "  \
+          "compiled poll to be recorded by TimeToSafepointProfile")         \
+          range(0, max_jlongDouble LP64_ONLY(/MICROUNITS))                  \
+                                                                            \
   product(bool, AbortVMOnSafepointTimeout, false, DIAGNOSTIC,               \
           "Abort upon failure to reach safepoint (see SafepointTimeout)")   \
                                                                             \
@@ -587,6 +597,12 @@ const int ObjectAlignmentInBytes = 8;
   product(ccstr, NativeMemoryTracking, DEBUG_ONLY("summary") NOT_DEBUG("off"), \
           "Native memory tracking options")                                 \
                                                                             \
+  product(size_t, NativeMemorySampleInterval, 0, DIAGNOSTIC,                \
+          "With NativeMemoryTracking=summary, record the call stack of "    \
+          "about one malloced byte in this many, so that detail reports "   \
+          "show estimated malloc sites. 0 disables sampling")               \
+          range(0, max_uintx)                                               \
+                                                                            \
   product(bool, PrintNMTStatistics, false, DIAGNOSTIC,                      \
           "Print native memory tracking summary data if it is on")          \
                                                                             \
@@ -678,6 +694,17 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, StackTraceInThrowable, true,                                \
           "Collect backtrace in throwable when exception happens")          \
                                                                             \
+  product(bool, CompactRecursiveBacktraces, true, DIAGNOSTIC,               \
+          "Store repeated cycles of frames in a throwable backtrace once, " \
+          "with a repeat count, instead of once per occurrence")            \
+                                                                            \
+  product(int, StackOverflowErrorTraceFrames, 0,                            \
+          "Record only this many frames from the top and as many from the " \
+          "bottom of the stack in a StackOverflowError thrown by the VM, "  \
+          "and report the omitted frame count in its message (0 records "   \
+          "the full stack trace)")                                          \
+          range(0, 1024)                                                    \
+                                                                            \
   product(bool, OmitStackTraceInFastThrow, true,                            \
           "Omit backtraces for some 'hot' exceptions in optimized code")    \
                                                                             \
@@ -736,6 +763,10 @@ const int ObjectAlignmentInBytes = 8;
           "when MonitorUsedDeflationThreshold is NOT exceeded (0 is off).") \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, MonitorContentionStatistics, false, DIAGNOSTIC,             \
+          "Count contended monitor enters and the time blocked in them, "   \
+          "per class of the locked object. Printed by Thread.lock_stats")   \
+                                                                            \
   product(size_t, AvgMonitorsPerThreadEstimate, 1024, DIAGNOSTIC,           \
           "Used to estimate a variable ceiling based on number of threads " \
           "for use with MonitorUsedDeflationThreshold (0 is off).")         \
@@ -748,6 +779,13 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                                 \
           range(1024, max_jint)                                             \
                                                                             \
+  product(intx, MonitorDeflationWalkMax, 0, DIAGNOSTIC,                     \
+          "The maximum number of in-use monitors to examine in one "        \
+          "deflation cycle (0 is no limit). The next cycle continues "      \
+          "where the previous one stopped, so that large monitor lists "    \
+          "are deflated and freed in slices.")                              \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MonitorUnlinkBatch, 500, DIAGNOSTIC,                        \
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
@@ -898,6 +936,12 @@ const int ObjectAlignmentInBytes = 8;
   develop(bool, TraceOopMapRewrites, false,                                 \
           "Trace rewriting of methods during oop map generation")           \
                                                                             \
+  product(int, InterpreterOopMapCacheSize, 32, EXPERIMENTAL,                \
+          "Number of entries in the per-class cache of interpreter oop"     \
+          " maps. Larger caches avoid recomputing oop maps for deep"        \
+          " interpreted stacks spanning many methods and bcis")             \
+          range(32, 8192)                                                   \
+                                                                            \
   develop(bool, TraceFinalizerRegistration, false,                          \
           "Trace registration of final references")                         \
                                                                             \
@@ -936,6 +980,14 @@ const int ObjectAlignmentInBytes = 8;
              "Reduce the number of parallel compiler threads when they "    \
              "are not used")                                                \
                                                                             \
+  product(intx, CompilerThreadQueueLatencyTarget, 0,                        \
+          "With UseDynamicNumberOfCompilerThreads, add a compiler thread "  \
+          "when the oldest task of a compile queue has waited longer than " \
+          "this many milliseconds, even if the queue is short, as long as " \
+          "all compiler threads fit the active processor count. "           \
+          "0 uses the queue length only")                                   \
+          range(0, max_jint)                                                \
+                                                                            \
   product(bool, TraceCompilerThreads, false, DIAGNOSTIC,                    \
              "Trace creation and removal of compiler threads")              \
                                                                             \
@@ -1131,6 +1183,29 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, RewriteFrequentPairs,                                    \
           "Rewrite frequently used bytecode pairs into a single bytecode")  \
                                                                             \
+  product(bool, RewriteFastReturns, true, DIAGNOSTIC,                       \
+          "Rewrite the returns of monitor-free methods that have a "        \
+          "FastReturn attribute to use a slim interpreter epilogue")        \
+                                                                            \
+  product(bool, OptimizeSelfTailCalls, true, DIAGNOSTIC,                    \
+          "Replace self-recursive tail calls in static methods carrying a " \
+          "FastReturn attribute with a jump to the method entry in the "    \
+          "interpreter and the JIT compilers")                              \
+                                                                            \
+  product(bool, BindSelfRecursiveCalls, true, DIAGNOSTIC,                   \
+          "Bind the direct self-recursive calls of a new nmethod to its "   \
+          "own verified entry at installation, skipping the first "         \
+          "resolution of these call sites")                                 \
+                                                                            \
+  product(bool, CountFastReturns, false, DIAGNOSTIC,                        \
+          "Count the frames of FastReturn methods popped by a return in "   \
+          "the sun.rt.fastReturns PerfData counters, per tier")             \
+                                                                            \
+  product(int, DeepRecursionEventDepth, 1024, DIAGNOSTIC,                   \
+          "Recursion depth from which a sampled method posts a "            \
+          "jdk.DeepRecursion event")                                        \
+          range(1, max_jint)                                                \
+                                                                            \
   product(bool, PrintInterpreter, false, DIAGNOSTIC,                        \
           "Print the generated interpreter code")                           \
                                                                             \
@@ -1497,6 +1572,16 @@ const int ObjectAlignmentInBytes = 8;
           "Compiler Thread Stack Size (in Kbytes)")                         \
           range(0, max_intx/(1 * K))                                        \
                                                                             \
+  product(size_t, StackTrimThreshold, 0,                                    \
+          "Return the stack pages left behind by a deep recursion to the "  \
+          "OS when a thread parks and its stack has been touched this "     \
+          "many bytes below the current stack depth (0 means never)")       \
+                                                                            \
+  product(uint, StackWatermarkBatchSize, 1, DIAGNOSTIC,                     \
+          "Number of frames that concurrent stack processing handles "      \
+          "each time a returning thread crosses the stack watermark")       \
+          range(1, 4096)                                                    \
+                                                                            \
   develop_pd(size_t, JVMInvokeMethodSlack,                                  \
           "Stack space (bytes) required for JVM_InvokeMethod to complete")  \
                                                                             \
@@ -1766,6 +1851,11 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, PrintConcurrentLocks, false, MANAGEABLE,                    \
           "Print java.util.concurrent locks in thread dump")                \
                                                                             \
+  product(uint, ParallelThreadDumpThreshold, 256, DIAGNOSTIC,               \
+          "Walk and format the stacks of a thread dump on the GC's "        \
+          "safepoint workers if it covers at least this many threads. "     \
+          "0 disables")                                                     \
+                                                                            \
   product(bool, PrintMethodHandleStubs, false, DIAGNOSTIC,                  \
           "Print generated stub code for method handles")                   \
                                                                             \
@@ -1820,6 +1910,10 @@ const int ObjectAlignmentInBytes = 8;
           "(will be rounded to nearest higher power of 2)")                 \
           range(minimumStringTableSize, 16777216ul /* 2^24 */)              \
                                                                             \
+  product(bool, UseStringTableBloomFilter, false, EXPERIMENTAL,             \
+          "Keep a Bloom filter of interned String hashes so that interning "\
+          "a new String skips the initial lookup in the String table")      \
+                                                                            \
   product(uintx, SymbolTableSize, defaultSymbolTableSize, EXPERIMENTAL,     \
           "Number of buckets in the JVM internal Symbol table")             \
           range(minimumSymbolTableSize, 16777216ul /* 2^24 */)              \
@@ -1940,6 +2034,10 @@ const int ObjectAlignmentInBytes = 8;
   JFR_ONLY(product(ccstr, StartFlightRecording, nullptr,                    \
           "Start flight recording with options"))                           \
                                                                             \
+  JFR_ONLY(product(bool, JfrFoldRecursiveFrames, false, EXPERIMENTAL,       \
+          "Collapse directly repeated frame cycles of recursive calls in "  \
+          "JFR stack traces, so that they do not use up the stack depth"))  \
+                                                                            \
   product(bool, UseFastUnorderedTimeStamps, false, EXPERIMENTAL,            \
           "Use platform unstable time where supported for timestamps only") \
                                                                             \
@@ -1955,6 +2053,13 @@ const int ObjectAlignmentInBytes = 8;
           "With Lightweight Locking mode, use a table to record inflated "  \
           "monitors rather than the first word of the object.")             \
                                                                             \
+  product(int, OMCacheEntries, 8, DIAGNOSTIC,                               \
+          "Number of entries of the per-thread cache of recently used "     \
+          "monitors that are filled with UseObjectMonitorTable. Lookup "    \
+          "is unchanged, so smaller values only trade hit rate for "        \
+          "cheaper misses")                                                 \
+          range(1, 8)                                                       \
+                                                                            \
   product(int, LightweightFastLockingSpins, 13, DIAGNOSTIC,                 \
           "Specifies the number of times lightweight fast locking will "    \
           "attempt to CAS the markWord before inflating. Between each "     \
@@ -1962,6 +2067,16 @@ const int ObjectAlignmentInBytes = 8;
           "a total number of spins on the order of O(2^value)")             \
           range(1, 30)                                                      \
                                                                             \
+  product(bool, MonitorNUMAHandoff, false, EXPERIMENTAL,                    \
+          "With UseNUMA, let a thread exiting a contended monitor prefer "  \
+          "a successor that blocked on the same NUMA node over the "        \
+          "oldest waiter")                                                  \
+                                                                            \
+  product(uint, MonitorNUMAHandoffLimit, 8, EXPERIMENTAL,                   \
+          "Maximum number of consecutive MonitorNUMAHandoff successors "    \
+          "chosen ahead of the oldest waiter, bounding unfairness")         \
+          range(1, 1000)                                                    \
+                                                                            \
   product(uint, TrimNativeHeapInterval, 0,                                  \
           "Interval, in ms, at which the JVM will trim the native heap if " \
           "the platform supports that. Lower values will reclaim memory "   \
@@ -1969,6 +2084,14 @@ const int ObjectAlignmentInBytes = 8;
           "(default) disables native heap trimming.")                       \
           range(0, UINT_MAX)                                                \
                                                                             \
+  product(size_t, TrimNativeHeapFreedThreshold, 0, EXPERIMENTAL,            \
+          "If non-zero and Native Memory Tracking is enabled, a periodic "  \
+          "trim is only done once the NMT malloc and arena footprint has "  \
+          "dropped by at least this many bytes from its high point since "  \
+          "the last trim. TrimNativeHeapInterval then only sets how often " \
+          "this is checked.")                                               \
+          range(0, max_uintx)                                               \
+                                                                            \
   develop(bool, SimulateFullAddressSpace, false,                            \
           "Simulates a very populated, fragmented address space; no "       \
           "targeted reservations will succeed.")                            \
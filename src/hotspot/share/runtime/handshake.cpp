@@ -85,13 +85,32 @@ class HandshakeOperation : public CHeapObj<mtThread> {
   bool is_async_exception()        { return _handshake_cl->is_async_exception(); }
 };
 
+// Reference count for a closure shared by the operations of an asynchronous
+// all-threads handshake.
+class AsyncHandshakeClosureRefs : public CHeapObj<mtThread> {
+  volatile int32_t _count;
+ public:
+  AsyncHandshakeClosureRefs(uint count) : _count((int32_t)count) {}
+  // Returns true if this was the last reference.
+  bool release() { return Atomic::sub(&_count, 1) == 0; }
+};
+
 class AsyncHandshakeOperation : public HandshakeOperation {
  private:
   jlong _start_time_ns;
+  AsyncHandshakeClosureRefs* _refs;
  public:
-  AsyncHandshakeOperation(AsyncHandshakeClosure* cl, JavaThread* target, jlong start_ns)
-    : HandshakeOperation(cl, target, nullptr), _start_time_ns(start_ns) {}
-  virtual ~AsyncHandshakeOperation() { delete _handshake_cl; }
+  AsyncHandshakeOperation(AsyncHandshakeClosure* cl, JavaThread* target, jlong start_ns,
+                          AsyncHandshakeClosureRefs* refs = nullptr)
+    : HandshakeOperation(cl, target, nullptr), _start_time_ns(start_ns), _refs(refs) {}
+  virtual ~AsyncHandshakeOperation() {
+    if (_refs == nullptr) {
+      delete _handshake_cl;
+    } else if (_refs->release()) {
+      delete _refs;
+      delete _handshake_cl;
+    }
+  }
   jlong start_time() const           { return _start_time_ns; }
 };
 
@@ -443,6 +462,25 @@ void Handshake::execute(AsyncHandshakeClosure* hs_cl, JavaThread* target) {
   target->handshake_state()->add_operation(op);
 }
 
+void Handshake::execute_async(AsyncHandshakeClosure* hs_cl) {
+  jlong start_time_ns = os::javaTimeNanos();
+
+  JavaThreadIteratorWithHandle jtiwh;
+  uint number_of_threads = jtiwh.length();
+  if (number_of_threads == 0) {
+    log_handshake_info(start_time_ns, hs_cl->name(), 0, 0, "no threads alive");
+    delete hs_cl;
+    return;
+  }
+
+  // All references are taken up front, since a thread may execute and
+  // release its operation before the remaining ones have been queued.
+  AsyncHandshakeClosureRefs* refs = new AsyncHandshakeClosureRefs(number_of_threads);
+  for (JavaThread* thr = jtiwh.next(); thr != nullptr; thr = jtiwh.next()) {
+    thr->handshake_state()->add_operation(new AsyncHandshakeOperation(hs_cl, thr, start_time_ns, refs));
+  }
+}
+
 // Filters
 static bool non_self_executable_filter(HandshakeOperation* op) {
   return !op->is_async();
@@ -589,11 +627,16 @@ bool HandshakeState::process_by_self(bool allow_suspend, bool check_async_except
         // An asynchronous handshake may put the JavaThread in blocked state (safepoint safe).
         // The destructor ~PreserveExceptionMark touches the exception oop so it must not be executed,
         // since a safepoint may be in-progress when returning from the async handshake.
+        // Only suspension and asynchronous exceptions block in place, other asynchronous
+        // operations are coalesced with the rest of the queue in this visit.
+        bool may_block = op->is_suspend() || op->is_async_exception();
         remove_op(op);
         op->do_handshake(_handshakee);
         log_handshake_info(((AsyncHandshakeOperation*)op)->start_time(), op->name(), 1, 0, "asynchronous");
         delete op;
-        return true; // Must check for safepoints
+        if (may_block) {
+          return true; // Must check for safepoints
+        }
       }
     } else {
       return false;
@@ -77,6 +77,10 @@ class Handshake : public AllStatic {
   // This version of execute() relies on a ThreadListHandle somewhere in
   // the caller's context to protect target (and we sanity check for that).
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
+  // Queues hs_cl on all JavaThreads and returns without waiting. Each thread
+  // executes it on itself at its next poll. The closure is deleted once every
+  // thread has executed it, or has exited.
+  static void execute_async(AsyncHandshakeClosure* hs_cl);
 };
 
 class JvmtiRawMonitor;
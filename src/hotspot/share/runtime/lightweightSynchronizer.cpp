@@ -26,6 +26,7 @@
 #include "jfrfiles/jfrEventClasses.hpp"
 #include "logging/log.hpp"
 #include "memory/allStatic.hpp"
+#include "memory/padded.hpp"
 #include "memory/resourceArea.hpp"
 #include "nmt/memTag.hpp"
 #include "oops/oop.inline.hpp"
@@ -47,6 +48,7 @@
 #include "utilities/concurrentHashTable.inline.hpp"
 #include "utilities/concurrentHashTableTasks.inline.hpp"
 #include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 // ConcurrentHashTable storing links from objects to ObjectMonitors
 class ObjectMonitorTable : AllStatic {
@@ -56,18 +58,28 @@ class ObjectMonitorTable : AllStatic {
       return (uintx)value->hash();
     }
     static void* allocate_node(void* context, size_t size, Value const& value) {
-      ObjectMonitorTable::inc_items_count();
+      ObjectMonitorTable::inc_items_count(value);
       return AllocateHeap(size, mtObjectMonitor);
     };
     static void free_node(void* context, void* memory, Value const& value) {
-      ObjectMonitorTable::dec_items_count();
+      ObjectMonitorTable::dec_items_count(value);
       FreeHeap(memory);
     }
   };
   using ConcurrentTable = ConcurrentHashTable<Config, mtObjectMonitor>;
 
+  // The number of items is sharded by monitor hash, so that threads
+  // inflating and deflating monitors do not all update the same cache line.
+  // A monitor is always counted in the same shard, so no shard goes negative.
+  static const uint ItemsCountShards = 16;
+  struct ItemsCount {
+    volatile size_t _value;
+    DEFINE_PAD_MINUS_SIZE(0, DEFAULT_PADDING_SIZE, sizeof(volatile size_t));
+  };
+
   static ConcurrentTable* _table;
-  static volatile size_t _items_count;
+  static ItemsCount _items_count[ItemsCountShards];
+  static size_t _peak_items_count;
   static size_t _table_size;
   static volatile bool _resize;
 
@@ -114,17 +126,28 @@ class ObjectMonitorTable : AllStatic {
     }
   };
 
-  static void inc_items_count() {
-    Atomic::inc(&_items_count, memory_order_relaxed);
+  static volatile size_t* items_count_shard(ObjectMonitor* monitor) {
+    return &_items_count[(uintx)monitor->hash() % ItemsCountShards]._value;
+  }
+
+  static void inc_items_count(ObjectMonitor* monitor) {
+    Atomic::inc(items_count_shard(monitor), memory_order_relaxed);
+  }
+
+  static void dec_items_count(ObjectMonitor* monitor) {
+    Atomic::dec(items_count_shard(monitor), memory_order_relaxed);
   }
 
-  static void dec_items_count() {
-    Atomic::dec(&_items_count, memory_order_relaxed);
+  static size_t items_count() {
+    size_t count = 0;
+    for (uint i = 0; i < ItemsCountShards; i++) {
+      count += Atomic::load(&_items_count[i]._value);
+    }
+    return count;
   }
 
   static double get_load_factor() {
-    size_t count = Atomic::load(&_items_count);
-    return (double)count / (double)_table_size;
+    return (double)items_count() / (double)_table_size;
   }
 
   static size_t table_size(Thread* current = Thread::current()) {
@@ -166,7 +189,10 @@ class ObjectMonitorTable : AllStatic {
  public:
   static void create() {
     _table = new ConcurrentTable(initial_log_size(), max_log_size(), grow_hint());
-    _items_count = 0;
+    for (uint i = 0; i < ItemsCountShards; i++) {
+      _items_count[i]._value = 0;
+    }
+    _peak_items_count = 0;
     _table_size = table_size();
     _resize = false;
   }
@@ -237,14 +263,31 @@ class ObjectMonitorTable : AllStatic {
     return false;
   }
 
+  // The table is never shrunk, so size it for the peak number of monitors
+  // seen so far with room to spare. A burst of inflation then grows the
+  // table in one resize cycle instead of one doubling per cycle.
+  static size_t grow_target_log_size() {
+    _peak_items_count = MAX2(_peak_items_count, items_count());
+    const size_t wanted = (size_t)(_peak_items_count / (GROW_LOAD_FACTOR / 2));
+    return clamp_log_size(log2i_ceil(MAX2(wanted, (size_t)1)));
+  }
+
   static bool grow(JavaThread* current) {
-    ConcurrentTable::GrowTask grow_task(_table);
-    if (run_task(current, grow_task, "Grow")) {
+    const size_t target_log_size = grow_target_log_size();
+    bool grown = false;
+    do {
+      ConcurrentTable::GrowTask grow_task(_table);
+      if (!run_task(current, grow_task, "Grow")) {
+        break;
+      }
+      grown = true;
+    } while (_table->get_size_log2(current) < target_log_size);
+
+    if (grown) {
       _table_size = table_size(current);
-      log_info(monitortable)("Grown to size: %zu", _table_size);
-      return true;
+      log_info(monitortable)("Grown to size: %zu (peak items: %zu)", _table_size, _peak_items_count);
     }
-    return false;
+    return grown;
   }
 
   static bool clean(JavaThread* current) {
@@ -328,7 +371,8 @@ class ObjectMonitorTable : AllStatic {
 };
 
 ObjectMonitorTable::ConcurrentTable* ObjectMonitorTable::_table = nullptr;
-volatile size_t ObjectMonitorTable::_items_count = 0;
+ObjectMonitorTable::ItemsCount ObjectMonitorTable::_items_count[ObjectMonitorTable::ItemsCountShards];
+size_t ObjectMonitorTable::_peak_items_count = 0;
 size_t ObjectMonitorTable::_table_size = 0;
 volatile bool ObjectMonitorTable::_resize = false;
 
@@ -674,6 +718,13 @@ void LightweightSynchronizer::enter(Handle obj, BasicLock* lock, JavaThread* cur
 
   LockStack& lock_stack = current->lock_stack();
 
+  if (lock_stack.is_full() && lock_stack.is_top(obj()) && lock_stack.bottom() != obj()) {
+    // Recursive enter of the most recent lock on a full lock-stack. Make room
+    // by inflating older locks instead, so that the recursion on the hot
+    // object stays fast locked.
+    ensure_lock_stack_space(current);
+  }
+
   if (!lock_stack.is_full() && lock_stack.try_recursive_enter(obj())) {
     // Recursively fast locked
     return;
@@ -98,6 +98,9 @@ class LockStack {
   // Is the lock-stack empty.
   inline bool is_empty() const;
 
+  // Check if the oop is the most recently pushed one.
+  inline bool is_top(oop o) const;
+
   // Check if object is recursive.
   // Precondition: This lock-stack must contain the oop.
   inline bool is_recursive(oop o) const;
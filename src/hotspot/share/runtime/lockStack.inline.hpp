@@ -86,6 +86,11 @@ inline bool LockStack::is_empty() const {
   return to_index(_top) == 0;
 }
 
+inline bool LockStack::is_top(oop o) const {
+  int end = to_index(_top);
+  return end > 0 && _base[end - 1] == o;
+}
+
 inline bool LockStack::is_recursive(oop o) const {
   if (!VM_Version::supports_recursive_lightweight_locking()) {
     return false;
@@ -250,7 +255,7 @@ inline void LockStack::oops_do(OopClosure* cl) {
 }
 
 inline void OMCache::set_monitor(ObjectMonitor *monitor) {
-  const int end = OMCache::CAPACITY - 1;
+  const int end = OMCacheEntries - 1;
 
   oop obj = monitor->object_peek();
   assert(obj != nullptr, "must be alive");
@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "memory/resourceArea.hpp"
+#include "oops/klass.hpp"
+#include "oops/oop.inline.hpp"
+#include "oops/symbol.hpp"
+#include "runtime/atomic.hpp"
+#include "runtime/monitorContentionStats.hpp"
+#include "utilities/growableArray.hpp"
+#include "utilities/ostream.hpp"
+
+MonitorContentionStats::Entry MonitorContentionStats::_table[MonitorContentionStats::table_size];
+MonitorContentionStats::Entry MonitorContentionStats::_overflow;
+
+struct ContentionRow {
+  Symbol* _name;
+  uint64_t _count;
+  uint64_t _blocked_nanos;
+};
+
+static int compare_by_blocked_time(ContentionRow* a, ContentionRow* b) {
+  return a->_blocked_nanos < b->_blocked_nanos ? 1 : (a->_blocked_nanos > b->_blocked_nanos ? -1 : 0);
+}
+
+MonitorContentionStats::Entry* MonitorContentionStats::lookup_or_insert(Symbol* name) {
+  size_t index = name->identity_hash() & (table_size - 1);
+  for (size_t probe = 0; probe < max_probes; probe++) {
+    Entry* e = &_table[(index + probe) & (table_size - 1)];
+    Symbol* cur = Atomic::load_acquire(&e->_name);
+    if (cur == name) {
+      return e;
+    }
+    if (cur == nullptr) {
+      // The table owns a reference to each name it holds.
+      name->increment_refcount();
+      cur = Atomic::cmpxchg(&e->_name, (Symbol*)nullptr, name);
+      if (cur == nullptr) {
+        return e;
+      }
+      name->decrement_refcount();
+      if (cur == name) {
+        return e;
+      }
+    }
+  }
+  return &_overflow;
+}
+
+void MonitorContentionStats::record(oop obj, jlong blocked_nanos) {
+  Entry* e = lookup_or_insert(obj->klass()->name());
+  Atomic::inc(&e->_count, memory_order_relaxed);
+  Atomic::add(&e->_blocked_nanos, (uint64_t)MAX2(blocked_nanos, (jlong)0), memory_order_relaxed);
+}
+
+void MonitorContentionStats::print_on(outputStream* st, int limit) {
+  ResourceMark rm;
+  GrowableArray<ContentionRow> rows;
+  uint64_t total_count = 0;
+  uint64_t total_nanos = 0;
+  for (size_t i = 0; i < table_size; i++) {
+    Symbol* name = Atomic::load_acquire(&_table[i]._name);
+    uint64_t count = Atomic::load(&_table[i]._count);
+    if (name != nullptr && count > 0) {
+      uint64_t nanos = Atomic::load(&_table[i]._blocked_nanos);
+      ContentionRow row = { name, count, nanos };
+      rows.append(row);
+      total_count += count;
+      total_nanos += nanos;
+    }
+  }
+  rows.sort(compare_by_blocked_time);
+
+  const uint64_t overflow_count = Atomic::load(&_overflow._count);
+  const uint64_t overflow_nanos = Atomic::load(&_overflow._blocked_nanos);
+  total_count += overflow_count;
+  total_nanos += overflow_nanos;
+
+  st->print_cr("Contended monitor enters: " UINT64_FORMAT ", blocked: " UINT64_FORMAT " ms",
+               total_count, total_nanos / NANOSECS_PER_MILLISEC);
+  st->print_cr("%12s %14s %12s  %s", "enters", "blocked (ms)", "avg (us)", "class");
+  for (int i = 0; i < rows.length() && i < limit; i++) {
+    const ContentionRow& r = rows.at(i);
+    st->print_cr(UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(14) " " UINT64_FORMAT_W(12) "  %s",
+                 r._count, r._blocked_nanos / NANOSECS_PER_MILLISEC,
+                 r._blocked_nanos / r._count / (NANOUNITS / MICROUNITS),
+                 r._name->as_klass_external_name());
+  }
+  if (overflow_count > 0) {
+    st->print_cr(UINT64_FORMAT_W(12) " " UINT64_FORMAT_W(14) " " UINT64_FORMAT_W(12) "  <other classes>",
+                 overflow_count, overflow_nanos / NANOSECS_PER_MILLISEC,
+                 overflow_nanos / overflow_count / (NANOUNITS / MICROUNITS));
+  }
+}
+
+void MonitorContentionStats::reset() {
+  for (size_t i = 0; i < table_size; i++) {
+    Atomic::store(&_table[i]._count, (uint64_t)0);
+    Atomic::store(&_table[i]._blocked_nanos, (uint64_t)0);
+  }
+  Atomic::store(&_overflow._count, (uint64_t)0);
+  Atomic::store(&_overflow._blocked_nanos, (uint64_t)0);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_RUNTIME_MONITORCONTENTIONSTATS_HPP
+#define SHARE_RUNTIME_MONITORCONTENTIONSTATS_HPP
+
+#include "memory/allStatic.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class outputStream;
+class Symbol;
+
+// Aggregate statistics of contended monitor enters, keyed by the class
+// name of the locked object. Enabled with MonitorContentionStatistics and
+// printed by the Thread.lock_stats diagnostic command.
+//
+// The table is a fixed-size, insert-only open addressing table updated
+// with atomics, so recording never takes a lock. Keying by class name
+// rather than by monitor keeps the statistics across monitor deflation
+// and class unloading; the names are kept alive by their refcount.
+class MonitorContentionStats : AllStatic {
+  struct Entry {
+    Symbol* volatile _name;
+    volatile uint64_t _count;
+    volatile uint64_t _blocked_nanos;
+  };
+
+  static const size_t table_size = 1024;
+  static const size_t max_probes = 16;
+  static Entry _table[table_size];
+  // Contention on classes that did not fit into the table.
+  static Entry _overflow;
+
+  static Entry* lookup_or_insert(Symbol* name);
+
+public:
+  // Records one contended enter of obj's monitor that blocked for the
+  // given time.
+  static void record(oop obj, jlong blocked_nanos);
+
+  // Prints the classes with the most total blocked time, at most limit.
+  static void print_on(outputStream* st, int limit);
+
+  // Zeroes all counters; class names stay in the table.
+  static void reset();
+};
+
+#endif // SHARE_RUNTIME_MONITORCONTENTIONSTATS_HPP
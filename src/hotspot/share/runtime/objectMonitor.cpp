@@ -44,10 +44,12 @@
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/lightweightSynchronizer.hpp"
+#include "runtime/monitorContentionStats.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/objectMonitor.hpp"
 #include "runtime/objectMonitor.inline.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safefetch.hpp"
 #include "runtime/safepointMechanism.inline.hpp"
@@ -294,6 +296,7 @@ ObjectMonitor::ObjectMonitor(oop object) :
   _entry_list_tail(nullptr),
   _succ(NO_OWNER),
   _SpinDuration(ObjectMonitor::Knob_SpinLimit),
+  _numa_handoffs(0),
   _contentions(0),
   _wait_set(nullptr),
   _waiters(0),
@@ -539,6 +542,7 @@ void ObjectMonitor::enter_with_contention_mark(JavaThread* current, ObjectMonito
     enter_event.set_address((uintptr_t)this);
   }
   EventVirtualThreadPinned vthread_pinned_event;
+  const jlong contention_start = MonitorContentionStatistics ? os::javaTimeNanos() : 0;
 
   freeze_result result;
 
@@ -640,6 +644,9 @@ void ObjectMonitor::enter_with_contention_mark(JavaThread* current, ObjectMonito
     enter_event.set_previousOwner(_previous_owner_tid);
     enter_event.commit();
   }
+  if (contention_start != 0) {
+    MonitorContentionStats::record(object(), os::javaTimeNanos() - contention_start);
+  }
 
   if (current->current_waiting_monitor() == nullptr) {
     ContinuationEntry* ce = current->last_continuation();
@@ -1519,6 +1526,9 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
         // are woken up in FIFO order, we need to find the tail of the
         // entry_list.
         w = entry_list_tail(current);
+        if (MonitorNUMAHandoff && UseNUMA) {
+          w = numa_successor(current, w);
+        }
         // I'd like to write: guarantee (w->_thread != current).
         // But in practice an exiting thread may find itself on the entry_list.
         // Let's say thread T1 calls O.wait().  Wait() enqueues T1 on O's waitset and
@@ -1589,6 +1599,30 @@ void ObjectMonitor::exit(JavaThread* current, bool not_suspended) {
   }
 }
 
+// Look for a waiter that blocked on the same NUMA node as the exiting
+// thread, starting from the oldest one, so that the monitor and the data it
+// protects stay in that node's caches. This is bounded both in how far
+// the entry_list is searched and in how many successors in a row can be
+// chosen this way, after which the oldest waiter goes next regardless.
+ObjectWaiter* ObjectMonitor::numa_successor(JavaThread* current, ObjectWaiter* tail) {
+  assert(has_owner(current), "invariant");
+  static const int MaxScan = 16;
+
+  if (_numa_handoffs < MonitorNUMAHandoffLimit) {
+    const int numa_id = os::numa_get_group_id();
+    int scanned = 0;
+    for (ObjectWaiter* w = tail; w != nullptr && scanned < MaxScan; w = w->prev(), scanned++) {
+      assert(w->TState == ObjectWaiter::TS_ENTER, "invariant");
+      if (w->_numa_id == numa_id) {
+        _numa_handoffs = (w == tail) ? 0 : _numa_handoffs + 1;
+        return w;
+      }
+    }
+  }
+  _numa_handoffs = 0;
+  return tail;
+}
+
 void ObjectMonitor::exit_epilog(JavaThread* current, ObjectWaiter* Wakee) {
   assert(has_owner(current), "invariant");
 
@@ -2455,6 +2489,7 @@ ObjectWaiter::ObjectWaiter(JavaThread* current) {
   _monitor  = nullptr;
   _notifier_tid = 0;
   _recursions = 0;
+  _numa_id  = (current != nullptr && MonitorNUMAHandoff && UseNUMA) ? os::numa_get_group_id() : -1;
   TState    = TS_RUN;
   _notified = false;
   _is_wait  = false;
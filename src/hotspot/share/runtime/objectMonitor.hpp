@@ -50,6 +50,7 @@ class ObjectWaiter : public CHeapObj<mtThread> {
   ObjectMonitor* _monitor;
   uint64_t  _notifier_tid;
   int         _recursions;
+  int         _numa_id;       // NUMA node the thread blocked on, or -1 if not recorded
   volatile TStates TState;
   volatile bool _notified;
   bool           _is_wait;
@@ -194,6 +195,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   int64_t volatile _succ;           // Heir presumptive thread - used for futile wakeup throttling
 
   volatile int _SpinDuration;
+  uint _numa_handoffs;              // Consecutive successors chosen by NUMA node, see MonitorNUMAHandoff
 
   int _contentions;                 // Number of active contentions in enter(). It is used by is_busy()
                                     // along with other fields to determine if an ObjectMonitor can be
@@ -406,6 +408,7 @@ class ObjectMonitor : public CHeapObj<mtObjectMonitor> {
   void      entry_list_build_dll(JavaThread* current);
   void      unlink_after_acquire(JavaThread* current, ObjectWaiter* current_node);
   ObjectWaiter* entry_list_tail(JavaThread* current);
+  ObjectWaiter* numa_successor(JavaThread* current, ObjectWaiter* tail);
 
   bool      vthread_monitor_enter(JavaThread* current, ObjectWaiter* node = nullptr);
   void      vthread_wait(JavaThread* current, jlong millis);
@@ -65,6 +65,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/quickSort.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
@@ -763,6 +764,13 @@ void ThreadSafepointState::handle_polling_page_exception() {
   assert(cb != nullptr && cb->is_nmethod(), "return address should be in nmethod");
   nmethod* nm = cb->as_nmethod();
 
+  if (TimeToSafepointProfile && SafepointSynchronize::is_synchronizing()) {
+    jlong delay_ns = os::javaTimeNanos() - SafepointTracing::start_of_safepoint();
+    if (delay_ns >= (jlong)(TimeToSafepointProfileThreshold * NANOSECS_PER_MILLISEC)) {
+      SafepointTracing::record_late_poll(self, nm, real_return_addr, delay_ns);
+    }
+  }
+
   // Find frame of caller
   frame stub_fr = self->last_frame();
   CodeBlob* stub_cb = stub_fr.cb();
@@ -942,6 +950,124 @@ void SafepointTracing::statistics_exit_log() {
                               (int64_t)(_max_vmop_time));
 }
 
+// Time-to-safepoint profile. Compiled polls that a thread reached only after
+// the safepoint had been pending for TimeToSafepointProfileThreshold are
+// aggregated per poll site. The site is the innermost scope at the poll, so
+// a poll on the back-edge of an inlined loop is attributed to that loop.
+struct LatePollSite {
+  char     _method[256];
+  int      _bci;
+  int      _comp_level;
+  uint64_t _count;
+  jlong    _total_ns;
+  jlong    _max_ns;
+};
+
+static const int LatePollSites = 64;
+static LatePollSite _late_poll_sites[LatePollSites];
+static int _late_poll_site_count = 0;
+static volatile int _late_poll_lock = 0;
+
+void SafepointTracing::record_late_poll(JavaThread* thread, nmethod* nm, address pc, jlong delay_ns) {
+  ResourceMark rm(thread);
+  ScopeDesc* sd = nm->scope_desc_near(pc);
+  Method* method = sd->method();
+  int bci = sd->bci();
+
+  char name[sizeof(_late_poll_sites[0]._method)];
+  method->name_and_sig_as_C_string(name, sizeof(name));
+
+  Thread::SpinAcquire(&_late_poll_lock);
+  LatePollSite* site = nullptr;
+  for (int i = 0; i < _late_poll_site_count; i++) {
+    LatePollSite* s = &_late_poll_sites[i];
+    if (s->_bci == bci && s->_comp_level == nm->comp_level() && strcmp(s->_method, name) == 0) {
+      site = s;
+      break;
+    }
+  }
+  if (site == nullptr) {
+    if (_late_poll_site_count < LatePollSites) {
+      site = &_late_poll_sites[_late_poll_site_count++];
+    } else {
+      // Evict the site that delayed safepoints the least.
+      site = &_late_poll_sites[0];
+      for (int i = 1; i < LatePollSites; i++) {
+        if (_late_poll_sites[i]._total_ns < site->_total_ns) {
+          site = &_late_poll_sites[i];
+        }
+      }
+    }
+    strncpy(site->_method, name, sizeof(site->_method));
+    site->_method[sizeof(site->_method) - 1] = '\0';
+    site->_bci = bci;
+    site->_comp_level = nm->comp_level();
+    site->_count = 0;
+    site->_total_ns = 0;
+    site->_max_ns = 0;
+  }
+  site->_count++;
+  site->_total_ns += delay_ns;
+  site->_max_ns = MAX2(site->_max_ns, delay_ns);
+  Thread::SpinRelease(&_late_poll_lock);
+
+  EventSafepointLatePoll event(UNTIMED);
+  if (event.should_commit()) {
+    event.set_endtime(JfrTicks::now());
+    event.set_safepointId(SafepointSynchronize::safepoint_id() + 1);
+    event.set_method(method);
+    event.set_lineNumber(method->line_number_from_bci(bci));
+    event.set_bci(bci);
+    event.set_compileId(nm->compile_id());
+    event.set_timeToSafepoint(delay_ns);
+    event.commit();
+  }
+}
+
+void SafepointTracing::reset_time_to_safepoint_profile() {
+  Thread::SpinAcquire(&_late_poll_lock);
+  _late_poll_site_count = 0;
+  Thread::SpinRelease(&_late_poll_lock);
+}
+
+static int compare_late_poll_sites(LatePollSite a, LatePollSite b) {
+  return a._total_ns < b._total_ns ? 1 : (a._total_ns > b._total_ns ? -1 : 0);
+}
+
+void SafepointTracing::print_statistics(outputStream* st) {
+  st->print_cr("Safepoint operations:");
+  for (int index = 0; index < VM_Operation::VMOp_Terminating; index++) {
+    if (_op_count[index] != 0) {
+      st->print_cr("  %-28s" UINT64_FORMAT_W(10), VM_Operation::name(index), _op_count[index]);
+    }
+  }
+  st->print_cr("Maximum sync time: " INT64_FORMAT " ns", (int64_t)_max_sync_time);
+  st->print_cr("Maximum vm operation time: " INT64_FORMAT " ns", (int64_t)_max_vmop_time);
+
+  if (!TimeToSafepointProfile) {
+    st->print_cr("Time-to-safepoint profile disabled, use -XX:+TimeToSafepointProfile");
+    return;
+  }
+
+  // Copy the sites out so that recording threads are not held up by printing.
+  LatePollSite* sites = NEW_RESOURCE_ARRAY(LatePollSite, LatePollSites);
+  Thread::SpinAcquire(&_late_poll_lock);
+  int count = _late_poll_site_count;
+  memcpy(sites, _late_poll_sites, count * sizeof(LatePollSite));
+  Thread::SpinRelease(&_late_poll_lock);
+  QuickSort::sort(sites, count, compare_late_poll_sites);
+
+  st->print_cr("Compiled polls reached after %.3f ms:", TimeToSafepointProfileThreshold);
+  st->print_cr("  %10s %12s %12s  %s", "count", "total ms", "max ms", "method @ bci (tier)");
+  for (int i = 0; i < count; i++) {
+    st->print_cr("  " UINT64_FORMAT_W(10) " %12.3f %12.3f  %s @ %d (%d)",
+                 sites[i]._count,
+                 (double)sites[i]._total_ns / NANOSECS_PER_MILLISEC,
+                 (double)sites[i]._max_ns / NANOSECS_PER_MILLISEC,
+                 sites[i]._method, sites[i]._bci, sites[i]._comp_level);
+  }
+}
+
 void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
   _op_count[type]++;
   _current_type = type;
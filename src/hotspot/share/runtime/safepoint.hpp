@@ -46,6 +46,7 @@
 // exit safepoint methods, when a thread is blocked/restarted. Hence, all mutex exter/
 // exit points *must* be at a safepoint.
 
+class nmethod;
 class ThreadSafepointState;
 
 class SafepointStateTracker {
@@ -257,6 +258,11 @@ class SafepointTracing : public AllStatic {
 
   static void statistics_exit_log();
 
+  // Time-to-safepoint profile of compiled polls that were reached late.
+  static void record_late_poll(JavaThread* thread, nmethod* nm, address pc, jlong delay_ns);
+  static void print_statistics(outputStream* st);
+  static void reset_time_to_safepoint_profile();
+
   static jlong time_since_last_safepoint_ms() {
     return nanos_to_millis(os::javaTimeNanos() - _last_safepoint_end_time_ns);
   }
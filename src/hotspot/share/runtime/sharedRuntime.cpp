@@ -889,7 +889,7 @@ void SharedRuntime::throw_StackOverflowError_common(JavaThread* current, bool de
   }
   Handle exception (current, exception_oop);
   if (StackTraceInThrowable) {
-    java_lang_Throwable::fill_in_stack_trace(exception);
+    java_lang_Throwable::fill_in_stack_overflow_trace(exception);
   }
   // Remove the ScopedValue bindings in case we got a
   // StackOverflowError while we were trying to remove ScopedValue
@@ -254,3 +254,25 @@ bool StackOverflow::reguard_stack(void) {
 bool StackOverflow::reguard_stack_if_needed() {
   return !stack_guards_enabled() ? reguard_stack() : true;
 }
+
+void StackOverflow::trim_unused_stack(address cur_sp) {
+  if (!stack_guards_enabled()) {
+    return;
+  }
+  const size_t page_size = os::vm_page_size();
+  // Keep the shadow zone below the current frames, everything deeper than
+  // that was last touched by frames that have returned since. Banging for
+  // stack growth touched at most a shadow zone below the growth watermark.
+  address top = align_down(cur_sp - stack_shadow_zone_size(), page_size);
+  address bottom = align_down(shadow_zone_growth_watermark() - stack_shadow_zone_size(), page_size);
+  bottom = MAX2(bottom, align_up(stack_reserved_zone_base(), page_size));
+  if (top <= bottom || (size_t)(top - bottom) < StackTrimThreshold) {
+    return;
+  }
+  os::disclaim_memory((char*)bottom, top - bottom);
+  // The pages are gone, so the stack must be banged again before it grows
+  // back into them.
+  set_shadow_zone_growth_watermark(stack_base());
+  log_debug(os, thread)("Thread trimmed %zuK of unused stack [" PTR_FORMAT ", " PTR_FORMAT ")",
+                        (size_t)(top - bottom) / K, p2i(bottom), p2i(top));
+}
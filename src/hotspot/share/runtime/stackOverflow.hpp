@@ -351,6 +351,11 @@ class StackOverflow {
   bool reguard_stack(void);
   bool reguard_stack_if_needed(void);
 
+  // Give the pages deep recursion has touched below the current sp back
+  // to the OS, if there are at least StackTrimThreshold bytes of them.
+  // The pages stay reserved and are faulted back in on the next use.
+  void trim_unused_stack(address cur_sp);
+
   void set_stack_overflow_limit() {
     _stack_overflow_limit =
       stack_end() + MAX2(stack_guard_zone_size(), stack_shadow_zone_size());
@@ -25,6 +25,7 @@
 #include "logging/log.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/osThread.hpp"
 #include "runtime/safepoint.hpp"
@@ -95,6 +96,7 @@ class StackWatermarkProcessingMark {
 
 void StackWatermarkFramesIterator::process_one(void* context) {
   StackWatermarkProcessingMark swpm(Thread::current());
+  uint processed = 0;
   while (has_next()) {
     frame f = current();
     uintptr_t sp = reinterpret_cast<uintptr_t>(f.sp());
@@ -103,7 +105,11 @@ void StackWatermarkFramesIterator::process_one(void* context) {
     next();
     if (frame_has_barrier) {
       set_watermark(sp);
-      break;
+      // Deep stacks are processed several frames at a time, so that a
+      // thread returning through them hits the watermark less often.
+      if (++processed == StackWatermarkBatchSize) {
+        break;
+      }
     }
   }
 }
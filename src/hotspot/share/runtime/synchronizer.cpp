@@ -104,14 +104,17 @@ class ObjectMonitorDeflationSafepointer : public StackObj {
   void block_for_safepoint(const char* op_name, const char* count_name, size_t counter);
 };
 
-// Walk the in-use list and unlink deflated ObjectMonitors.
+// Walk the in-use list and unlink deflated ObjectMonitors. If start_after
+// is not null, the deflation walk started after it, and so does this walk:
+// start_after was not deflated, and new monitors are only added at the head.
 // Returns the number of unlinked ObjectMonitors.
 size_t MonitorList::unlink_deflated(size_t deflated_count,
+                                    ObjectMonitor* start_after,
                                     GrowableArray<ObjectMonitor*>* unlinked_list,
                                     ObjectMonitorDeflationSafepointer* safepointer) {
   size_t unlinked_count = 0;
-  ObjectMonitor* prev = nullptr;
-  ObjectMonitor* m = Atomic::load_acquire(&_head);
+  ObjectMonitor* prev = start_after;
+  ObjectMonitor* m = (start_after != nullptr) ? start_after->next_om() : Atomic::load_acquire(&_head);
 
   while (m != nullptr) {
     if (m->is_being_async_deflated()) {
@@ -314,6 +317,11 @@ bool volatile ObjectSynchronizer::_is_final_audit = false;
 jlong ObjectSynchronizer::_last_async_deflation_time_ns = 0;
 static uintx _no_progress_cnt = 0;
 static bool _no_progress_skip_increment = false;
+// Last monitor examined, and not deflated, by a deflation cycle that was cut
+// short by MonitorDeflationWalkMax, or null to continue from the head. Only
+// the deflation thread unlinks and frees monitors, so it is still on the
+// in-use list when the next cycle continues after it.
+static ObjectMonitor* _deflation_resume_point = nullptr;
 
 // =====================> Quick functions
 
@@ -1641,26 +1649,55 @@ ObjectMonitor* ObjectSynchronizer::inflate_impl(JavaThread* locking_thread, oop
 }
 
 // Walk the in-use list and deflate (at most MonitorDeflationMax) idle
-// ObjectMonitors. Returns the number of deflated ObjectMonitors.
+// ObjectMonitors. With MonitorDeflationWalkMax, examine at most that many
+// monitors, starting after where the previous walk stopped, and set
+// *partial if the walk stopped short of the end of the list. *start_after
+// is set to the monitor the walk started after, or null for the head.
+// Returns the number of deflated ObjectMonitors.
 //
-size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer) {
-  MonitorList::Iterator iter = _in_use_list.iterator();
+size_t ObjectSynchronizer::deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer,
+                                                size_t* examined_count, bool* partial,
+                                                ObjectMonitor** start_after) {
+  ObjectMonitor* resume_point = _deflation_resume_point;
+  if (resume_point != nullptr && resume_point->next_om() == nullptr) {
+    resume_point = nullptr;
+  }
+  *start_after = resume_point;
+  MonitorList::Iterator iter = (resume_point != nullptr)
+                                 ? MonitorList::Iterator(resume_point->next_om())
+                                 : _in_use_list.iterator();
+  // Deflated monitors are unlinked after the walk, so the next walk can only
+  // resume after one that was kept, or after the previous resume point.
+  ObjectMonitor* last_kept = resume_point;
   size_t deflated_count = 0;
+  size_t examined = 0;
   Thread* current = Thread::current();
 
+  _deflation_resume_point = nullptr;
+  *partial = false;
   while (iter.has_next()) {
     if (deflated_count >= (size_t)MonitorDeflationMax) {
       break;
     }
+    if (MonitorDeflationWalkMax > 0 && examined >= (size_t)MonitorDeflationWalkMax) {
+      // Out of budget.
+      _deflation_resume_point = last_kept;
+      *partial = true;
+      break;
+    }
     ObjectMonitor* mid = iter.next();
+    examined++;
     if (mid->deflate_monitor(current)) {
       deflated_count++;
+    } else {
+      last_kept = mid;
     }
 
     // Must check for a safepoint/handshake and honor it.
     safepointer->block_for_safepoint("deflation", "deflated_count", deflated_count);
   }
 
+  *examined_count = examined;
   return deflated_count;
 }
 
@@ -1808,11 +1845,15 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   ObjectMonitorDeflationLogging log;
   ObjectMonitorDeflationSafepointer safepointer(current, &log);
+  EventJavaMonitorDeflationCycle event;
 
   log.begin();
 
   // Deflate some idle ObjectMonitors.
-  size_t deflated_count = deflate_monitor_list(&safepointer);
+  size_t examined_count = 0;
+  bool partial = false;
+  ObjectMonitor* start_after = nullptr;
+  size_t deflated_count = deflate_monitor_list(&safepointer, &examined_count, &partial, &start_after);
 
   // Unlink the deflated ObjectMonitors from the in-use list.
   size_t unlinked_count = 0;
@@ -1820,7 +1861,9 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
   if (deflated_count > 0) {
     ResourceMark rm(current);
     GrowableArray<ObjectMonitor*> delete_list((int)deflated_count);
-    unlinked_count = _in_use_list.unlink_deflated(deflated_count, &delete_list, &safepointer);
+    // Everything deflated lies after start_after, so do not walk the part
+    // of the list that earlier slices already covered.
+    unlinked_count = _in_use_list.unlink_deflated(deflated_count, start_after, &delete_list, &safepointer);
 
 #ifdef ASSERT
     if (UseObjectMonitorTable) {
@@ -1854,9 +1897,25 @@ size_t ObjectSynchronizer::deflate_idle_monitors() {
 
   log.end(deflated_count, unlinked_count);
 
+  if (event.should_commit()) {
+    event.set_examined(examined_count);
+    event.set_deflated(deflated_count);
+    event.set_inUse(in_use_list_count());
+    event.set_partial(partial);
+    event.commit();
+  }
+
   GVars.stw_random = os::random();
 
-  if (deflated_count != 0) {
+  if (partial) {
+    // Continue with the next slice right away, rather than after the next
+    // deflation interval. A slice that found nothing to deflate is not a
+    // no-progress cycle, the rest of the list has not been looked at yet.
+    set_is_async_deflation_requested(true);
+    if (deflated_count != 0) {
+      _no_progress_cnt = 0;
+    }
+  } else if (deflated_count != 0) {
     _no_progress_cnt = 0;
   } else if (_no_progress_skip_increment) {
     _no_progress_skip_increment = false;
@@ -50,6 +50,7 @@ class MonitorList {
   MonitorList() : _head(nullptr), _count(0), _max(0) {};
   void add(ObjectMonitor* monitor);
   size_t unlink_deflated(size_t deflated_count,
+                         ObjectMonitor* start_after,
                          GrowableArray<ObjectMonitor*>* unlinked_list,
                          ObjectMonitorDeflationSafepointer* safepointer);
   size_t count() const;
@@ -187,7 +188,9 @@ class ObjectSynchronizer : AllStatic {
   static size_t deflate_idle_monitors();
 
   // Deflate idle monitors:
-  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer);
+  static size_t deflate_monitor_list(ObjectMonitorDeflationSafepointer* safepointer,
+                                     size_t* examined_count, bool* partial,
+                                     ObjectMonitor** start_after);
   static size_t in_use_list_count();
   static size_t in_use_list_max();
   static size_t in_use_list_ceiling();
@@ -41,10 +41,12 @@
 #include "compiler/compilerThread.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "gc/shared/barrierSetNMethod.hpp"
+#include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/gcVMOperations.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "jvm.h"
 #include "jvmtifiles/jvmtiEnv.hpp"
@@ -65,6 +67,7 @@
 #include "prims/jvmtiAgentList.hpp"
 #include "prims/jvmtiEnvBase.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlagLimit.hpp"
 #include "runtime/globals.hpp"
@@ -1359,6 +1362,112 @@ class PrintOnClosure : public ThreadClosure {
   }
 };
 
+// Prints the part of a full thread dump that belongs to one JavaThread.
+class JavaThreadDumpPrinter : public StackObj {
+private:
+  bool _print_stacks;
+  bool _internal_format;
+  bool _print_extended_info;
+#if INCLUDE_SERVICES
+  ConcurrentLocksDump* _concurrent_locks; // null unless locks are printed
+#endif // INCLUDE_SERVICES
+
+public:
+  JavaThreadDumpPrinter(bool print_stacks, bool internal_format, bool print_extended_info) :
+      _print_stacks(print_stacks),
+      _internal_format(internal_format),
+      _print_extended_info(print_extended_info)
+#if INCLUDE_SERVICES
+      , _concurrent_locks(nullptr)
+#endif // INCLUDE_SERVICES
+      {}
+
+#if INCLUDE_SERVICES
+  void set_concurrent_locks(ConcurrentLocksDump* concurrent_locks) {
+    _concurrent_locks = concurrent_locks;
+  }
+#endif // INCLUDE_SERVICES
+
+  void print(JavaThread* p, outputStream* st) const {
+    ResourceMark rm;
+    p->print_on(st, _print_extended_info);
+    if (_print_stacks) {
+      if (_internal_format) {
+        p->trace_stack();
+      } else {
+        p->print_stack_on(st);
+        if (p->is_vthread_mounted()) {
+          st->print_cr("   Mounted virtual thread #" INT64_FORMAT, java_lang_Thread::thread_id(p->vthread()));
+          p->print_vthread_stack_on(st);
+        }
+      }
+    }
+    st->cr();
+#if INCLUDE_SERVICES
+    if (_concurrent_locks != nullptr) {
+      _concurrent_locks->print_locks_on(p, st);
+    }
+#endif // INCLUDE_SERVICES
+  }
+};
+
+// Formats the dumps of a window of JavaThreads on the safepoint workers.
+// Every thread is printed into its own buffer; the VM thread then emits
+// the buffers in list order, so the output matches the serial dump.
+class ParallelJavaThreadDumpTask : public WorkerTask {
+private:
+  const JavaThreadDumpPrinter* _printer;
+  ThreadsList*                 _list;
+  uint                         _begin;
+  uint                         _end;
+  char**                       _texts;
+  volatile uint                _claimed;
+
+public:
+  ParallelJavaThreadDumpTask(const JavaThreadDumpPrinter* printer, ThreadsList* list,
+                             uint begin, uint end, char** texts) :
+      WorkerTask("Parallel Thread Dump"),
+      _printer(printer),
+      _list(list),
+      _begin(begin),
+      _end(end),
+      _texts(texts),
+      _claimed(begin) {}
+
+  void work(uint worker_id) {
+    Thread* current = Thread::current();
+    for (uint i = Atomic::fetch_then_add(&_claimed, 1u);
+         i < _end;
+         i = Atomic::fetch_then_add(&_claimed, 1u)) {
+      HandleMark hm(current);
+      stringStream ss;
+      _printer->print(_list->thread_at(i), &ss);
+      _texts[i - _begin] = ss.as_string(true /* c_heap */);
+    }
+  }
+};
+
+// Threads formatted per round of the parallel dump; bounds the amount of
+// dump text buffered at a time.
+static const uint ParallelThreadDumpWindow = 1024;
+
+static void print_java_threads_parallel_on(outputStream* st, const JavaThreadDumpPrinter* printer,
+                                           WorkerThreads* workers) {
+  ThreadsList* list = ThreadsSMRSupport::get_java_thread_list();
+  const uint length = list->length();
+  char** texts = NEW_C_HEAP_ARRAY(char*, MIN2(length, ParallelThreadDumpWindow), mtServiceability);
+  for (uint begin = 0; begin < length; begin += ParallelThreadDumpWindow) {
+    const uint end = MIN2(length, begin + ParallelThreadDumpWindow);
+    ParallelJavaThreadDumpTask task(printer, list, begin, end, texts);
+    workers->run_task(&task);
+    for (uint i = 0; i < end - begin; i++) {
+      st->print_raw(texts[i]);
+      FREE_C_HEAP_ARRAY(char, texts[i]);
+    }
+  }
+  FREE_C_HEAP_ARRAY(char*, texts);
+}
+
 // Threads::print_on() is called at safepoint by VM_PrintThreads operation.
 void Threads::print_on(outputStream* st, bool print_stacks,
                        bool internal_format, bool print_concurrent_locks,
@@ -1383,26 +1492,29 @@ void Threads::print_on(outputStream* st, bool print_stacks,
   ThreadsSMRSupport::print_info_on(st);
   st->cr();
 
-  ALL_JAVA_THREADS(p) {
-    ResourceMark rm;
-    p->print_on(st, print_extended_info);
-    if (print_stacks) {
-      if (internal_format) {
-        p->trace_stack();
-      } else {
-        p->print_stack_on(st);
-        if (p->is_vthread_mounted()) {
-          st->print_cr("   Mounted virtual thread #" INT64_FORMAT, java_lang_Thread::thread_id(p->vthread()));
-          p->print_vthread_stack_on(st);
-        }
-      }
-    }
-    st->cr();
+  JavaThreadDumpPrinter printer(print_stacks, internal_format, print_extended_info);
 #if INCLUDE_SERVICES
-    if (print_concurrent_locks) {
-      concurrent_locks.print_locks_on(p, st);
-    }
+  if (print_concurrent_locks) {
+    printer.set_concurrent_locks(&concurrent_locks);
+  }
 #endif // INCLUDE_SERVICES
+
+  // Walking and formatting the stacks dominates the dump of a process with
+  // many threads. At a safepoint the stacks cannot change, so the VM thread
+  // can hand the formatting to the safepoint workers, if the GC has any.
+  WorkerThreads* workers = nullptr;
+  if (print_stacks && !internal_format && ParallelThreadDumpThreshold > 0 &&
+      SafepointSynchronize::is_at_safepoint() && Thread::current()->is_VM_thread() &&
+      ThreadsSMRSupport::get_java_thread_list()->length() >= ParallelThreadDumpThreshold) {
+    workers = Universe::heap()->safepoint_workers();
+  }
+
+  if (workers != nullptr) {
+    print_java_threads_parallel_on(st, &printer, workers);
+  } else {
+    ALL_JAVA_THREADS(p) {
+      printer.print(p, st);
+    }
   }
 
   PrintOnClosure cl(st);
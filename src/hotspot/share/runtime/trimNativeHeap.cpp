@@ -24,7 +24,10 @@
  *
  */
 
+#include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
+#include "nmt/mallocTracker.hpp"
+#include "nmt/memTracker.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/mutex.hpp"
@@ -52,6 +55,27 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   // Statistics
   uint64_t _num_trims_performed;
+  uint64_t _num_trims_skipped;
+
+  // With TrimNativeHeapFreedThreshold, the highest NMT malloc footprint
+  // seen at a check since the last trim. Only touched by the trimmer.
+  size_t _nmt_high_water;
+
+  static bool trim_on_freed_bytes() {
+    return TrimNativeHeapFreedThreshold > 0 && MemTracker::enabled();
+  }
+
+  static size_t nmt_malloc_footprint() {
+    return MallocMemorySummary::as_snapshot()->total();
+  }
+
+  // Returns the number of bytes the NMT footprint dropped from its high
+  // point since the last trim, updating the high point on the way.
+  size_t nmt_freed_since_last_trim() {
+    const size_t current = nmt_malloc_footprint();
+    _nmt_high_water = MAX2(_nmt_high_water, current);
+    return _nmt_high_water - current;
+  }
 
   bool is_suspended() const {
     assert(_lock->is_locked(), "Must be");
@@ -127,21 +151,45 @@ class NativeHeapTrimmerThread : public NamedThread {
       log_trace(trimnative)("Times: %u suspended, %u timed, %u safepoint",
                             times_suspended, times_waited, times_safepoint);
 
-      execute_trim_and_log(tnow);
+      size_t freed = 0;
+      if (trim_on_freed_bytes()) {
+        freed = nmt_freed_since_last_trim();
+        if (freed < TrimNativeHeapFreedThreshold) {
+          _num_trims_skipped++;
+          log_trace(trimnative)("Trim skipped, " PROPERFMT " freed since last trim",
+                                PROPERFMTARGS(freed));
+          continue;
+        }
+      }
+
+      execute_trim_and_log(tnow, freed);
     }
   }
 
   // Execute the native trim, log results.
-  void execute_trim_and_log(double t1) {
+  void execute_trim_and_log(double t1, size_t freed) {
     assert(os::can_trim_native_heap(), "Unexpected");
 
     os::size_change_t sc = { 0, 0 };
     LogTarget(Info, trimnative) lt;
     const bool logging_enabled = lt.is_enabled();
+    EventNativeHeapTrim event;
+    const bool need_size_change = logging_enabled || event.should_commit();
 
-    // We only collect size change information if we are logging; save the access to procfs otherwise.
-    if (os::trim_native_heap(logging_enabled ? &sc : nullptr)) {
+    // We only collect size change information if we are logging or recording;
+    // save the access to procfs otherwise.
+    if (os::trim_native_heap(need_size_change ? &sc : nullptr)) {
       _num_trims_performed++;
+      if (trim_on_freed_bytes()) {
+        _nmt_high_water = nmt_malloc_footprint();
+      }
+      if (event.should_commit()) {
+        const bool known = need_size_change && sc.after != SIZE_MAX;
+        event.set_rssBefore(known ? sc.before : 0);
+        event.set_rssAfter(known ? sc.after : 0);
+        event.set_freedSinceLastTrim(freed);
+        event.commit();
+      }
       if (logging_enabled) {
         double t2 = now();
         if (sc.after != SIZE_MAX) {
@@ -166,7 +214,9 @@ class NativeHeapTrimmerThread : public NamedThread {
     _lock(new (std::nothrow) PaddedMonitor(Mutex::nosafepoint, "NativeHeapTrimmer_lock")),
     _stop(false),
     _suspend_count(0),
-    _num_trims_performed(0)
+    _num_trims_performed(0),
+    _num_trims_skipped(0),
+    _nmt_high_water(0)
   {
     set_name("Native Heap Trimmer");
     if (os::create_thread(this, os::vm_thread)) {
@@ -210,17 +260,20 @@ class NativeHeapTrimmerThread : public NamedThread {
 
   void print_state(outputStream* st) const {
     int64_t num_trims = 0;
+    int64_t num_skipped = 0;
     bool stopped = false;
     uint16_t suspenders = 0;
     {
       // Don't pull lock during error reporting
       ConditionalMutexLocker ml(_lock, !VMError::is_error_reported(), Mutex::_no_safepoint_check_flag);
       num_trims = _num_trims_performed;
+      num_skipped = _num_trims_skipped;
       stopped = _stop;
       suspenders = _suspend_count;
     }
-    st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d",
-                 num_trims, suspenders, stopped);
+    st->print_cr("Trims performed: " UINT64_FORMAT ", current suspend count: %d, stopped: %d"
+                 ", skipped: " UINT64_FORMAT,
+                 num_trims, suspenders, stopped, num_skipped);
   }
 
 }; // NativeHeapTrimmer
@@ -237,6 +290,13 @@ void NativeHeapTrimmer::initialize() {
     }
     g_trimmer_thread = new NativeHeapTrimmerThread();
     log_info(trimnative)("Periodic native trim enabled (interval: %u ms)", TrimNativeHeapInterval);
+    if (TrimNativeHeapFreedThreshold > 0) {
+      if (MemTracker::enabled()) {
+        log_info(trimnative)("Trimming only after " PROPERFMT " freed", PROPERFMTARGS(TrimNativeHeapFreedThreshold));
+      } else {
+        log_warning(trimnative)("TrimNativeHeapFreedThreshold requires NativeMemoryTracking; trimming at every interval");
+      }
+    }
   }
 }
 
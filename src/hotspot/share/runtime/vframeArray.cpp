@@ -179,7 +179,9 @@ void vframeArrayElement::unpack_on_stack(int caller_actual_parameters,
                                          frame* caller,
                                          bool is_top_frame,
                                          bool is_bottom_frame,
-                                         int exec_mode) {
+                                         int exec_mode,
+                                         vframeArrayUnpackCache* cache) {
+  assert(cache == nullptr || !is_top_frame, "only callers are cached");
   JavaThread* thread = JavaThread::current();
 
   bool realloc_failure_exception = thread->frames_to_pop_failed_realloc() > 0;
@@ -201,7 +203,14 @@ void vframeArrayElement::unpack_on_stack(int caller_actual_parameters,
     pc  = Interpreter::deopt_reexecute_entry(method(), bcp);
   } else {
     bcp = method()->bcp_from(bci());
-    pc  = Interpreter::deopt_continue_after_entry(method(), bcp, callee_parameters, is_top_frame);
+    if (cache != nullptr && cache->pc() != nullptr) {
+      pc = cache->pc();
+    } else {
+      pc = Interpreter::deopt_continue_after_entry(method(), bcp, callee_parameters, is_top_frame);
+      if (cache != nullptr) {
+        cache->set_pc(pc);
+      }
+    }
     use_next_mdp = true;
   }
   assert(Bytecodes::is_defined(*bcp), "must be a valid bytecode");
@@ -324,9 +333,17 @@ void vframeArrayElement::unpack_on_stack(int caller_actual_parameters,
   if (ProfileInterpreter) {
     MethodData* mdo = method()->method_data();
     if (mdo != nullptr) {
-      int bci = iframe()->interpreter_frame_bci();
-      if (use_next_mdp) ++bci;
-      address mdp = mdo->bci_to_dp(bci);
+      address mdp;
+      if (use_next_mdp && cache != nullptr && cache->mdp() != nullptr) {
+        mdp = cache->mdp();
+      } else {
+        int bci = iframe()->interpreter_frame_bci();
+        if (use_next_mdp) ++bci;
+        mdp = mdo->bci_to_dp(bci);
+        if (use_next_mdp && cache != nullptr) {
+          cache->set_mdp(mdp);
+        }
+      }
       iframe()->interpreter_frame_set_mdp(mdp);
     }
   }
@@ -602,18 +619,25 @@ void vframeArray::unpack_to_stack(frame &unpack_frame, int exec_mode, int caller
   // Do the unpacking of interpreter frames; the frame at index 0 represents the top activation, so it has no callee
   // Unpack the frames from the oldest (frames() -1) to the youngest (0)
   frame* caller_frame = &me;
+  vframeArrayUnpackCache cache;
   for (index = frames() - 1; index >= 0 ; index--) {
     vframeArrayElement* elem = element(index);  // caller
     int callee_parameters, callee_locals;
     if (index == 0) {
       callee_parameters = callee_locals = 0;
     } else {
-      methodHandle caller(current, elem->method());
-      methodHandle callee(current, element(index - 1)->method());
-      Bytecode_invoke inv(caller, elem->bci());
-      const bool has_member_arg = inv.has_member_arg();
-      callee_parameters = callee->size_of_parameters() + (has_member_arg ? 1 : 0);
-      callee_locals     = callee->max_locals();
+      Method* callee_method = element(index - 1)->method();
+      if (cache.matches(elem->method(), elem->raw_bci(), callee_method)) {
+        callee_parameters = cache.callee_parameters();
+      } else {
+        methodHandle caller(current, elem->method());
+        methodHandle callee(current, callee_method);
+        Bytecode_invoke inv(caller, elem->bci());
+        const bool has_member_arg = inv.has_member_arg();
+        callee_parameters = callee->size_of_parameters() + (has_member_arg ? 1 : 0);
+        cache.set(elem->method(), elem->raw_bci(), callee_method, callee_parameters);
+      }
+      callee_locals     = callee_method->max_locals();
     }
     if (TraceDeoptimization) {
       ResourceMark rm;
@@ -639,7 +663,8 @@ void vframeArray::unpack_to_stack(frame &unpack_frame, int exec_mode, int caller
                           caller_frame,
                           index == 0,
                           index == frames() - 1,
-                          exec_mode);
+                          exec_mode,
+                          index == 0 ? nullptr : &cache);
     if (index == frames() - 1) {
       Deoptimization::unwind_callee_save_values(elem->iframe(), this);
     }
@@ -45,6 +45,45 @@ class MonitorStackClosure;
 class MonitorArrayElement;
 class StackValueCollection;
 
+// Remembers what unpacking a vframeArrayElement derived from its method and
+// bci alone. The frames of inlined recursion repeat the same caller method,
+// bci and callee many times in one vframeArray, and reuse the results of
+// the previous element instead of decoding the invoke again.
+
+class vframeArrayUnpackCache : public StackObj {
+  private:
+    Method* _method;
+    int     _bci;
+    Method* _callee;
+    int     _callee_parameters;
+    address _pc;
+    address _mdp;
+
+  public:
+    vframeArrayUnpackCache() :
+      _method(nullptr), _bci(0), _callee(nullptr), _callee_parameters(0),
+      _pc(nullptr), _mdp(nullptr) {}
+
+    bool matches(Method* method, int bci, Method* callee) const {
+      return _method == method && _bci == bci && _callee == callee;
+    }
+
+    void set(Method* method, int bci, Method* callee, int callee_parameters) {
+      _method = method;
+      _bci = bci;
+      _callee = callee;
+      _callee_parameters = callee_parameters;
+      _pc = nullptr;
+      _mdp = nullptr;
+    }
+
+    int callee_parameters() const     { return _callee_parameters; }
+    address pc() const                { return _pc; }
+    void set_pc(address pc)           { _pc = pc; }
+    address mdp() const               { return _mdp; }
+    void set_mdp(address mdp)         { _mdp = mdp; }
+};
+
 // A vframeArrayElement is an element of a vframeArray. Each element
 // represent an interpreter frame which will eventually be created.
 
@@ -95,14 +134,16 @@ class vframeArrayElement {
                     bool is_top_frame,
                     int popframe_extra_stack_expression_els) const;
 
-  // Unpacks the element to skeletal interpreter frame
+  // Unpacks the element to skeletal interpreter frame; 'cache' is keyed
+  // by this element and null for the top frame
   void unpack_on_stack(int caller_actual_parameters,
                        int callee_parameters,
                        int callee_locals,
                        frame* caller,
                        bool is_top_frame,
                        bool is_bottom_frame,
-                       int exec_mode);
+                       int exec_mode,
+                       vframeArrayUnpackCache* cache);
 
 #ifdef ASSERT
   void set_removed_monitors() {
@@ -50,6 +50,7 @@
   template(CollectForMetadataAllocation)          \
   template(CollectForCodeCacheAllocation)         \
   template(GC_HeapInspection)                     \
+  template(EpsilonCheckpoint)                     \
   template(SerialCollectForAllocation)            \
   template(SerialGCCollect)                       \
   template(ParallelCollectForAllocation)          \
@@ -30,6 +30,7 @@
 #include "compiler/compileBroker.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/isGCActiveMark.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "logging/logConfiguration.hpp"
@@ -39,8 +40,10 @@
 #include "memory/universe.hpp"
 #include "oops/symbol.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/deoptimization.hpp"
 #include "runtime/frame.inline.hpp"
+#include "runtime/handles.inline.hpp"
 #include "runtime/interfaceSupport.inline.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/jniHandles.hpp"
@@ -410,6 +413,10 @@ void VM_ThreadDump::doit() {
     ObjectSynchronizer::request_deflate_idle_monitors();
   }
 
+  // The stacks are walked once all snapshots exist, so that the walks
+  // can be spread over the safepoint workers.
+  GrowableArray<ThreadSnapshot*> snapshots(_num_threads > 0 ? _num_threads : _result->t_list()->length());
+
   if (_num_threads == 0) {
     // Snapshot all live threads
 
@@ -424,7 +431,7 @@ void VM_ThreadDump::doit() {
       if (_with_locked_synchronizers) {
         tcl = concurrent_locks.thread_concurrent_locks(jt);
       }
-      snapshot_thread(jt, tcl, &object_monitors);
+      snapshots.append(snapshot_thread(jt, tcl));
     }
   } else {
     // Snapshot threads in the given _threads array
@@ -439,8 +446,8 @@ void VM_ThreadDump::doit() {
         continue;
       }
 
-      // Dump thread stack only if the thread is alive and not exiting
-      // and not VM internal thread.
+      // Snapshot the thread, and walk its stack in dump_stacks, only if
+      // the thread is alive and not exiting and not VM internal thread.
       JavaThread* jt = java_lang_Thread::thread(th());
       if (jt != nullptr && !_result->t_list()->includes(jt)) {
         // _threads[i] doesn't refer to a valid JavaThread; this check
@@ -459,16 +466,60 @@ void VM_ThreadDump::doit() {
       if (_with_locked_synchronizers) {
         tcl = concurrent_locks.thread_concurrent_locks(jt);
       }
-      snapshot_thread(jt, tcl, &object_monitors);
+      snapshots.append(snapshot_thread(jt, tcl));
     }
   }
+
+  dump_stacks(&snapshots, &object_monitors);
 }
 
-void VM_ThreadDump::snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl,
-                                    ObjectMonitorsView* monitors) {
+ThreadSnapshot* VM_ThreadDump::snapshot_thread(JavaThread* java_thread, ThreadConcurrentLocks* tcl) {
   ThreadSnapshot* snapshot = _result->add_thread_snapshot(java_thread);
-  snapshot->dump_stack_at_safepoint(_max_depth, _with_locked_monitors, monitors, false);
   snapshot->set_concurrent_locks(tcl);
+  return snapshot;
+}
+
+// Walks the stacks of the snapshotted threads. Each snapshot only touches
+// its own thread's frames, and the monitor view is read-only here, so the
+// snapshots can be claimed by the safepoint workers in any order.
+class ThreadDumpStacksTask : public WorkerTask {
+  GrowableArray<ThreadSnapshot*>* _snapshots;
+  ObjectMonitorsView*             _monitors;
+  int                             _max_depth;
+  bool                            _with_locked_monitors;
+  volatile int                    _claimed;
+
+ public:
+  ThreadDumpStacksTask(GrowableArray<ThreadSnapshot*>* snapshots, ObjectMonitorsView* monitors,
+                       int max_depth, bool with_locked_monitors) :
+    WorkerTask("Thread Dump Stacks"),
+    _snapshots(snapshots),
+    _monitors(monitors),
+    _max_depth(max_depth),
+    _with_locked_monitors(with_locked_monitors),
+    _claimed(0) {}
+
+  void work(uint worker_id) {
+    Thread* current = Thread::current();
+    for (int i = Atomic::fetch_then_add(&_claimed, 1);
+         i < _snapshots->length();
+         i = Atomic::fetch_then_add(&_claimed, 1)) {
+      ResourceMark rm(current);
+      HandleMark hm(current);
+      _snapshots->at(i)->dump_stack_at_safepoint(_max_depth, _with_locked_monitors, _monitors, false);
+    }
+  }
+};
+
+void VM_ThreadDump::dump_stacks(GrowableArray<ThreadSnapshot*>* snapshots, ObjectMonitorsView* monitors) {
+  ThreadDumpStacksTask task(snapshots, monitors, _max_depth, _with_locked_monitors);
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && ParallelThreadDumpThreshold > 0 &&
+      (uint)snapshots->length() >= ParallelThreadDumpThreshold) {
+    workers->run_task(&task);
+  } else {
+    task.work(0);
+  }
 }
 
 volatile bool VM_Exit::_vm_exited = false;
@@ -51,10 +51,16 @@
 #include "prims/jvmtiAgentList.hpp"
 #include "runtime/fieldDescriptor.inline.hpp"
 #include "runtime/flags/jvmFlag.hpp"
+#include "runtime/frame.inline.hpp"
 #include "runtime/handles.inline.hpp"
+#include "runtime/handshake.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/jniHandles.hpp"
+#include "runtime/monitorContentionStats.hpp"
 #include "runtime/os.hpp"
+#include "runtime/safepoint.hpp"
+#include "runtime/stackFrameStream.inline.hpp"
+#include "runtime/threadSMR.inline.hpp"
 #include "runtime/vmOperations.hpp"
 #include "runtime/vm_version.hpp"
 #include "services/diagnosticArgument.hpp"
@@ -66,8 +72,14 @@
 #include "utilities/debug.hpp"
 #include "utilities/events.hpp"
 #include "utilities/formatBuffer.hpp"
+#include "utilities/growableArray.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/parseInteger.hpp"
+#include "utilities/resizeableResourceHash.hpp"
+#include "utilities/resourceHash.hpp"
+#if INCLUDE_EPSILONGC
+#include "gc/epsilon/epsilonHeap.hpp"
+#endif
 #ifdef LINUX
 #include "os_posix.hpp"
 #include "mallocInfoDcmd.hpp"
@@ -105,10 +117,14 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMDynamicLibrariesDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMUptimeDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<VMInfoDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SafepointStatsDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<SystemGCDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<RunFinalizationDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapInfoDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<FinalizerInfoDCmd>(full_export, true, false));
+#if INCLUDE_EPSILONGC
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<EpsilonCheckpointDCmd>(full_export, true, false));
+#endif // INCLUDE_EPSILONGC
 #if INCLUDE_SERVICES
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<HeapDumpDCmd>(DCmd_Source_Internal | DCmd_Source_AttachAPI, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ClassHistogramDCmd>(full_export, true, false));
@@ -127,6 +143,8 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<JVMTIDataDumpDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadStackUsageDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadLockStatsDCmd>(full_export, true, false));
 #if INCLUDE_JVMTI
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<ThreadDumpToFileDCmd>(full_export, true, false));
 #endif // INCLUDE_JVMTI
@@ -137,6 +155,7 @@ void DCmd::register_dcmds(){
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CompileQueueDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeListDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<CodeCacheDCmd>(full_export, true, false));
+  DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<DumpHotMethodsDCmd>(full_export, true, false));
 #ifdef LINUX
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<PerfMapDCmd>(full_export, true, false));
   DCmdFactory::register_DCmdFactory(new DCmdFactoryImpl<TrimCLibcHeapDCmd>(full_export, true, false));
@@ -400,6 +419,20 @@ void VMInfoDCmd::execute(DCmdSource source, TRAPS) {
   VMError::print_vm_info(_output);
 }
 
+SafepointStatsDCmd::SafepointStatsDCmd(outputStream* output, bool heap) :
+                                       DCmdWithParser(output, heap),
+  _reset("-reset", "Clear the time-to-safepoint profile after printing it",
+         "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void SafepointStatsDCmd::execute(DCmdSource source, TRAPS) {
+  SafepointTracing::print_statistics(output());
+  if (_reset.value()) {
+    SafepointTracing::reset_time_to_safepoint_profile();
+  }
+}
+
 void SystemGCDCmd::execute(DCmdSource source, TRAPS) {
   Universe::heap()->collect(GCCause::_dcmd_gc_run);
 }
@@ -554,6 +587,24 @@ void ClassHistogramDCmd::execute(DCmdSource source, TRAPS) {
 
 #endif // INCLUDE_SERVICES
 
+#if INCLUDE_EPSILONGC
+EpsilonCheckpointDCmd::EpsilonCheckpointDCmd(outputStream* output, bool heap) :
+                                             DCmdWithParser(output, heap),
+  _reset("-reset", "Discard everything allocated since the last checkpoint, "
+         "if nothing allocated before it refers to it",
+         "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void EpsilonCheckpointDCmd::execute(DCmdSource source, TRAPS) {
+  if (!UseEpsilonGC) {
+    output()->print_cr("Checkpoints are only supported with -XX:+UseEpsilonGC");
+    return;
+  }
+  EpsilonHeap::checkpoint(_reset.value(), output());
+}
+#endif // INCLUDE_EPSILONGC
+
 ThreadDumpDCmd::ThreadDumpDCmd(outputStream* output, bool heap) :
                                DCmdWithParser(output, heap),
   _locks("-l", "print java.util.concurrent locks", "BOOLEAN", false, "false"),
@@ -572,6 +623,197 @@ void ThreadDumpDCmd::execute(DCmdSource source, TRAPS) {
   VMThread::execute(&op2);
 }
 
+ThreadLockStatsDCmd::ThreadLockStatsDCmd(outputStream* output, bool heap) :
+                                         DCmdWithParser(output, heap),
+  _top("-top", "Number of classes to print", "INT", false, "20"),
+  _reset("-reset", "Reset the statistics after printing them", "BOOLEAN", false, "false") {
+  _dcmdparser.add_dcmd_option(&_top);
+  _dcmdparser.add_dcmd_option(&_reset);
+}
+
+void ThreadLockStatsDCmd::execute(DCmdSource source, TRAPS) {
+  if (!MonitorContentionStatistics) {
+    output()->print_cr("Monitor contention statistics are not enabled, use -XX:+MonitorContentionStatistics");
+    return;
+  }
+  MonitorContentionStats::print_on(output(), (int)MIN2(_top.value(), (jlong)max_jint));
+  if (_reset.value()) {
+    MonitorContentionStats::reset();
+  }
+}
+
+// Cumulative stack usage of one method, over all frames of all threads.
+struct MethodStackUsage {
+  size_t _bytes;
+  size_t _frames;
+  MethodStackUsage() : _bytes(0), _frames(0) {}
+};
+
+static unsigned method_stack_usage_hash(const char* const& name) {
+  unsigned hash = 0;
+  for (const char* p = name; *p != '\0'; p++) {
+    hash = 31 * hash + (unsigned char)*p;
+  }
+  return hash;
+}
+
+static bool method_stack_usage_equals(const char* const& a, const char* const& b) {
+  return strcmp(a, b) == 0;
+}
+
+// Keyed by external method name rather than Method*, since classes may be
+// unloaded at safepoints between the handshakes with the individual threads.
+typedef ResizeableResourceHashtable<const char*, MethodStackUsage, AnyObj::C_HEAP, mtServiceability,
+                                    method_stack_usage_hash, method_stack_usage_equals> MethodStackUsageTable;
+
+class ThreadStackUsageClosure : public HandshakeClosure {
+  MethodStackUsageTable* _methods;
+  bool   _executed;
+  size_t _depth;
+  size_t _high_water;
+  int    _frames;
+
+ public:
+  ThreadStackUsageClosure(MethodStackUsageTable* methods) :
+    HandshakeClosure("ThreadStackUsage"), _methods(methods),
+    _executed(false), _depth(0), _high_water(0), _frames(0) {}
+
+  void reset() {
+    _executed = false;
+    _depth = 0;
+    _high_water = 0;
+    _frames = 0;
+  }
+
+  void do_thread(Thread* thread) {
+    JavaThread* jt = JavaThread::cast(thread);
+    _executed = true;
+    if (jt->has_last_Java_frame()) {
+      _depth = pointer_delta(jt->stack_base(), jt->last_Java_sp(), sizeof(char));
+    } else if (jt == Thread::current()) {
+      _depth = pointer_delta(jt->stack_base(), os::current_stack_pointer(), sizeof(char));
+    }
+    // The growth watermark is the deepest SP the stack was banged for since
+    // the thread started or its stack was last trimmed.
+    StackOverflow* overflow_state = jt->stack_overflow_state();
+    _high_water = MAX2(_depth, pointer_delta(jt->stack_base(), overflow_state->shadow_zone_growth_watermark(), sizeof(char)));
+
+    if (!jt->has_last_Java_frame()) {
+      return;
+    }
+    ResourceMark rm;
+    // Deep recursion repeats the same few methods, so only resolve each
+    // method's name once per thread.
+    ResourceHashtable<Method*, MethodStackUsage*> seen;
+    for (StackFrameStream fst(jt, false /* update */, true /* process_frames */); !fst.is_done(); fst.next()) {
+      frame* fr = fst.current();
+      _frames++;
+      Method* m = nullptr;
+      if (fr->is_interpreted_frame()) {
+        m = fr->interpreter_frame_method();
+      } else if (fr->is_compiled_frame()) {
+        // Inlined methods are accounted to the method that was compiled.
+        m = fr->cb()->as_nmethod()->method();
+      }
+      if (m == nullptr) {
+        continue;
+      }
+      bool created;
+      MethodStackUsage** usage = seen.put_if_absent(m, &created);
+      if (created) {
+        const char* name = m->external_name();
+        MethodStackUsage* entry = _methods->get(name);
+        if (entry == nullptr) {
+          entry = _methods->put_if_absent(os::strdup(name, mtServiceability), &created);
+        }
+        *usage = entry;
+      }
+      (*usage)->_bytes += (size_t)fr->frame_size() * wordSize;
+      (*usage)->_frames++;
+    }
+  }
+
+  bool executed() const      { return _executed; }
+  size_t depth() const       { return _depth; }
+  size_t high_water() const  { return _high_water; }
+  int frames() const         { return _frames; }
+};
+
+ThreadStackUsageDCmd::ThreadStackUsageDCmd(outputStream* output, bool heap) :
+                                           DCmdWithParser(output, heap),
+  _top("-top", "Number of methods to print, ordered by cumulative frame bytes",
+       "INT", false, "20") {
+  _dcmdparser.add_dcmd_option(&_top);
+}
+
+struct MethodStackUsageEntry {
+  const char* _name;
+  MethodStackUsage _usage;
+};
+
+static int compare_stack_usage(MethodStackUsageEntry* a, MethodStackUsageEntry* b) {
+  if (a->_usage._bytes != b->_usage._bytes) {
+    return a->_usage._bytes > b->_usage._bytes ? -1 : 1;
+  }
+  return strcmp(a->_name, b->_name);
+}
+
+void ThreadStackUsageDCmd::execute(DCmdSource source, TRAPS) {
+  jlong top = _top.value();
+  if (top < 0) {
+    output()->print_cr("Number of methods out of range (>=0): " JLONG_FORMAT, top);
+    return;
+  }
+
+  MethodStackUsageTable methods(256, 64 * K);
+  ThreadStackUsageClosure cl(&methods);
+  size_t max_depth = 0;
+  size_t max_high_water = 0;
+  int threads = 0;
+
+  output()->print_cr("Java thread stack usage (depth / high-water mark / reserved):");
+  {
+    ThreadsListHandle tlh;
+    for (uint i = 0; i < tlh.length(); i++) {
+      JavaThread* jt = tlh.thread_at(i);
+      cl.reset();
+      Handshake::execute(&cl, &tlh, jt);
+      if (!cl.executed()) {
+        // The thread exited before the handshake reached it.
+        continue;
+      }
+      ResourceMark rm(THREAD);
+      output()->print_cr("\"%s\" " PTR_FORMAT ": %zuK / %zuK / %zuK, %d frames",
+                         jt->name(), p2i(jt), cl.depth() / K, cl.high_water() / K,
+                         jt->stack_size() / K, cl.frames());
+      max_depth = MAX2(max_depth, cl.depth());
+      max_high_water = MAX2(max_high_water, cl.high_water());
+      threads++;
+      methods.maybe_grow();
+    }
+  }
+  output()->print_cr("%d threads, max depth %zuK, max high-water mark %zuK",
+                     threads, max_depth / K, max_high_water / K);
+
+  GrowableArrayCHeap<MethodStackUsageEntry, mtServiceability> entries(methods.number_of_entries());
+  methods.iterate_all([&](const char* name, const MethodStackUsage& usage) {
+    entries.append({name, usage});
+  });
+  entries.sort(compare_stack_usage);
+  if (top > 0 && entries.length() > 0) {
+    output()->cr();
+    output()->print_cr("Methods by cumulative frame bytes over all threads:");
+    output()->print_cr("%12s %10s  %s", "bytes", "frames", "method");
+    for (int i = 0; i < entries.length() && i < top; i++) {
+      const MethodStackUsageEntry& e = entries.at(i);
+      output()->print_cr("%12zu %10zu  %s", e._usage._bytes, e._usage._frames, e._name);
+    }
+  }
+  for (int i = 0; i < entries.length(); i++) {
+    os::free((void*)entries.at(i)._name);
+  }
+}
+
 // Enhanced JMX Agent support
 
 JMXStartRemoteDCmd::JMXStartRemoteDCmd(outputStream *output, bool heap_allocated) :
@@ -850,6 +1092,17 @@ void CodeCacheDCmd::execute(DCmdSource source, TRAPS) {
   CodeCache::print_layout(output());
 }
 
+DumpHotMethodsDCmd::DumpHotMethodsDCmd(outputStream* output, bool heap) :
+                                       DCmdWithParser(output, heap),
+  _filename("filename", "Name of the CompileCommand file", "FILE", true)
+{
+  _dcmdparser.add_dcmd_argument(&_filename);
+}
+
+void DumpHotMethodsDCmd::execute(DCmdSource source, TRAPS) {
+  CodeCache::write_hot_methods(_filename.value(), output());
+}
+
 #ifdef LINUX
 PerfMapDCmd::PerfMapDCmd(outputStream* output, bool heap) :
              DCmdWithParser(output, heap),
@@ -203,6 +203,22 @@ class VMInfoDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _reset;
+public:
+  static int num_arguments() { return 1; }
+  SafepointStatsDCmd(outputStream* output, bool heap);
+  static const char* name() { return "VM.safepoint_stats"; }
+  static const char* description() {
+    return "Print safepoint statistics and the time-to-safepoint profile.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemGCDCmd : public DCmd {
 public:
   SystemGCDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -303,6 +319,26 @@ class ClassHistogramDCmd : public DCmdWithParser {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+#if INCLUDE_EPSILONGC
+class EpsilonCheckpointDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<bool> _reset;
+public:
+  static int num_arguments() { return 1; }
+  EpsilonCheckpointDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "GC.epsilon_checkpoint";
+  }
+  static const char* description() {
+    return "Set an Epsilon heap checkpoint, or discard everything allocated since the last one.";
+  }
+  static const char* impact() {
+    return "High: Depends on Java heap size and content.";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+#endif // INCLUDE_EPSILONGC
+
 class ClassHierarchyDCmd : public DCmdWithParser {
 protected:
   DCmdArgument<bool> _print_interfaces; // true if inherited interfaces should be printed.
@@ -364,6 +400,41 @@ class ThreadDumpDCmd : public DCmdWithParser {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class ThreadLockStatsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _top;
+  DCmdArgument<bool> _reset;
+public:
+  static int num_arguments() { return 2; }
+  ThreadLockStatsDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Thread.lock_stats"; }
+  static const char* description() {
+    return "Print the classes whose monitors were contended the longest in total. "
+           "Requires -XX:+MonitorContentionStatistics.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
+class ThreadStackUsageDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<jlong> _top;
+public:
+  static int num_arguments() { return 1; }
+  ThreadStackUsageDCmd(outputStream* output, bool heap);
+  static const char* name() { return "Thread.stack_usage"; }
+  static const char* description() {
+    return "Print the stack depth and high-water mark of all Java threads, "
+           "and the methods using the most stack across all threads.";
+  }
+  static const char* impact() {
+    return "Medium: Depends on the number of threads and their stack depth.";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 // Enhanced JMX Agent support
 
 class JMXStartRemoteDCmd : public DCmdWithParser {
@@ -535,6 +606,24 @@ class CodeCacheDCmd : public DCmd {
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class DumpHotMethodsDCmd : public DCmdWithParser {
+protected:
+  DCmdArgument<char*> _filename;
+public:
+  static int num_arguments() { return 1; }
+  DumpHotMethodsDCmd(outputStream* output, bool heap);
+  static const char* name() {
+    return "Compiler.dump_profiles";
+  }
+  static const char* description() {
+    return "Write a CompileCommand file that lets a new JVM compile the currently hot methods after shorter profiling.";
+  }
+  static const char* impact() {
+    return "Medium";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 //---<  BEGIN  >--- CodeHeap State Analytics.
 class CodeHeapAnalyticsDCmd : public DCmdWithParser {
 protected:
@@ -632,6 +632,7 @@ class DumpWriter : public AbstractDumpWriter {
   const char* get_file_path() const            { return _writer->get_file_path(); }
   AbstractCompressor* compressor()             { return _compressor; }
   bool is_overwrite() const                    { return _writer->is_overwrite(); }
+  bool is_stream() const                       { return _writer->is_stream(); }
 
   void flush() override;
 
@@ -2476,9 +2477,15 @@ void VM_HeapDumper::work(uint worker_id) {
   // HPROF_HEAP_DUMP/HPROF_HEAP_DUMP_SEGMENT starts here
 
   ResourceMark rm;
-  // share global compressor, local DumpWriter is not responsible for its life cycle
-  DumpWriter segment_writer(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
-                            writer()->is_overwrite(), writer()->compressor());
+  // When streaming there is a single dumper, and it writes its segment
+  // straight to the global writer instead of to a segment file merged later.
+  DumpWriter* local_writer = nullptr;
+  if (!writer()->is_stream()) {
+    // share global compressor, local DumpWriter is not responsible for its life cycle
+    local_writer = new DumpWriter(DumpMerger::get_writer_path(writer()->get_file_path(), dumper_id),
+                                  writer()->is_overwrite(), writer()->compressor());
+  }
+  DumpWriter& segment_writer = local_writer != nullptr ? *local_writer : *writer();
   if (!segment_writer.has_error()) {
     if (is_vm_dumper(dumper_id)) {
       // dump some non-heap subrecords to heap dump segment
@@ -2535,6 +2542,8 @@ void VM_HeapDumper::work(uint worker_id) {
     // At this point, all fragments of the heapdump have been written to separate files.
     // We need to merge them into a complete heapdump and write HPROF_HEAP_DUMP_END at that time.
   }
+
+  delete local_writer;
 }
 
 void VM_HeapDumper::dump_stack_traces(AbstractDumpWriter* writer) {
@@ -2587,6 +2596,11 @@ void VM_HeapDumper::dump_vthread(oop vt, AbstractDumpWriter* segment_writer) {
   thread_dumper.init_serial_nums(&_thread_serial_num, &_frame_serial_num);
 
   // write HPROF_TRACE/HPROF_FRAME records to global writer
+  if (segment_writer == writer()) {
+    // Streaming: close the open heap dump segment so that the records
+    // below do not end up inside it.
+    writer()->finish_dump_segment();
+  }
   _dumper_controller->lock_global_writer();
   thread_dumper.dump_stack_traces(writer(), _klass_map);
   _dumper_controller->unlock_global_writer();
@@ -2643,6 +2657,13 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
     return -1;
   }
 
+  if (writer.is_stream() && num_dump_threads > 1) {
+    // Parallel dumpers write segment files next to the target and merge
+    // them afterwards; a stream is written serially without those files.
+    log_info(heapdump)("Dumping to a stream, using a single dump thread");
+    num_dump_threads = 1;
+  }
+
   // generate the segmented heap dump into separate files
   VM_HeapDumper dumper(&writer, _gc_before_heap_dump, _oome, num_dump_threads);
   VMThread::execute(&dumper);
@@ -2658,7 +2679,7 @@ int HeapDumper::dump(const char* path, outputStream* out, int compression, bool
   // Phase 2: Merge multiple heap files into one complete heap dump file.
   //          This is done by DumpMerger, which is performed outside safepoint
 
-  DumpMerger merger(path, &writer, dumper.dump_seq());
+  DumpMerger merger(path, &writer, writer.is_stream() ? 0 : dumper.dump_seq());
   // Perform heapdump file merge operation in the current thread prevents us
   // from occupying the VM Thread, which in turn affects the occurrence of
   // GC and other VM operations.
@@ -32,7 +32,17 @@
 char const* FileWriter::open_writer() {
   assert(_fd < 0, "Must not already be open");
 
-  _fd = os::create_binary_file(_path, _overwrite);
+#ifndef _WINDOWS
+  // An existing FIFO or character device is the receiving end of a stream,
+  // e.g. a pipe to a collector process; open it even without overwrite.
+  // Unix domain sockets cannot be opened, they would need a connect().
+  struct stat st;
+  if (os::stat(_path, &st) == 0) {
+    _is_stream = S_ISFIFO(st.st_mode) || S_ISCHR(st.st_mode);
+  }
+#endif
+
+  _fd = os::create_binary_file(_path, _overwrite || _is_stream);
 
   if (_fd < 0) {
     return os::strerror(errno);
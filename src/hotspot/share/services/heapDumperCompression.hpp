@@ -63,10 +63,11 @@ class FileWriter : public AbstractWriter {
 private:
   char const* _path;
   bool _overwrite;
+  bool _is_stream;
   int _fd;
 
 public:
-  FileWriter(char const* path, bool overwrite) : _path(path), _overwrite(overwrite), _fd(-1) { }
+  FileWriter(char const* path, bool overwrite) : _path(path), _overwrite(overwrite), _is_stream(false), _fd(-1) { }
 
   ~FileWriter();
 
@@ -80,6 +81,10 @@ class FileWriter : public AbstractWriter {
 
   bool is_overwrite() const { return _overwrite; }
 
+  // True if the path names a pipe or character device rather than a
+  // regular file. Such a target can only be written sequentially.
+  bool is_stream() const { return _is_stream; }
+
   int get_fd() const {return _fd; }
 };
 
@@ -26,6 +26,7 @@
 #include "classfile/vmSymbols.hpp"
 #include "memory/metaspace.hpp"
 #include "memory/metaspaceUtils.hpp"
+#include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
@@ -34,6 +35,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaCalls.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/perfData.hpp"
 #include "services/lowMemoryDetector.hpp"
 #include "services/management.hpp"
 #include "services/memoryManager.hpp"
@@ -63,7 +65,11 @@ MemoryPool::MemoryPool(const char* name,
   _usage_sensor(),
   _gc_usage_sensor(),
   _memory_pool_obj(),
-  _memory_pool_obj_initialized(false)
+  _memory_pool_obj_initialized(false),
+  _perf_used(nullptr),
+  _perf_committed(nullptr),
+  _perf_max_size(nullptr),
+  _perf_after_gc_used(nullptr)
 {}
 
 bool MemoryPool::is_pool(instanceHandle pool) const {
@@ -162,6 +168,59 @@ void MemoryPool::record_peak_memory_usage() {
   size_t peak_max_size = get_max_value(usage.max_size(), _peak_usage.max_size());
 
   _peak_usage = MemoryUsage(initial_size(), peak_used, peak_committed, peak_max_size);
+
+  update_perf_counters(usage);
+}
+
+void MemoryPool::set_last_collection_usage(MemoryUsage u) {
+  _after_gc_usage = u;
+  if (_perf_after_gc_used != nullptr) {
+    _perf_after_gc_used->set_value((jlong)u.used());
+  }
+}
+
+void MemoryPool::create_perf_counters(int ordinal) {
+  if (!UsePerfData) {
+    return;
+  }
+  EXCEPTION_MARK;
+  ResourceMark rm;
+
+  const char* ns = PerfDataManager::name_space("memoryPool", ordinal);
+
+  const char* cname = PerfDataManager::counter_name(ns, "name");
+  PerfDataManager::create_string_constant(SUN_RT, cname, _name, CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "type");
+  PerfDataManager::create_string_constant(SUN_RT, cname, is_heap() ? "heap" : "non-heap", CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "initSize");
+  PerfDataManager::create_constant(SUN_RT, cname, PerfData::U_Bytes,
+                                   (jlong)_initial_size, CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "used");
+  _perf_used = PerfDataManager::create_variable(SUN_RT, cname, PerfData::U_Bytes, CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "committed");
+  _perf_committed = PerfDataManager::create_variable(SUN_RT, cname, PerfData::U_Bytes, CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "maxSize");
+  _perf_max_size = PerfDataManager::create_variable(SUN_RT, cname, PerfData::U_Bytes,
+                                                    (jlong)_max_size, CHECK);
+
+  cname = PerfDataManager::counter_name(ns, "afterGC.used");
+  _perf_after_gc_used = PerfDataManager::create_variable(SUN_RT, cname, PerfData::U_Bytes, CHECK);
+}
+
+// Each counter is a single aligned jlong in the shared PerfMemory region,
+// so external readers always see whole values without any locking; the
+// fields are only mutually consistent as of the last sample.
+void MemoryPool::update_perf_counters(const MemoryUsage& usage) {
+  if (_perf_used != nullptr) {
+    _perf_used->set_value((jlong)usage.used());
+    _perf_committed->set_value((jlong)usage.committed());
+    _perf_max_size->set_value((jlong)usage.max_size());
+  }
 }
 
 static void set_sensor_obj_at(SensorInfo** sensor_ptr, instanceHandle sh) {
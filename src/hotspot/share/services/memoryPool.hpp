@@ -39,6 +39,7 @@
 
 // Forward declaration
 class MemoryManager;
+class PerfVariable;
 class SensorInfo;
 class ThresholdSupport;
 
@@ -55,8 +56,6 @@ class MemoryPool : public CHeapObj<mtInternal> {
     max_num_managers = 5
   };
 
-  // We could make some of the following as performance counters
-  // for external monitoring.
   const char*      _name;
   PoolType         _type;
   size_t           _initial_size;
@@ -76,7 +75,15 @@ class MemoryPool : public CHeapObj<mtInternal> {
   OopHandle _memory_pool_obj;
   volatile bool _memory_pool_obj_initialized;
 
+  // Performance counters mirroring the usage for external monitoring
+  // through hsperfdata; null unless UsePerfData.
+  PerfVariable*    _perf_used;
+  PerfVariable*    _perf_committed;
+  PerfVariable*    _perf_max_size;
+  PerfVariable*    _perf_after_gc_used;
+
   void add_manager(MemoryManager* mgr);
+  void update_perf_counters(const MemoryUsage& usage);
 
  public:
   MemoryPool(const char* name,
@@ -130,7 +137,10 @@ class MemoryPool : public CHeapObj<mtInternal> {
 
   void        set_usage_sensor_obj(instanceHandle s);
   void        set_gc_usage_sensor_obj(instanceHandle s);
-  void        set_last_collection_usage(MemoryUsage u)  { _after_gc_usage = u; }
+  void        set_last_collection_usage(MemoryUsage u);
+
+  // Creates the sun.rt.memoryPool.<ordinal>.* performance counters.
+  void        create_perf_counters(int ordinal);
 
   virtual instanceOop get_memory_pool_instance(TRAPS);
   virtual MemoryUsage get_memory_usage() = 0;
@@ -66,11 +66,18 @@ void GcThreadCountClosure::do_thread(Thread* thread) {
   _count++;
 }
 
+void MemoryService::add_memory_pool(MemoryPool* pool) {
+  _pools_list->append(pool);
+  pool->create_perf_counters(_pools_list->length() - 1);
+}
+
 void MemoryService::set_universe_heap(CollectedHeap* heap) {
   ResourceMark rm; // For internal allocations in GrowableArray.
 
   GrowableArray<MemoryPool*> gc_mem_pools = heap->memory_pools();
-  _pools_list->appendAll(&gc_mem_pools);
+  for (int i = 0; i < gc_mem_pools.length(); i++) {
+    add_memory_pool(gc_mem_pools.at(i));
+  }
 
   // set the GC thread count
   GcThreadCountClosure gctcc;
@@ -95,7 +102,7 @@ void MemoryService::add_code_heap_memory_pool(CodeHeap* heap, const char* name)
 
   // Append to lists
   _code_heap_pools->append(code_heap_pool);
-  _pools_list->append(code_heap_pool);
+  add_memory_pool(code_heap_pool);
 
   if (_code_cache_manager == nullptr) {
     // Create CodeCache memory manager
@@ -111,12 +118,12 @@ void MemoryService::add_metaspace_memory_pools() {
 
   _metaspace_pool = new MetaspacePool();
   mgr->add_pool(_metaspace_pool);
-  _pools_list->append(_metaspace_pool);
+  add_memory_pool(_metaspace_pool);
 
   if (UseCompressedClassPointers) {
     _compressed_class_pool = new CompressedKlassSpacePool();
     mgr->add_pool(_compressed_class_pool);
-    _pools_list->append(_compressed_class_pool);
+    add_memory_pool(_compressed_class_pool);
   }
 
   _managers_list->append(mgr);
@@ -59,6 +59,8 @@ class MemoryService : public AllStatic {
   static MemoryPool*                    _metaspace_pool;
   static MemoryPool*                    _compressed_class_pool;
 
+  static void add_memory_pool(MemoryPool* pool);
+
 public:
   static void set_universe_heap(CollectedHeap* heap);
   static void add_code_heap_memory_pool(CodeHeap* heap, const char* name);
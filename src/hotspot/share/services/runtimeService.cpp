@@ -35,6 +35,9 @@ PerfCounter*  RuntimeService::_sync_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_total_safepoints = nullptr;
 PerfCounter*  RuntimeService::_safepoint_time_ticks = nullptr;
 PerfCounter*  RuntimeService::_application_time_ticks = nullptr;
+PerfCounter*  RuntimeService::_interpreted_fast_returns = nullptr;
+PerfCounter*  RuntimeService::_c1_fast_returns = nullptr;
+PerfCounter*  RuntimeService::_c2_fast_returns = nullptr;
 
 void RuntimeService::init() {
   if (UsePerfData) {
@@ -56,6 +59,19 @@ void RuntimeService::init() {
               PerfDataManager::create_counter(SUN_RT, "applicationTime",
                                               PerfData::U_Ticks, CHECK);
 
+    if (CountFastReturns) {
+      _interpreted_fast_returns =
+              PerfDataManager::create_counter(SUN_RT, "fastReturns.interpreted",
+                                              PerfData::U_Events, CHECK);
+
+      _c1_fast_returns =
+              PerfDataManager::create_counter(SUN_RT, "fastReturns.c1",
+                                              PerfData::U_Events, CHECK);
+
+      _c2_fast_returns =
+              PerfDataManager::create_counter(SUN_RT, "fastReturns.c2",
+                                              PerfData::U_Events, CHECK);
+    }
 
     // create performance counters for jvm_version and its capabilities
     PerfDataManager::create_constant(SUN_RT, "jvmVersion", PerfData::U_None,
@@ -117,4 +133,20 @@ jlong RuntimeService::application_time_ms() {
     Management::ticks_to_ms(_application_time_ticks->get_value()) : -1;
 }
 
+static address fast_returns_addr(PerfCounter* counter) {
+  return counter != nullptr ? (address)counter->get_address() : nullptr;
+}
+
+address RuntimeService::interpreted_fast_returns_addr() {
+  return fast_returns_addr(_interpreted_fast_returns);
+}
+
+address RuntimeService::c1_fast_returns_addr() {
+  return fast_returns_addr(_c1_fast_returns);
+}
+
+address RuntimeService::c2_fast_returns_addr() {
+  return fast_returns_addr(_c2_fast_returns);
+}
+
 #endif // INCLUDE_MANAGEMENT
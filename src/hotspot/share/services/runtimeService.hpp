@@ -35,6 +35,11 @@ class RuntimeService : public AllStatic {
   static PerfCounter* _safepoint_time_ticks;   // Accumulated time at safepoints
   static PerfCounter* _application_time_ticks; // Accumulated time not at safepoints
 
+  // Frames of FastReturn methods popped by a return, per tier
+  static PerfCounter* _interpreted_fast_returns;
+  static PerfCounter* _c1_fast_returns;
+  static PerfCounter* _c2_fast_returns;
+
 public:
   static void init();
 
@@ -43,6 +48,12 @@ class RuntimeService : public AllStatic {
   static jlong safepoint_time_ms();
   static jlong application_time_ms();
 
+  // Addresses of the fastreturn counters that generated code increments
+  // under -XX:+CountFastReturns, or null if they are not maintained.
+  static address interpreted_fast_returns_addr() NOT_MANAGEMENT_RETURN_(nullptr);
+  static address c1_fast_returns_addr() NOT_MANAGEMENT_RETURN_(nullptr);
+  static address c2_fast_returns_addr() NOT_MANAGEMENT_RETURN_(nullptr);
+
   // callbacks
   static void record_safepoint_begin(jlong app_ticks) NOT_MANAGEMENT_RETURN;
   static void record_safepoint_synchronized(jlong sync_ticks) NOT_MANAGEMENT_RETURN;
@@ -82,14 +82,15 @@ class ConcurrentHashTable<CONFIG, MT>::BucketsOperation {
     }
   };
 
-  // Default size of _task_size_log2
+  // Default number of buckets claimed per task, as a power of two.
   static const size_t DEFAULT_TASK_SIZE_LOG2 = 12;
+  static const size_t DEFAULT_TASK_SIZE = (size_t)1 << DEFAULT_TASK_SIZE_LOG2;
 
   InternalTableClaimer _table_claimer;
   bool _is_mt;
 
   BucketsOperation(ConcurrentHashTable<CONFIG, MT>* cht, bool is_mt = false)
-    : _cht(cht), _table_claimer(DEFAULT_TASK_SIZE_LOG2, _cht->_table), _is_mt(is_mt) {}
+    : _cht(cht), _table_claimer(DEFAULT_TASK_SIZE, _cht->_table), _is_mt(is_mt) {}
 
   // Returns true if you succeeded to claim the range start -> (stop-1).
   bool claim(size_t* start, size_t* stop) {
@@ -99,7 +100,7 @@ class ConcurrentHashTable<CONFIG, MT>::BucketsOperation {
   // Calculate starting values.
   void setup(Thread* thread) {
     thread_owns_resize_lock(thread);
-    _table_claimer.set(DEFAULT_TASK_SIZE_LOG2, _cht->_table);
+    _table_claimer.set(DEFAULT_TASK_SIZE, _cht->_table);
   }
 
   // Returns false if all ranges are claimed.
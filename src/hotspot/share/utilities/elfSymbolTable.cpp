@@ -29,9 +29,13 @@
 #include "utilities/checkedCast.hpp"
 #include "utilities/elfFuncDescTable.hpp"
 #include "utilities/elfSymbolTable.hpp"
+#include "utilities/quickSort.hpp"
+#include "utilities/vmError.hpp"
 
 ElfSymbolTable::ElfSymbolTable(FILE* const file, Elf_Shdr& shdr) :
-  _next(nullptr), _fd(file), _section(file, shdr) {
+  _next(nullptr), _fd(file), _section(file, shdr),
+  _sorted_funcs(nullptr), _num_sorted_funcs(0), _max_func_size(0),
+  _sorted_funcs_attempted(false) {
   assert(file != nullptr, "null file handle");
   _status = _section.status();
 
@@ -44,6 +48,72 @@ ElfSymbolTable::~ElfSymbolTable() {
   if (_next != nullptr) {
     delete _next;
   }
+  if (_sorted_funcs != nullptr) {
+    FREE_C_HEAP_ARRAY(FuncSymbol, _sorted_funcs);
+  }
+}
+
+int ElfSymbolTable::compare_func_symbols(FuncSymbol a, FuncSymbol b) {
+  if (a._start != b._start) {
+    return a._start < b._start ? -1 : 1;
+  }
+  return a._index - b._index;
+}
+
+bool ElfSymbolTable::build_sorted_funcs(const Elf_Sym* symbols, int count) {
+  int num_funcs = 0;
+  for (int index = 0; index < count; index++) {
+    if (STT_FUNC == ELF_ST_TYPE(symbols[index].st_info) && symbols[index].st_size > 0) {
+      num_funcs++;
+    }
+  }
+  if (num_funcs == 0) {
+    return false;
+  }
+  FuncSymbol* funcs = NEW_C_HEAP_ARRAY_RETURN_NULL(FuncSymbol, num_funcs, mtInternal);
+  if (funcs == nullptr) {
+    return false;
+  }
+  int n = 0;
+  for (int index = 0; index < count; index++) {
+    const Elf_Sym* sym = &symbols[index];
+    if (STT_FUNC == ELF_ST_TYPE(sym->st_info) && sym->st_size > 0) {
+      funcs[n]._start = (address)sym->st_value;
+      funcs[n]._size = (size_t)sym->st_size;
+      funcs[n]._index = index;
+      _max_func_size = MAX2(_max_func_size, funcs[n]._size);
+      n++;
+    }
+  }
+  QuickSort::sort(funcs, n, compare_func_symbols);
+  _sorted_funcs = funcs;
+  _num_sorted_funcs = n;
+  return true;
+}
+
+// Gives the same answer as the linear scan: of all function symbols
+// containing addr, the one that comes first in the section.
+bool ElfSymbolTable::lookup_sorted(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset) {
+  // Find the first symbol starting above addr.
+  int lo = 0;
+  int hi = _num_sorted_funcs;
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (_sorted_funcs[mid]._start <= addr) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  // Only symbols starting within _max_func_size below addr can contain it.
+  int best = -1;
+  for (int i = lo - 1; i >= 0 && (size_t)(addr - _sorted_funcs[i]._start) < _max_func_size; i--) {
+    int index = _sorted_funcs[i]._index;
+    if ((best < 0 || index < best) && (size_t)(addr - _sorted_funcs[i]._start) < _sorted_funcs[i]._size) {
+      best = index;
+    }
+  }
+  return best >= 0 && compare(&symbols[best], addr, stringtableIndex, posIndex, offset, nullptr);
 }
 
 bool ElfSymbolTable::compare(const Elf_Sym* sym, address addr, int* stringtableIndex, int* posIndex, int* offset, ElfFuncDescTable* funcDescTable) {
@@ -81,6 +151,14 @@ bool ElfSymbolTable::lookup(address addr, int* stringtableIndex, int* posIndex,
   Elf_Sym* symbols = (Elf_Sym*)_section.section_data();
 
   if (symbols != nullptr) {
+    // Avoid allocating while reporting a fatal error.
+    if (!_sorted_funcs_attempted && funcDescTable == nullptr && !VMError::is_error_reported()) {
+      _sorted_funcs_attempted = true;
+      build_sorted_funcs(symbols, count);
+    }
+    if (_sorted_funcs != nullptr && funcDescTable == nullptr) {
+      return lookup_sorted(symbols, addr, stringtableIndex, posIndex, offset);
+    }
     for (int index = 0; index < count; index ++) {
       if (compare(&symbols[index], addr, stringtableIndex, posIndex, offset, funcDescTable)) {
         return true;
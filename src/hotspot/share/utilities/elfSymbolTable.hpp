@@ -50,6 +50,23 @@ class ElfSymbolTable: public CHeapObj<mtInternal> {
   ElfSection      _section;
 
   NullDecoder::decoder_status _status;
+
+  // Function symbols sorted by start address. Built on first lookup when
+  // the symbols are cached in memory, so decoding many addresses (e.g. for
+  // NMT detail reports) does not scan the whole section for each of them.
+  struct FuncSymbol {
+    address _start;
+    size_t  _size;
+    int     _index;  // index in the symbol section
+  };
+  FuncSymbol* _sorted_funcs;
+  int         _num_sorted_funcs;
+  size_t      _max_func_size;
+  bool        _sorted_funcs_attempted;
+
+  static int compare_func_symbols(FuncSymbol a, FuncSymbol b);
+  bool build_sorted_funcs(const Elf_Sym* symbols, int count);
+  bool lookup_sorted(const Elf_Sym* symbols, address addr, int* stringtableIndex, int* posIndex, int* offset);
 public:
   ElfSymbolTable(FILE* const file, Elf_Shdr& shdr);
   ~ElfSymbolTable();
@@ -31,12 +31,32 @@
 #include "utilities/spinYield.hpp"
 
 GlobalCounter::PaddedCounter GlobalCounter::_global_counter;
+GlobalCounter::PaddedCounter GlobalCounter::_completed_counter;
+
+// Counter values wrap, so compare them relative to each other.
+bool GlobalCounter::is_completed(uintx gbl_cnt) {
+  uintx completed = Atomic::load_acquire(&_completed_counter._counter);
+  return (completed - gbl_cnt) <= (max_uintx / 2);
+}
+
+void GlobalCounter::set_completed(uintx gbl_cnt) {
+  uintx completed = Atomic::load(&_completed_counter._counter);
+  while ((gbl_cnt - completed) - 1 < (max_uintx / 2)) {
+    uintx witness = Atomic::cmpxchg(&_completed_counter._counter, completed, gbl_cnt);
+    if (witness == completed) {
+      return;
+    }
+    completed = witness;
+  }
+}
 
 class GlobalCounter::CounterThreadCheck : public ThreadClosure {
  private:
   uintx _gbl_cnt;
+  bool _completed_by_other;
  public:
-  CounterThreadCheck(uintx gbl_cnt) : _gbl_cnt(gbl_cnt) {}
+  CounterThreadCheck(uintx gbl_cnt) : _gbl_cnt(gbl_cnt), _completed_by_other(false) {}
+  bool completed_by_other() const { return _completed_by_other; }
   void do_thread(Thread* thread) {
     SpinYield yield;
     // Loops on this thread until it has exited the critical read section.
@@ -48,6 +68,12 @@ class GlobalCounter::CounterThreadCheck : public ThreadClosure {
       // generation. If the counter is larger than the global counter version this
       //  is a new reader and we can continue.
       if (((cnt & COUNTER_ACTIVE) != 0) && (cnt - _gbl_cnt) > (max_uintx / 2)) {
+        // A writer that started after us may already have waited out
+        // this reader, and with it every reader we are waiting for.
+        if (is_completed(_gbl_cnt)) {
+          _completed_by_other = true;
+          break;
+        }
         yield.wait();
       } else {
         break;
@@ -61,12 +87,20 @@ void GlobalCounter::write_synchronize() {
   // Atomic::add must provide fence since we have storeload dependency.
   uintx gbl_cnt = Atomic::add(&_global_counter._counter, COUNTER_INCREMENT);
 
-  // Do all RCU threads.
+  // Do all RCU threads, unless a concurrent writer with a newer generation
+  // finishes first; its grace period covers all of our readers.
   CounterThreadCheck ctc(gbl_cnt);
   for (JavaThreadIteratorWithHandle jtiwh; JavaThread *thread = jtiwh.next(); ) {
     ctc.do_thread(thread);
+    if (ctc.completed_by_other()) {
+      return;
+    }
   }
   for (NonJavaThread::Iterator njti; !njti.end(); njti.step()) {
     ctc.do_thread(njti.current());
+    if (ctc.completed_by_other()) {
+      return;
+    }
   }
+  set_completed(gbl_cnt);
 }
@@ -54,6 +54,14 @@ class GlobalCounter : public AllStatic {
   // The global counter
   static PaddedCounter _global_counter;
 
+  // The newest global counter value whose grace period is known to have
+  // ended. Concurrent writers use it to skip scanning when a later
+  // write_synchronize has already waited out their readers.
+  static PaddedCounter _completed_counter;
+
+  static bool is_completed(uintx gbl_cnt);
+  static void set_completed(uintx gbl_cnt);
+
   // Bit 0 is active bit.
   static const uintx COUNTER_ACTIVE = 1;
   // Thus we increase counter by 2.
@@ -55,6 +55,13 @@ void* GrowableArrayCHeapAllocator::allocate(int max, int element_size, MemTag me
   return (void*)AllocateHeap(byte_size, mem_tag);
 }
 
+void* GrowableArrayCHeapAllocator::reallocate(void* elements, int max, int element_size, MemTag mem_tag) {
+  assert(max > 0, "integer overflow or shrink to nothing");
+  assert(mem_tag != mtNone, "memory tag not specified for C heap object");
+  size_t byte_size = element_size * (size_t) max;
+  return (void*)ReallocateHeap((char*)elements, byte_size, mem_tag);
+}
+
 void GrowableArrayCHeapAllocator::deallocate(void* elements) {
   FreeHeap(elements);
 }
@@ -32,6 +32,8 @@
 #include "utilities/ostream.hpp"
 #include "utilities/powerOfTwo.hpp"
 
+#include <type_traits>
+
 // A growable array.
 
 /*************************************************************************/
@@ -526,6 +528,15 @@ void GrowableArrayWithAllocator<E, Derived>::expand_to(int new_capacity) {
   assert(new_capacity > old_capacity,
          "expected growth but %d <= %d", new_capacity, old_capacity);
   this->_capacity = new_capacity;
+  // Elements that need no copy constructor or destructor can be moved by
+  // the C heap itself, which often grows the block in place instead of
+  // doing a malloc, copy and free.
+  if (std::is_trivially_copyable<E>::value && std::is_trivially_destructible<E>::value &&
+      this->_data != nullptr && static_cast<Derived*>(this)->can_reallocate()) {
+    this->_data = static_cast<Derived*>(this)->reallocate(this->_data);
+    for (int i = this->_len; i < this->_capacity; i++) ::new ((void*)&this->_data[i]) E();
+    return;
+  }
   E* newData = static_cast<Derived*>(this)->allocate();
   int i = 0;
   for (     ; i < this->_len; i++) ::new ((void*)&newData[i]) E(this->_data[i]);
@@ -599,6 +610,7 @@ class GrowableArrayArenaAllocator {
 class GrowableArrayCHeapAllocator {
 public:
   static void* allocate(int max, int element_size, MemTag mem_tag);
+  static void* reallocate(void* mem, int max, int element_size, MemTag mem_tag);
   static void deallocate(void* mem);
 };
 
@@ -750,6 +762,13 @@ class GrowableArray : public GrowableArrayWithAllocator<E, GrowableArray<E>> {
     return allocate(this->_capacity, _metadata.arena());
   }
 
+  bool can_reallocate() const { return on_C_heap(); }
+
+  E* reallocate(E* mem) {
+    assert(on_C_heap(), "Sanity");
+    return (E*)GrowableArrayCHeapAllocator::reallocate(mem, this->_capacity, sizeof(E), _metadata.mem_tag());
+  }
+
   void deallocate(E* mem) {
     if (on_C_heap()) {
       GrowableArrayCHeapAllocator::deallocate(mem);
@@ -832,6 +851,12 @@ class GrowableArrayCHeap : public GrowableArrayWithAllocator<E, GrowableArrayCHe
     return allocate(this->_capacity, MT);
   }
 
+  bool can_reallocate() const { return true; }
+
+  E* reallocate(E* mem) {
+    return (E*)GrowableArrayCHeapAllocator::reallocate(mem, this->_capacity, sizeof(E), MT);
+  }
+
   void deallocate(E* mem) {
     GrowableArrayCHeapAllocator::deallocate(mem);
   }
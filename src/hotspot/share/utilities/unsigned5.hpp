@@ -276,10 +276,11 @@ class UNSIGNED5 : AllStatic {
     // tries to skip count logical entries; returns actual number skipped
     int try_skip(int count) {
       int actual = 0;
-      while (actual < count && has_next()) {
+      while (actual < count) {
         int len = next_length();  // 0 or length in [1..5]
         if (len == 0)  break;
         _position += len;
+        actual++;
       }
       return actual;
     }
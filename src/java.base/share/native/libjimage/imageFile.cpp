@@ -532,6 +532,21 @@ void ImageFileReader::get_resource(u4 offset, u1* uncompressed_data) const {
         get_resource(location, uncompressed_data);
 }
 
+// Return the address of an uncompressed resource in the mapped image.
+const u1* ImageFileReader::get_resource_address(u4 offset) const {
+    if (!memory_map_image) {
+        return NULL;
+    }
+    // Get address of first byte of location attribute stream.
+    u1* data = get_location_offset_data(offset);
+    // Expand location attributes.
+    ImageLocation location(data);
+    if (location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED) != 0) {
+        return NULL;
+    }
+    return get_data_address() + location.get_attribute(ImageLocation::ATTRIBUTE_OFFSET);
+}
+
 // Return the resource for the supplied location.
 void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_data) const {
     // Retrieve the byte offset and size of the resource.
@@ -158,6 +158,26 @@ typedef jlong(*JImageGetResource_t)(JImageFile* jimage, JImageLocationRef locati
         char* buffer, jlong size);
 
 
+/*
+ * JImageGetResourceAddress - Given an open image file (see JImageOpen) and a
+ * resource's location information (see JImageFindResource), return the
+ * address of the resource's bytes if they can be read in place, that is if
+ * the image is memory mapped and the resource is stored uncompressed. The
+ * bytes stay valid until the image is closed and must not be modified.
+ * Returns NULL otherwise, in which case JImageGetResource must be used.
+ *
+ * Ex.
+ *  jlong size;
+ *  JImageLocationRef location = (*JImageFindResource)(image,
+ *                               "java.base", "9.0", "java/lang/String.class", &size);
+ *  const char* bytes = (*JImageGetResourceAddress)(image, location);
+ */
+extern "C" JNIEXPORT const char*
+JIMAGE_GetResourceAddress(JImageFile* jimage, JImageLocationRef location);
+
+typedef const char*(*JImageGetResourceAddress_t)(JImageFile* jimage, JImageLocationRef location);
+
+
 /*
  * JImageResourceIterator - Given an open image file (see JImageOpen), a visitor
  * function and a visitor argument, iterator through each of the image's resources.
@@ -33,6 +33,10 @@
 #include <unistd.h>
 #include <limits.h>
 
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
 #include "childproc.h"
 #include "jni_util.h"
 
@@ -82,6 +86,12 @@ isAsciiDigit(char c)
   #define FD_DIR "/proc/self/fd"
 #endif
 
+#if defined(__linux__) && defined(SYS_close_range)
+  #ifndef CLOSE_RANGE_CLOEXEC
+    #define CLOSE_RANGE_CLOEXEC (1U << 2)
+  #endif
+#endif
+
 static int
 markDescriptorsCloseOnExec(void)
 {
@@ -93,6 +103,13 @@ markDescriptorsCloseOnExec(void)
      * execve. */
     const int fd_from = STDERR_FILENO + 1;
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* Since Linux 5.11 a single close_range call marks the whole range.
+     * Older kernels fail with ENOSYS or EINVAL and we walk FD_DIR. */
+    if (syscall(SYS_close_range, fd_from, ~0U, CLOSE_RANGE_CLOEXEC) == 0)
+        return 0;
+#endif
+
 #if defined(_AIX)
     /* AIX does not understand '/proc/self' - it requires the real process ID */
     char aix_fd_dir[32];     /* the pid has at most 19 digits */
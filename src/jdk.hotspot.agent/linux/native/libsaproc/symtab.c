@@ -46,6 +46,11 @@ typedef struct symtab {
   size_t num_symbols;
   struct elf_symbol *symbols;
   struct hsearch_data *hash_table;
+  // named, non-empty symbols sorted by offset, built on the first
+  // nearest_symbol call
+  struct elf_symbol **by_offset;
+  size_t num_by_offset;
+  uintptr_t max_size;
 } symtab_t;
 
 
@@ -519,6 +524,7 @@ void destroy_symtab(struct symtab* symtab) {
   if (!symtab) return;
   if (symtab->strs) free(symtab->strs);
   if (symtab->symbols) free(symtab->symbols);
+  if (symtab->by_offset) free(symtab->by_offset);
   if (symtab->hash_table) {
      hdestroy_r(symtab->hash_table);
      free(symtab->hash_table);
@@ -550,10 +556,75 @@ uintptr_t search_symbol(struct symtab* symtab, uintptr_t base,
   return (uintptr_t) NULL;
 }
 
+// Order symbols by offset, and by position in the symbol table for
+// equal offsets so that lookups keep preferring the earlier symbol.
+static int sym_cmp_offset(const void *lhsp, const void *rhsp) {
+  const struct elf_symbol *lhs = *((const struct elf_symbol **)lhsp);
+  const struct elf_symbol *rhs = *((const struct elf_symbol **)rhsp);
+
+  if (lhs->offset != rhs->offset) {
+    return lhs->offset < rhs->offset ? -1 : 1;
+  }
+  return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+}
+
+static bool build_offset_index(struct symtab* symtab) {
+  size_t n, count = 0;
+  struct elf_symbol **array;
+
+  array = (struct elf_symbol **)malloc(sizeof(struct elf_symbol *) * (symtab->num_symbols + 1));
+  if (array == NULL) {
+    return false;
+  }
+  for (n = 0; n < symtab->num_symbols; n++) {
+    struct elf_symbol* sym = &(symtab->symbols[n]);
+    // symbols without a name or a size never match an address
+    if (sym->name != NULL && sym->size != 0) {
+      array[count++] = sym;
+      if (sym->size > symtab->max_size) {
+        symtab->max_size = sym->size;
+      }
+    }
+  }
+  qsort(array, count, sizeof(struct elf_symbol *), sym_cmp_offset);
+  symtab->by_offset = array;
+  symtab->num_by_offset = count;
+  return true;
+}
+
 const char* nearest_symbol(struct symtab* symtab, uintptr_t offset,
                            uintptr_t* poffset) {
   int n = 0;
   if (!symtab) return NULL;
+  if (symtab->by_offset != NULL || build_offset_index(symtab)) {
+    // Binary search for the first symbol starting above offset, then walk
+    // back over the symbols that could still cover it. Symbols may overlap,
+    // so pick the earliest one in the symbol table like the linear scan does.
+    struct elf_symbol* best = NULL;
+    size_t lo = 0, hi = symtab->num_by_offset;
+    while (lo < hi) {
+      size_t mid = lo + (hi - lo) / 2;
+      if (symtab->by_offset[mid]->offset <= offset) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    while (lo > 0) {
+      struct elf_symbol* sym = symtab->by_offset[--lo];
+      if (offset - sym->offset >= symtab->max_size) {
+        break;
+      }
+      if (offset < sym->offset + sym->size && (best == NULL || sym < best)) {
+        best = sym;
+      }
+    }
+    if (best != NULL) {
+      if (poffset) *poffset = (offset - best->offset);
+      return best->name;
+    }
+    return NULL;
+  }
   for (; n < symtab->num_symbols; n++) {
      struct elf_symbol* sym = &(symtab->symbols[n]);
      if (sym->name != NULL &&
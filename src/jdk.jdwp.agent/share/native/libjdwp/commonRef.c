@@ -61,10 +61,10 @@
 
 /* Initial hash table size (must be power of 2) */
 #define HASH_INIT_SIZE 512
-/* If element count exceeds HASH_EXPAND_SCALE*hash_size we expand & re-hash */
+/* If element count exceeds hash_size we expand by HASH_EXPAND_SCALE & re-hash */
 #define HASH_EXPAND_SCALE 8
 /* Maximum hash table size (must be power of 2) */
-#define HASH_MAX_SIZE  (1024*HASH_INIT_SIZE)
+#define HASH_MAX_SIZE  (8*1024*HASH_INIT_SIZE)
 
 /* Map a key (ID) to a hash bucket */
 static jint
@@ -322,6 +322,7 @@ findNodeByID(JNIEnv *env, jlong id)
             }
             break;
         }
+        prev = node;
         node = node->next;
     }
     return node;
@@ -364,16 +365,18 @@ newCommonRef(JNIEnv *env, jobject ref)
     }
 
     /* See if hash table needs expansion */
-    if ( gdata->objectsByIDcount > gdata->objectsByIDsize*HASH_EXPAND_SCALE &&
+    if ( gdata->objectsByIDcount > gdata->objectsByIDsize &&
          gdata->objectsByIDsize < HASH_MAX_SIZE ) {
         RefNode **old;
         int       oldsize;
+        int       oldcount;
         int       newsize;
         int       i;
 
         /* Save old information */
-        old     = gdata->objectsByID;
-        oldsize = gdata->objectsByIDsize;
+        old      = gdata->objectsByID;
+        oldsize  = gdata->objectsByIDsize;
+        oldcount = gdata->objectsByIDcount;
         /* Allocate new hash table */
         gdata->objectsByID = NULL;
         newsize = oldsize*HASH_EXPAND_SCALE;
@@ -392,6 +395,8 @@ newCommonRef(JNIEnv *env, jobject ref)
                 onode = next;
             }
         }
+        /* The RefNodes moved over, so their count did too */
+        gdata->objectsByIDcount = oldcount;
         jvmtiDeallocate(old);
     }
 
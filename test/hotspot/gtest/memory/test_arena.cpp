@@ -391,3 +391,70 @@ TEST_VM(Arena, string_duplicate)
   ASSERT_TRUE(0 == result);
   ASSERT_NE(copy, &testString[0]);
 }
+
+static Chunk* new_test_chunk(size_t length) {
+  void* p = os::malloc(Chunk::aligned_overhead_size() + length, mtChunk);
+  return ::new(p) Chunk(length);
+}
+
+TEST_VM(Arena, retained_chunks) {
+  const size_t len = 64 * K;
+  if (CompilerThreadChunkCacheSize < 4 * len) {
+    return;
+  }
+  RetainedChunks retained;
+  ASSERT_TRUE(retained.retain(new_test_chunk(len)));
+  ASSERT_TRUE(retained.retain(new_test_chunk(3 * len)));
+  ASSERT_EQ(retained.bytes(), 4 * len);
+
+  // Over budget
+  Chunk* big = new_test_chunk(CompilerThreadChunkCacheSize);
+  ASSERT_FALSE(retained.retain(big));
+  os::free(big);
+
+  // Too small, then too large for the request
+  ASSERT_NULL(retained.take(4 * len));
+  ASSERT_NULL(retained.take(len / 4));
+
+  Chunk* c = retained.take(2 * len);
+  ASSERT_NOT_NULL(c);
+  ASSERT_EQ(c->length(), 3 * len);
+  ASSERT_EQ(retained.bytes(), len);
+  os::free(c);
+
+  c = retained.take(len);
+  ASSERT_NOT_NULL(c);
+  ASSERT_EQ(c->length(), len);
+  ASSERT_EQ(retained.bytes(), (size_t)0);
+  os::free(c);
+
+  ASSERT_TRUE(retained.retain(new_test_chunk(len)));
+  retained.release();
+  ASSERT_EQ(retained.bytes(), (size_t)0);
+  ASSERT_NULL(retained.take(len));
+}
+
+TEST_VM(Arena, retained_pooled_chunks) {
+  RetainedChunks retained;
+  ASSERT_EQ(retained.pooled_count(0), 0);
+  ASSERT_NULL(retained.take_pooled(0));
+
+  Chunk* c1 = new_test_chunk(Chunk::tiny_size);
+  Chunk* c2 = new_test_chunk(Chunk::tiny_size);
+  retained.add_pooled(0, c1);
+  retained.add_pooled(0, c2);
+  retained.add_pooled(1, new_test_chunk(Chunk::tiny_size));
+  ASSERT_EQ(retained.pooled_count(0), 2);
+  ASSERT_EQ(retained.pooled_count(1), 1);
+
+  // Last in, first out
+  ASSERT_EQ(retained.take_pooled(0), c2);
+  ASSERT_EQ(retained.pooled_count(0), 1);
+  os::free(c2);
+
+  // Frees what is left in every pool
+  retained.release();
+  ASSERT_EQ(retained.pooled_count(0), 0);
+  ASSERT_EQ(retained.pooled_count(1), 0);
+  ASSERT_NULL(retained.take_pooled(1));
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "code/codeBlob.hpp"
+#include "memory/heap.hpp"
+#include "memory/memoryReserver.hpp"
+#include "runtime/mutexLocker.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+// Free blocks at the top of the heap are given back to the unallocated space,
+// so that later allocations go to the lowest free addresses.
+TEST_VM(CodeHeap, free_tail_is_released) {
+  const size_t size = 1 * M;
+  ReservedSpace rs = MemoryReserver::reserve(size, mtCode);
+  ASSERT_TRUE(rs.is_reserved());
+
+  CodeHeap heap("test", CodeBlobType::All);
+  MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+  ASSERT_TRUE(heap.reserve(rs, size, CodeCacheSegmentSize));
+
+  void* a = heap.allocate(1024);
+  void* b = heap.allocate(1024);
+  void* c = heap.allocate(1024);
+  ASSERT_TRUE(a != nullptr && b != nullptr && c != nullptr);
+  const int allocated = heap.allocated_segments();
+
+  // A hole in the middle stays on the freelist.
+  heap.deallocate(b);
+  EXPECT_EQ(1, heap.freelist_length());
+  EXPECT_EQ(allocated, heap.allocated_segments());
+
+  // Freeing the top block merges it with the hole, and both are released.
+  heap.deallocate(c);
+  EXPECT_EQ(0, heap.freelist_length());
+  EXPECT_EQ((size_t)0, heap.allocated_in_freelist());
+  EXPECT_LT(heap.allocated_segments(), allocated);
+
+  // The next allocation reuses the lowest free address.
+  void* d = heap.allocate(2048);
+  EXPECT_EQ(b, d);
+
+  heap.deallocate(d);
+  heap.deallocate(a);
+  EXPECT_EQ(0, heap.allocated_segments());
+  EXPECT_EQ(0, heap.freelist_length());
+
+  MemoryReserver::release(rs);
+}
@@ -25,11 +25,15 @@
 #include "memory/allocation.hpp"
 #include "nmt/mallocHeader.inline.hpp"
 #include "nmt/mallocTracker.hpp"
+#include "nmt/memBaseline.hpp"
+#include "nmt/memReporter.hpp"
 #include "nmt/memTracker.hpp"
 #include "runtime/os.hpp"
 #include "sanitizers/address.hpp"
 #include "testutils.hpp"
 #include "unittest.hpp"
+#include "utilities/autoRestore.hpp"
+#include "utilities/ostream.hpp"
 
 // Check NMT header for integrity, as well as expected type and size.
 static void check_expected_malloc_header(const void* payload, MemTag mem_tag, size_t size) {
@@ -159,3 +163,97 @@ TEST_VM(NMT, HeaderKeepsIntegrityAfterRevival) {
   hdr->revive();
   check_expected_malloc_header(p, mtTest, some_size);
 }
+
+// Check that the sampled flag survives in the header and its free info.
+TEST_VM(NMT, malloc_header_sampled_flag) {
+  alignas(16) char buf[sizeof(MallocHeader) + 16 + sizeof(uint16_t)];
+  MallocHeader* plain = ::new (buf) MallocHeader(16, mtTest, 0);
+  EXPECT_FALSE(plain->is_sampled());
+  EXPECT_FALSE(plain->free_info().sampled);
+
+  MallocHeader* sampled = ::new (buf) MallocHeader(16, mtTest, 42, true);
+  EXPECT_TRUE(sampled->is_sampled());
+  MallocHeader::FreeInfo fi = sampled->free_info();
+  EXPECT_TRUE(fi.sampled);
+  EXPECT_EQ(fi.mst_marker, 42u);
+  EXPECT_EQ(fi.size, (size_t)16);
+}
+
+class NMTSamplingTest : public testing::Test {
+protected:
+  static constexpr size_t interval = 4096;
+
+  static bool should_sample(size_t size) { return MallocTracker::should_sample(size); }
+  static size_t sample_weight(size_t size) { return MallocTracker::sample_weight(size); }
+};
+
+// Blocks much smaller than the interval are sampled about once per interval bytes.
+TEST_VM_F(NMTSamplingTest, sample_rate) {
+  AutoModifyRestore<size_t> amr(NativeMemorySampleInterval, interval);
+  const size_t size = 64;
+  const int allocations = 1000000;
+  int samples = 0;
+  for (int i = 0; i < allocations; i++) {
+    if (should_sample(size)) {
+      samples++;
+    }
+  }
+  const double expected = (double)allocations * size / interval;
+  EXPECT_NEAR(samples, expected, expected * 0.05);
+}
+
+TEST_VM_F(NMTSamplingTest, sample_weight_bounds) {
+  AutoModifyRestore<size_t> amr(NativeMemorySampleInterval, interval);
+  // A tiny block stands for about one interval of bytes ...
+  EXPECT_NEAR((double)sample_weight(1), (double)interval, 1.0);
+  // ... and a block far larger than the interval only for itself.
+  EXPECT_EQ(sample_weight(64 * interval), 64 * interval);
+  for (size_t size = 1; size <= 64 * interval; size *= 2) {
+    EXPECT_GE(sample_weight(size), size);
+  }
+}
+
+// The weights of the sampled blocks add up to about the bytes allocated.
+TEST_VM_F(NMTSamplingTest, sample_weights_estimate_allocated_bytes) {
+  AutoModifyRestore<size_t> amr(NativeMemorySampleInterval, interval);
+  const size_t sizes[] = { 16, 256, interval, 16 * interval };
+  double allocated = 0;
+  double estimated = 0;
+  for (int i = 0; i < 400000; i++) {
+    const size_t size = sizes[i % ARRAY_SIZE(sizes)];
+    allocated += size;
+    if (should_sample(size)) {
+      estimated += sample_weight(size);
+    }
+  }
+  EXPECT_NEAR(estimated, allocated, allocated * 0.01);
+}
+
+// Only does something with -XX:NativeMemoryTracking=summary -XX:NativeMemorySampleInterval=N.
+TEST_VM(NMT, summary_detail_report_has_sampled_sites) {
+  if (!MallocTracker::is_sampling() || NativeMemorySampleInterval > 1 * M) {
+    return;
+  }
+  // Blocks this large are sampled all but certainly.
+  const size_t size = 64 * NativeMemorySampleInterval;
+  const int blocks = 16;
+  void* p[blocks];
+  for (int i = 0; i < blocks; i++) {
+    p[i] = os::malloc(size, mtTest);
+    ASSERT_NOT_NULL(p[i]);
+    EXPECT_TRUE(MallocTracker::malloc_header(p[i])->is_sampled());
+  }
+
+  MemBaseline baseline;
+  baseline.baseline(false);
+  stringStream ss;
+  MemDetailReporter rpt(baseline, &ss, 1);
+  rpt.report();
+  const char* report = ss.base();
+  EXPECT_NE(strstr(report, "Malloc sites sampled"), nullptr) << report;
+  EXPECT_NE(strstr(report, "tag=Test"), nullptr) << report;
+
+  for (int i = 0; i < blocks; i++) {
+    os::free(p[i]);
+  }
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "runtime/frame.inline.hpp"
+#include "runtime/os.hpp"
+#include "runtime/thread.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+#if !defined(_WIN32) && !defined(ZERO) && !defined(__thumb__)
+
+// Walks the native frames below a recursion of known depth, the way
+// frame::next_frame is used to print stacks of deep recursions in error
+// reports. The walk must see every level.
+
+static const int recursion_depth = 2000;
+
+static int count_frames() {
+  // Bound the walk in case the frames below the test are not walkable.
+  const int max_frames = recursion_depth + 1000;
+  int frames = 0;
+  frame fr = os::current_frame();
+  while (fr.pc() != nullptr && frames < max_frames) {
+    frames++;
+    fr = frame::next_frame(fr, Thread::current());
+  }
+  return frames;
+}
+
+static NOINLINE int recurse_and_walk(int depth) {
+  if (depth == 0) {
+    return count_frames();
+  }
+  // Reading the volatile after the call keeps the compiler from turning
+  // the recursion into a tail call, so that every level has a frame.
+  volatile int level = depth;
+  int frames = recurse_and_walk(depth - 1);
+  return frames + (level - depth);
+}
+
+TEST_VM(frame, next_frame_deep_native_recursion) {
+  int frames = recurse_and_walk(recursion_depth);
+  EXPECT_GE(frames, recursion_depth);
+}
+
+#endif // !_WIN32 && !ZERO && !__thumb__
@@ -196,6 +196,43 @@ TEST_VM_F(LockStackTest, try_recursive_enter) {
   EXPECT_TRUE(ls.is_empty());
 }
 
+TEST_VM_F(LockStackTest, is_top) {
+  if (LockingMode != LM_LIGHTWEIGHT) {
+    return;
+  }
+
+  JavaThread* THREAD = JavaThread::current();
+  // the thread should be in vm to use locks
+  ThreadInVMfromNative ThreadInVMfromNative(THREAD);
+
+  LockStack& ls = THREAD->lock_stack();
+
+  EXPECT_TRUE(ls.is_empty());
+
+  oop obj0 = Universe::int_mirror();
+  oop obj1 = Universe::float_mirror();
+
+  EXPECT_FALSE(ls.is_top(obj0));
+
+  ls.push(obj0);
+
+  // 0
+  EXPECT_TRUE(ls.is_top(obj0));
+  EXPECT_FALSE(ls.is_top(obj1));
+
+  push_raw(ls, obj1);
+
+  // 0, 1
+  EXPECT_FALSE(ls.is_top(obj0));
+  EXPECT_TRUE(ls.is_top(obj1));
+
+  // Clear stack
+  pop_raw(ls);
+  pop_raw(ls);
+
+  EXPECT_TRUE(ls.is_empty());
+}
+
 TEST_VM_F(LockStackTest, contains) {
   if (LockingMode != LM_LIGHTWEIGHT) {
     return;
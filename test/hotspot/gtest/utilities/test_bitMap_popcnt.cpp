@@ -166,5 +166,13 @@ TEST_VM(BitMap, popcnt_large) {
   ASSERT_POPCNT_RANGE(bm, 0, 64 * K, 64 * K);
   ASSERT_POPCNT_RANGE(bm, 47, 199, 152);
   ASSERT_POPCNT_RANGE(bm, 199, 299, 100);
+  // Many full words, not a multiple of the internal batch size.
+  ASSERT_POPCNT_RANGE(bm, 64, 64 * K - 64, 64 * K - 128);
+
+  bm.clear();
+  for (BitMap::idx_t i = 0; i < 64 * K; i += 3) {
+    bm.set_bit(i);
+  }
+  ASSERT_POPCNT_ALL(bm, (64 * K + 2) / 3);
 
 }
@@ -689,3 +689,21 @@ TEST(GrowableArrayCHeap, returning_references_works_as_expected) {
   EXPECT_EQ(5, first);
   EXPECT_EQ(5, last);
 }
+
+TEST(GrowableArrayCHeap, grow_keeps_trivial_elements) {
+  GrowableArrayCHeap<int, mtTest> arr(1);
+  for (int i = 0; i < 1000; i++) {
+    arr.append(i);
+  }
+  ASSERT_EQ(1000, arr.length());
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(i, arr.at(i));
+  }
+
+  GrowableArray<int> carr(1, mtTest);
+  carr.append(7);
+  carr.reserve(64);
+  EXPECT_EQ(64, carr.capacity());
+  EXPECT_EQ(7, carr.at(0));
+  EXPECT_EQ(0, carr.at_grow(63));
+}
@@ -221,6 +221,12 @@ TEST_VM(unsigned5, reader) {
     ASSERT_EQ(x, y) << i;
   }
   ASSERT_TRUE(i < LEN);
+  // skip over some values without decoding them
+  MyReader r4(buf);
+  ASSERT_EQ(r4.try_skip(10), 10);
+  ASSERT_EQ((int)r4.next_uint(), ints[10]);
+  ASSERT_EQ(r4.try_skip(LEN), LEN - 11);
+  ASSERT_FALSE(r4.has_next());
   // copy from reader to writer
   UNSIGNED5::Reader<char*,int> r3(buf);
   int array_limit = 1;
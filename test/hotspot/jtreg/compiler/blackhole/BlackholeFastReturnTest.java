@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary An empty method whose return was rewritten to _fast_return is
+ *          still an empty method, here as seen by the blackhole command
+ * @requires vm.compMode != "Xint"
+ * @library /test/lib /
+ * @run driver compiler.blackhole.BlackholeFastReturnTest
+ */
+
+package compiler.blackhole;
+
+import java.lang.classfile.AttributeMapper;
+import java.lang.classfile.AttributedElement;
+import java.lang.classfile.BufWriter;
+import java.lang.classfile.ClassFile;
+import java.lang.classfile.ClassReader;
+import java.lang.classfile.CodeBuilder;
+import java.lang.classfile.CustomAttribute;
+import java.lang.classfile.Label;
+import java.lang.constant.ClassDesc;
+import java.lang.constant.MethodTypeDesc;
+
+import static java.lang.constant.ConstantDescs.CD_int;
+import static java.lang.constant.ConstantDescs.CD_void;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class BlackholeFastReturnTest {
+    static final String TARGET = "compiler.blackhole.FastReturnTarget";
+    static final ClassDesc TARGET_DESC = ClassDesc.of(TARGET);
+    static final MethodTypeDesc VOID = MethodTypeDesc.of(CD_void);
+    static final String WARNING = "Blackhole compile option only works for empty methods";
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            run();
+            return;
+        }
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-Xbatch",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+RewriteFastReturns",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=blackhole," + TARGET + "::empty",
+            "-XX:CompileCommand=blackhole," + TARGET + "::notEmpty",
+            "-XX:+PrintCompilation",
+            BlackholeFastReturnTest.class.getName(), "run");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("FastReturnTarget::loop");
+        // The check did run, and only rejected the method that does something
+        output.shouldContain(WARNING + ": " + TARGET + ".notEmpty");
+        output.shouldNotContain(WARNING + ": " + TARGET + ".empty");
+    }
+
+    // Both methods carry a FastReturn attribute, so the Rewriter turns their
+    // returns into _fast_return.
+    static byte[] targetClass() {
+        return ClassFile.of().build(TARGET_DESC, cb -> cb
+            .withFlags(ClassFile.ACC_PUBLIC)
+            .withMethod("empty", VOID, ClassFile.ACC_PUBLIC | ClassFile.ACC_STATIC, mb -> mb
+                .with(new FastReturnAttribute())
+                .withCode(CodeBuilder::return_))
+            .withMethod("notEmpty", VOID, ClassFile.ACC_PUBLIC | ClassFile.ACC_STATIC, mb -> mb
+                .with(new FastReturnAttribute())
+                .withCode(code -> code.iconst_0().pop().return_()))
+            .withMethod("loop", MethodTypeDesc.of(CD_void, CD_int), ClassFile.ACC_PUBLIC | ClassFile.ACC_STATIC, mb -> mb
+                .withCode(code -> {
+                    Label top = code.newLabel();
+                    Label end = code.newLabel();
+                    code.labelBinding(top)
+                        .iload(0)
+                        .ifle(end)
+                        .invokestatic(TARGET_DESC, "empty", VOID)
+                        .invokestatic(TARGET_DESC, "notEmpty", VOID)
+                        .iinc(0, -1)
+                        .goto_(top)
+                        .labelBinding(end)
+                        .return_();
+                })));
+    }
+
+    static void run() throws Exception {
+        byte[] bytes = targetClass();
+        ClassLoader loader = new ClassLoader(BlackholeFastReturnTest.class.getClassLoader()) {
+            @Override
+            protected Class<?> findClass(String name) throws ClassNotFoundException {
+                if (!name.equals(TARGET)) {
+                    throw new ClassNotFoundException(name);
+                }
+                return defineClass(name, bytes, 0, bytes.length);
+            }
+        };
+        java.lang.reflect.Method loop = loader.loadClass(TARGET).getMethod("loop", int.class);
+        for (int i = 0; i < 100; i++) {
+            loop.invoke(null, 10_000);
+        }
+    }
+
+    static final class FastReturnAttribute extends CustomAttribute<FastReturnAttribute> {
+        static final AttributeMapper<FastReturnAttribute> MAPPER = new AttributeMapper<>() {
+            @Override
+            public String name() {
+                return "FastReturn";
+            }
+
+            @Override
+            public FastReturnAttribute readAttribute(AttributedElement enclosing, ClassReader cf, int pos) {
+                return new FastReturnAttribute();
+            }
+
+            @Override
+            public void writeAttribute(BufWriter buf, FastReturnAttribute attr) {
+                buf.writeIndex(buf.constantPool().utf8Entry(name()));
+                buf.writeInt(0);
+            }
+
+            @Override
+            public AttributeMapper.AttributeStability stability() {
+                return AttributeMapper.AttributeStability.STATELESS;
+            }
+        };
+
+        FastReturnAttribute() {
+            super(MAPPER);
+        }
+    }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary The fast mode of the C1 linear scan allocator keeps values that
+ *          are split at block boundaries intact
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:C1FastLinearScanThreshold=1
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestFastLinearScan::test
+ *                   compiler.c1.TestFastLinearScan
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=3
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:C1FastLinearScanThreshold=1
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestFastLinearScan::test
+ *                   compiler.c1.TestFastLinearScan
+ */
+
+package compiler.c1;
+
+public class TestFastLinearScan {
+    static volatile int sink;
+
+    // More values are live across the loop and the calls than there are
+    // registers, so most of them are split and reloaded in other blocks.
+    static long test(int n, long seed) {
+        long a = seed + 1, b = seed * 3, c = seed ^ 5, d = seed - 7;
+        long e = a * b, f = c + d, g = e ^ f, h = a - d;
+        double x = seed * 0.5, y = seed * 1.5, z = seed * 2.5;
+        for (int i = 0; i < n; i++) {
+            if ((i & 1) == 0) {
+                a += b; c ^= d; e -= f; g += h;
+                x += y;
+            } else {
+                b += c; d ^= e; f -= g; h += a;
+                y += z;
+            }
+            sink = i;
+            z -= x * 0.25;
+        }
+        return a + b + c + d + e + f + g + h + (long)x + (long)y + (long)z;
+    }
+
+    static long reference(int n, long seed) {
+        long a = seed + 1, b = seed * 3, c = seed ^ 5, d = seed - 7;
+        long e = a * b, f = c + d, g = e ^ f, h = a - d;
+        double x = seed * 0.5, y = seed * 1.5, z = seed * 2.5;
+        for (int i = 0; i < n; i++) {
+            if ((i & 1) == 0) {
+                a += b; c ^= d; e -= f; g += h;
+                x += y;
+            } else {
+                b += c; d ^= e; f -= g; h += a;
+                y += z;
+            }
+            z -= x * 0.25;
+        }
+        return a + b + c + d + e + f + g + h + (long)x + (long)y + (long)z;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 20_000; i++) {
+            int n = i % 37;
+            long expected = reference(n, i);
+            long result = test(n, i);
+            if (result != expected) {
+                throw new RuntimeException("Wrong result for n=" + n + ": " + result + " != " + expected);
+            }
+        }
+    }
+}
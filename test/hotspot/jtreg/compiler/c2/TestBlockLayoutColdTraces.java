@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Code whose rarely taken paths are laid out after all other
+ *          traces still computes the right results
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+BlockLayoutSplitColdTraces
+ *                   compiler.c2.TestBlockLayoutColdTraces
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:-BlockLayoutSplitColdTraces
+ *                   compiler.c2.TestBlockLayoutColdTraces
+ */
+
+package compiler.c2;
+
+public class TestBlockLayoutColdTraces {
+    static class Node {
+        final int value;
+        final Node left;
+        final Node right;
+
+        Node(int value, Node left, Node right) {
+            this.value = value;
+            this.left = left;
+            this.right = right;
+        }
+    }
+
+    static Node build(int depth, int value) {
+        if (depth == 0) {
+            return value % 1000 == 999 ? null : new Node(value, null, null);
+        }
+        return new Node(value, build(depth - 1, 2 * value), build(depth - 1, 2 * value + 1));
+    }
+
+    // The null leaf, the negative value and the overflow are each taken only
+    // a handful of times, so their blocks end up in cold traces.
+    static long sum(Node n) {
+        if (n == null) {
+            return -1;
+        }
+        long result = n.value;
+        if (n.value < 0) {
+            throw new IllegalStateException("negative value " + n.value);
+        }
+        if (n.left != null) {
+            result += sum(n.left);
+        }
+        if (n.right != null) {
+            result += sum(n.right);
+        }
+        try {
+            return Math.addExact(result, 0L);
+        } catch (ArithmeticException e) {
+            return Long.MAX_VALUE;
+        }
+    }
+
+    static long expected(int depth, int value) {
+        if (depth == 0) {
+            return value % 1000 == 999 ? 0 : value;
+        }
+        return value + expected(depth - 1, 2 * value) + expected(depth - 1, 2 * value + 1);
+    }
+
+    public static void main(String[] args) {
+        Node tree = build(10, 1);
+        long expected = expected(10, 1);
+        for (int i = 0; i < 20_000; i++) {
+            long result = sum(tree);
+            if (result != expected) {
+                throw new RuntimeException("Wrong sum " + result + " != " + expected);
+            }
+        }
+        try {
+            sum(new Node(-1, null, null));
+            throw new RuntimeException("No exception for negative value");
+        } catch (IllegalStateException e) {
+            // expected
+        }
+    }
+}
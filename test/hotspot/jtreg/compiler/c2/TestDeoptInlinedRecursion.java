@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Deoptimizing a deep stack of C2 frames with inlined recursion
+ *          rebuilds every interpreter frame with the right state
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xss16m -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:MaxRecursiveInlineLevel=8
+ *                   compiler.c2.TestDeoptInlinedRecursion
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xss16m -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:MaxRecursiveInlineLevel=8 -XX:-ProfileInterpreter
+ *                   compiler.c2.TestDeoptInlinedRecursion
+ */
+
+package compiler.c2;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestDeoptInlinedRecursion {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    static final int DEPTH = 5000;
+    static final int ROUNDS = 20;
+
+    static volatile boolean deoptimize = false;
+
+    // Keeps a different value in a local and on the expression stack of
+    // every level, so a frame rebuilt from the wrong scope gives a wrong sum.
+    static long recurse(int n, long acc) {
+        long local = acc * 31 + n;
+        if (n == 0) {
+            if (deoptimize) {
+                WB.deoptimizeFrames(false /* makeNotEntrant */);
+            }
+            return local;
+        }
+        return n + recurse(n - 1, local) - (local & 7);
+    }
+
+    static long expected(int n, long acc) {
+        long[] locals = new long[n + 1];
+        for (int i = n; i >= 0; i--) {
+            locals[i] = acc * 31 + i;
+            acc = locals[i];
+        }
+        long result = locals[0];
+        for (int i = 1; i <= n; i++) {
+            result = i + result - (locals[i] & 7);
+        }
+        return result;
+    }
+
+    public static void main(String[] args) {
+        long expected = expected(DEPTH, 1);
+
+        // Get recurse() compiled with the recursion inlined.
+        for (int i = 0; i < 200; i++) {
+            if (recurse(DEPTH, 1) != expected) {
+                throw new RuntimeException("Wrong result during warmup");
+            }
+        }
+
+        deoptimize = true;
+        for (int i = 0; i < ROUNDS; i++) {
+            long result = recurse(DEPTH, 1);
+            if (result != expected) {
+                throw new RuntimeException("Wrong result after deoptimization: " + result + " != " + expected);
+            }
+        }
+    }
+}
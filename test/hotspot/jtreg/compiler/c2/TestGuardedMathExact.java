@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Math.*Exact checks guarded by range tests on their inputs fold
+ *          only when the guards rule out an overflow
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   compiler.c2.TestGuardedMathExact
+ */
+
+package compiler.c2;
+
+public class TestGuardedMathExact {
+    // Both inputs are below 2^30, so the sum can't overflow.
+    static int addGuarded(int a, int b) {
+        if (a >= 0 && a < (1 << 30) && b >= 0 && b < (1 << 30)) {
+            return Math.addExact(a, b);
+        }
+        return -1;
+    }
+
+    // The guards stop one short of the range that can't overflow.
+    static int addEdge(int a, int b) {
+        if (a >= 0 && a <= (1 << 30) && b >= 0 && b < (1 << 30)) {
+            try {
+                return Math.addExact(a, b);
+            } catch (ArithmeticException e) {
+                return -2;
+            }
+        }
+        return -1;
+    }
+
+    static int subGuarded(int a, int b) {
+        if (a > -1000 && a < 1000 && b > -1000 && b < 1000) {
+            return Math.subtractExact(a, b);
+        }
+        return -1;
+    }
+
+    static int mulGuarded(int a, int b) {
+        if (a > -46340 && a < 46340 && b > -46340 && b < 46340) {
+            return Math.multiplyExact(a, b);
+        }
+        return -1;
+    }
+
+    static long mulLongGuarded(long a, long b) {
+        if (a >= 0 && a <= 0xFFFF_FFFFL && b >= 0 && b < 0x7FFF_FFFFL) {
+            return Math.multiplyExact(a, b);
+        }
+        return -1;
+    }
+
+    static long mulLongEdge(long a, long b) {
+        if (a >= 0 && a <= 0xFFFF_FFFFL && b >= 0 && b <= 0x8000_0001L) {
+            try {
+                return Math.multiplyExact(a, b);
+            } catch (ArithmeticException e) {
+                return -2;
+            }
+        }
+        return -1;
+    }
+
+    static void check(long actual, long expected, String what) {
+        if (actual != expected) {
+            throw new RuntimeException(what + ": " + actual + " != " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 20_000; i++) {
+            int a = i * 37;
+            int b = i * 11;
+            check(addGuarded(a, b), a + b, "addGuarded");
+            check(addEdge(a, b), a + b, "addEdge");
+            check(subGuarded(i % 999, -(i % 998)), i % 999 + i % 998, "subGuarded");
+            check(mulGuarded(i % 46339, -(i % 46338)), -(i % 46339) * (i % 46338), "mulGuarded");
+            check(mulLongGuarded(a, b), (long) a * b, "mulLongGuarded");
+            check(mulLongEdge(a, b), (long) a * b, "mulLongEdge");
+        }
+        int max = (1 << 30) - 1;
+        check(addGuarded(max, max), 2 * max, "addGuarded at the bounds");
+        check(addEdge(1 << 30, max), -2, "addEdge overflow");
+        check(subGuarded(999, -999), 1998, "subGuarded at the bounds");
+        check(mulGuarded(46339, -46339), -46339 * 46339, "mulGuarded at the bounds");
+        check(mulLongGuarded(0xFFFF_FFFFL, 0x7FFF_FFFEL), 0xFFFF_FFFFL * 0x7FFF_FFFEL, "mulLongGuarded at the bounds");
+        check(mulLongEdge(0xFFFF_FFFFL, 0x8000_0001L), -2, "mulLongEdge overflow");
+    }
+}
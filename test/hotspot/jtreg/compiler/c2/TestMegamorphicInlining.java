@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Megamorphic call sites that inline their most frequent receivers
+ *          still dispatch every receiver to the right method
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseMegamorphicInlining
+ *                   -XX:TypeProfileWidth=4
+ *                   compiler.c2.TestMegamorphicInlining
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseMegamorphicInlining
+ *                   -XX:TypeProfileWidth=8 -XX:MegamorphicInliningWidth=2
+ *                   compiler.c2.TestMegamorphicInlining
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseMegamorphicInlining
+ *                   -XX:-IncrementalInlineVirtual
+ *                   compiler.c2.TestMegamorphicInlining
+ */
+
+package compiler.c2;
+
+public class TestMegamorphicInlining {
+    interface Visitor {
+        int visit(Tree t);
+    }
+
+    static abstract class Tree {
+        abstract int accept(Visitor v);
+    }
+
+    static class Leaf extends Tree {
+        final int value;
+        Leaf(int value) { this.value = value; }
+        int accept(Visitor v) { return v.visit(this) + value; }
+    }
+
+    static class Neg extends Tree {
+        int accept(Visitor v) { return -v.visit(this); }
+    }
+
+    static class Twice extends Tree {
+        int accept(Visitor v) { return 2 * v.visit(this); }
+    }
+
+    static class Plus1 extends Tree {
+        int accept(Visitor v) { return v.visit(this) + 1; }
+    }
+
+    static class Minus1 extends Tree {
+        int accept(Visitor v) { return v.visit(this) - 1; }
+    }
+
+    static class Xor extends Tree {
+        int accept(Visitor v) { return v.visit(this) ^ 0x55; }
+    }
+
+    // Rare receiver, only seen after warmup.
+    static class Late extends Tree {
+        int accept(Visitor v) { return v.visit(this) * 7; }
+    }
+
+    static final Visitor ONE = t -> 1;
+
+    static int dispatch(Tree t) {
+        return t.accept(ONE);
+    }
+
+    static int expected(Tree t) {
+        if (t instanceof Leaf l)   return 1 + l.value;
+        if (t instanceof Neg)      return -1;
+        if (t instanceof Twice)    return 2;
+        if (t instanceof Plus1)    return 2;
+        if (t instanceof Minus1)   return 0;
+        if (t instanceof Xor)      return 1 ^ 0x55;
+        if (t instanceof Late)     return 7;
+        throw new RuntimeException("Unknown tree " + t);
+    }
+
+    public static void main(String[] args) {
+        // Skewed distribution: four frequent receivers, two rare ones.
+        Tree[] trees = new Tree[100];
+        for (int i = 0; i < trees.length; i++) {
+            int r = i % 100;
+            trees[i] = r < 40 ? new Leaf(i) :
+                       r < 65 ? new Neg() :
+                       r < 85 ? new Twice() :
+                       r < 95 ? new Plus1() :
+                       r < 98 ? new Minus1() :
+                                new Xor();
+        }
+        for (int iter = 0; iter < 2_000; iter++) {
+            for (Tree t : trees) {
+                int result = dispatch(t);
+                if (result != expected(t)) {
+                    throw new RuntimeException("Wrong result " + result + " for " + t);
+                }
+            }
+        }
+        Tree late = new Late();
+        for (int iter = 0; iter < 1_000; iter++) {
+            if (dispatch(late) != 7) {
+                throw new RuntimeException("Wrong result for late receiver");
+            }
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Arguments passed to a self-recursive call in a different
+ *          position escape if the method lets that position escape
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:-TieredCompilation -XX:-BackgroundCompilation
+ *                   -XX:CompileCommand=dontinline,compiler.c2.TestSelfRecursiveEscape::swap
+ *                   compiler.c2.TestSelfRecursiveEscape
+ */
+
+package compiler.c2;
+
+public class TestSelfRecursiveEscape {
+    static class Box {
+        int value;
+        Box(int value) { this.value = value; }
+    }
+
+    static Box escaped;
+
+    // Only the first argument escapes directly, but the second one is
+    // passed as the first one of the recursive call.
+    static int swap(Box a, Box b, int n) {
+        if (n == 0) {
+            escaped = a;
+            return a.value;
+        }
+        return swap(b, a, n - 1);
+    }
+
+    static int test(int n) {
+        Box a = new Box(1);
+        Box b = new Box(2);
+        int result;
+        synchronized (b) {
+            result = swap(a, b, n);
+        }
+        b.value = 3;
+        return result;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 20_000; i++) {
+            int n = i & 3;
+            int result = test(n);
+            int expected = (n & 1) == 0 ? 1 : 2;
+            if (result != expected) {
+                throw new RuntimeException("Wrong result " + result + " for n = " + n);
+            }
+            int value = escaped.value;
+            int expectedValue = (n & 1) == 0 ? 1 : 3;
+            if (value != expectedValue) {
+                throw new RuntimeException("Escaped box has value " + value + " for n = " + n);
+            }
+        }
+    }
+}
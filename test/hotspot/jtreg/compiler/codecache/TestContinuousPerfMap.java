@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary WritePerfMapContinuously appends new nmethods and stubs to the
+ *          perf map while the VM is running
+ * @requires os.family == "linux" & vm.compiler1.enabled
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+WritePerfMapContinuously -XX:-BackgroundCompilation
+ *                   compiler.codecache.TestContinuousPerfMap
+ */
+
+package compiler.codecache;
+
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+import java.util.regex.Pattern;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestContinuousPerfMap {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+    static final Pattern ENTRY = Pattern.compile("0x[0-9a-f]+ 0x[0-9a-f]+ \\S.*");
+
+    static int compiled(int x) {
+        return x * 17 + 3;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path map = Path.of("/tmp/perf-" + ProcessHandle.current().pid() + ".map");
+        try {
+            Method m = TestContinuousPerfMap.class.getDeclaredMethod("compiled", int.class);
+            if (!WB.enqueueMethodForCompilation(m, 1)) {
+                throw new RuntimeException("Could not compile " + m);
+            }
+
+            List<String> lines = Files.readAllLines(map);
+            for (String line : lines) {
+                if (!ENTRY.matcher(line).matches()) {
+                    throw new RuntimeException("Malformed perf map entry: " + line);
+                }
+            }
+            String name = TestContinuousPerfMap.class.getName() + ".compiled(int)";
+            if (lines.stream().noneMatch(l -> l.endsWith(" " + name))) {
+                throw new RuntimeException(name + " missing from " + map);
+            }
+        } finally {
+            Files.deleteIfExists(map);
+        }
+    }
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary SuperWord vectorizes loops over two possibly aliasing array
+ *          parameters behind a runtime check, and the result stays correct
+ *          when both parameters are the same array.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib /
+ * @run driver compiler.loopopts.superword.TestAliasingArrayParameters
+ */
+package compiler.loopopts.superword;
+
+import compiler.lib.ir_framework.*;
+import jdk.test.lib.Asserts;
+
+public class TestAliasingArrayParameters {
+    static final int SIZE = 1024;
+    static final int[] OFFSETS = { 0, 1, 2, 3, 7, 8, 15, 16, 31, 64 };
+
+    int[] a = new int[SIZE];
+    int[] b = new int[SIZE];
+
+    public static void main(String[] args) {
+        TestFramework framework = new TestFramework();
+        framework.addScenarios(new Scenario(0, "-XX:+UnlockDiagnosticVMOptions", "-XX:+UseAutoVectorizationAliasingChecks"),
+                               new Scenario(1, "-XX:+UnlockDiagnosticVMOptions", "-XX:-UseAutoVectorizationAliasingChecks"));
+        framework.start();
+    }
+
+    @Test
+    @IR(counts = {IRNode.LOAD_VECTOR_I, "> 0", IRNode.STORE_VECTOR, "> 0"},
+        applyIf = {"UseAutoVectorizationAliasingChecks", "true"},
+        applyIfCPUFeatureOr = {"sse4.1", "true", "asimd", "true"})
+    static void copy(int[] src, int[] dst) {
+        for (int i = 0; i < src.length; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @Run(test = "copy")
+    void runCopy() {
+        init(a);
+        copy(a, b);
+        for (int i = 0; i < SIZE; i++) {
+            Asserts.assertEQ(a[i] + 1, b[i]);
+        }
+        // Both parameters refer to the same array.
+        init(a);
+        int[] expected = a.clone();
+        copyReference(expected, expected);
+        copy(a, a);
+        Asserts.assertEQ(java.util.Arrays.toString(expected), java.util.Arrays.toString(a));
+    }
+
+    @Test
+    static void copyOffset(int[] src, int srcOff, int[] dst, int dstOff, int len) {
+        for (int i = 0; i < len; i++) {
+            dst[i + dstOff] = src[i + srcOff] + 1;
+        }
+    }
+
+    @Run(test = "copyOffset")
+    void runCopyOffset() {
+        // Pass the same array for both parameters at every pair of offsets so
+        // that the accesses overlap in both directions, and compare with the
+        // interpreted reference.
+        for (int srcOff : OFFSETS) {
+            for (int dstOff : OFFSETS) {
+                int len = SIZE - Math.max(srcOff, dstOff);
+                init(a);
+                int[] expected = a.clone();
+                copyOffsetReference(expected, srcOff, expected, dstOff, len);
+                copyOffset(a, srcOff, a, dstOff, len);
+                for (int i = 0; i < SIZE; i++) {
+                    Asserts.assertEQ(expected[i], a[i], "srcOff=" + srcOff + " dstOff=" + dstOff + " i=" + i);
+                }
+            }
+        }
+    }
+
+    @DontCompile
+    static void copyReference(int[] src, int[] dst) {
+        for (int i = 0; i < src.length; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    @DontCompile
+    static void copyOffsetReference(int[] src, int srcOff, int[] dst, int dstOff, int len) {
+        for (int i = 0; i < len; i++) {
+            dst[i + dstOff] = src[i + srcOff] + 1;
+        }
+    }
+
+    static void init(int[] arr) {
+        for (int i = 0; i < arr.length; i++) {
+            arr[i] = i * 3;
+        }
+    }
+}
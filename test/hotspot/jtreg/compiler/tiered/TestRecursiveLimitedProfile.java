@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Directly recursive methods are first compiled at tier 2 instead
+ *          of with full profiling at tier 3
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:+TieredCompilation
+ *                   compiler.tiered.TestRecursiveLimitedProfile 2
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:+TieredCompilation -XX:Tier2RecursiveProfileDelayFactor=1
+ *                   compiler.tiered.TestRecursiveLimitedProfile 3
+ */
+
+package compiler.tiered;
+
+import java.lang.reflect.Method;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestRecursiveLimitedProfile {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    static int fib(int n) {
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    }
+
+    public static void main(String[] args) throws Exception {
+        int expectedLevel = Integer.parseInt(args[0]);
+        Method m = TestRecursiveLimitedProfile.class.getDeclaredMethod("fib", int.class);
+
+        // fib(10) makes fewer calls than the tier 3 invocation threshold, so the
+        // first compilation is seen before the method can move on.
+        int level = 0;
+        for (int i = 0; i < 100_000 && level == 0; i++) {
+            if (fib(10) != 55) {
+                throw new RuntimeException("Wrong result");
+            }
+            level = WB.getMethodCompilationLevel(m);
+        }
+        if (level != expectedLevel) {
+            throw new RuntimeException("fib() first compiled at level " + level + ", expected " + expectedLevel);
+        }
+
+        // The method still gets to tier 4 eventually.
+        for (int i = 0; i < 100_000 && WB.getMethodCompilationLevel(m) != 4; i++) {
+            fib(10);
+        }
+        if (WB.getMethodCompilationLevel(m) != 4) {
+            throw new RuntimeException("fib() not compiled at level 4");
+        }
+    }
+}
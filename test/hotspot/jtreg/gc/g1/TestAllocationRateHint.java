@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/**
+ * @test TestAllocationRateHint
+ * @requires vm.gc.G1
+ * @summary The G1AllocationRateHint flag can be changed at runtime and
+ *          young collections keep working with the hinted rate.
+ * @library /test/lib
+ * @modules java.management
+ * @run main/othervm -XX:+UseG1GC -Xmx128M -Xlog:gc gc.g1.TestAllocationRateHint
+ */
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+import java.lang.management.ManagementFactory;
+import static jdk.test.lib.Asserts.*;
+
+public class TestAllocationRateHint {
+    private static final String FLAG = "G1AllocationRateHint";
+
+    static volatile Object sink;
+
+    private static void allocate(int megabytes) {
+        for (int i = 0; i < megabytes * 16; i++) {
+            sink = new byte[64 * 1024];
+        }
+    }
+
+    public static void main(String[] args) {
+        HotSpotDiagnosticMXBean bean = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        assertTrue(bean.getVMOption(FLAG).isWriteable(), FLAG + " should be manageable");
+        assertEquals(bean.getVMOption(FLAG).getValue(), "0");
+
+        allocate(512);
+
+        // Hint a rate far above what this test allocates, then go back to
+        // the predicted rate.
+        String hint = Long.toString(4L * 1024 * 1024 * 1024);
+        bean.setVMOption(FLAG, hint);
+        assertEquals(bean.getVMOption(FLAG).getValue(), hint);
+        allocate(512);
+
+        bean.setVMOption(FLAG, "0");
+        allocate(512);
+    }
+}
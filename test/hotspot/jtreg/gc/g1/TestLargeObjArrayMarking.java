@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestLargeObjArrayMarking
+ * @summary Concurrent marking of large object arrays split into chunks
+ *          for several marking threads marks every element.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -Xmx256M -XX:G1HeapRegionSize=1M -XX:ConcGCThreads=4
+ *                   -XX:+VerifyDuringGC -XX:+VerifyAfterGC -Xlog:gc
+ *                   gc.g1.TestLargeObjArrayMarking
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UseG1GC -Xmx256M -XX:G1HeapRegionSize=1M -XX:ConcGCThreads=1
+ *                   -XX:+VerifyDuringGC -XX:+VerifyAfterGC -Xlog:gc
+ *                   gc.g1.TestLargeObjArrayMarking
+ */
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestLargeObjArrayMarking {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+
+    // A humongous array and one that fits into a region, both large
+    // enough to be split into several chunks.
+    private static final int[] LENGTHS = { 2 * 1024 * 1024, 100 * 1000 };
+
+    static class Element {
+        final int value;
+        Element(int value) { this.value = value; }
+    }
+
+    private static Element[][] arrays = new Element[LENGTHS.length][];
+
+    private static void check() {
+        for (Element[] array : arrays) {
+            for (int i = 0; i < array.length; i++) {
+                if (array[i].value != i) {
+                    throw new RuntimeException("Element " + i + " of array of length " + array.length +
+                                               " is " + array[i].value);
+                }
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int a = 0; a < LENGTHS.length; a++) {
+            arrays[a] = new Element[LENGTHS[a]];
+            // Promote the array so that its elements are only kept alive
+            // through the marking of the array during the next cycle.
+            WB.youngGC();
+            WB.youngGC();
+            for (int i = 0; i < LENGTHS[a]; i++) {
+                arrays[a][i] = new Element(i);
+            }
+        }
+        WB.fullGC();
+
+        for (int round = 0; round < 3; round++) {
+            WB.g1RunConcurrentGC();
+            // Mixed collections reclaim whatever marking missed.
+            for (int i = 0; i < 4; i++) {
+                WB.youngGC();
+            }
+            check();
+        }
+    }
+}
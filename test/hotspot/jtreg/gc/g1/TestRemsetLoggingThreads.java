@@ -58,6 +58,7 @@ private static void runTest(int refinementThreads, int workerThreads) throws Exc
       throw new Exception("Could not find correct output for concurrent RS threads times in stdout," +
         " should match the pattern \"" + pattern + "\", but stdout is \n" + output.getStdout());
     }
+    output.shouldMatch("Card set memory returned to OS: \\d+");
     output.shouldHaveExitValue(0);
   }
 
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestSelfRefinement
+ * @summary Threads that dirty many cards between collections refine their
+ *          own update buffers when G1SelfRefineDirtiedCardsThreshold is set.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestSelfRefinement
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSelfRefinement {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:+UseG1GC",
+                                                                    "-Xmx64M",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:G1SelfRefineDirtiedCardsThreshold=1000",
+                                                                    "-Xlog:gc+refine=trace",
+                                                                    Dirtier.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Self refinement enabled for thread dirtier, dirtied cards: \\d+");
+    }
+
+    static class Dirtier {
+        static volatile Object sink;
+
+        public static void main(String[] args) throws Exception {
+            Thread dirtier = new Thread(() -> {
+                // Keep storing young objects into a humongous, thus old,
+                // array, spread out so that almost every store dirties
+                // another card. Then allocate enough to get young
+                // collections, which decide about self refinement.
+                Object[] old = new Object[1024 * 1024];
+                for (int round = 0; round < 20; round++) {
+                    for (int i = 0; i < old.length; i += 64) {
+                        old[i] = new Object();
+                    }
+                    for (int i = 0; i < 32 * 1024; i++) {
+                        sink = new byte[1024];
+                    }
+                }
+                sink = old;
+            }, "dirtier");
+            dirtier.start();
+            dirtier.join();
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+package gc.g1;
+
+/*
+ * @test TestUncommitLazily
+ * @summary Shrinking and expanding the heap with G1UncommitLazily keeps the
+ *          heap and its auxiliary data structures consistent.
+ * @requires vm.gc.G1 & os.family == "linux"
+ * @library /test/lib
+ * @modules java.management
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions -XX:+G1UncommitLazily
+ *                   -Xms16M -Xmx256M -XX:G1HeapRegionSize=1M
+ *                   -XX:MinHeapFreeRatio=5 -XX:MaxHeapFreeRatio=10
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+VerifyBeforeGC -XX:+VerifyAfterGC
+ *                   -Xlog:gc+heap=debug
+ *                   gc.g1.TestUncommitLazily
+ */
+
+import java.lang.management.ManagementFactory;
+import java.util.ArrayList;
+
+import static jdk.test.lib.Asserts.*;
+
+public class TestUncommitLazily {
+    private static final int ARRAY_LENGTH = 64 * 1024;
+    private static final int NUM_ARRAYS = 2000;
+
+    private static long committed() {
+        return ManagementFactory.getMemoryMXBean().getHeapMemoryUsage().getCommitted();
+    }
+
+    private static ArrayList<int[]> fill() {
+        ArrayList<int[]> arrays = new ArrayList<>();
+        for (int i = 0; i < NUM_ARRAYS; i++) {
+            int[] array = new int[ARRAY_LENGTH];
+            for (int j = 0; j < array.length; j += 512) {
+                assertEquals(array[j], 0, "Newly allocated array is not cleared");
+                array[j] = i;
+            }
+            arrays.add(array);
+        }
+        return arrays;
+    }
+
+    public static void main(String[] args) {
+        for (int round = 0; round < 3; round++) {
+            ArrayList<int[]> arrays = fill();
+            System.gc();
+            long expanded = committed();
+            for (int i = 0; i < arrays.size(); i++) {
+                assertEquals(arrays.get(i)[512], i, "Array content changed");
+            }
+
+            arrays = null;
+            System.gc();
+            long shrunk = committed();
+            System.out.println("Expanded to " + expanded + ", shrunk to " + shrunk);
+            assertLessThan(shrunk, expanded, "Heap did not shrink");
+        }
+    }
+}
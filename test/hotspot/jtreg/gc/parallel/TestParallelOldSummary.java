@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Full GCs summarize the old generation with the GC workers when it
+ *          spans several PSSummaryRegionsPerChunk chunks, and the compacted
+ *          heap stays intact
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @run main/othervm -XX:+UseParallelGC -Xmx128m -Xmn16m -XX:ParallelGCThreads=4
+ *                   -XX:-UseDynamicNumberOfGCThreads -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:PSSummaryRegionsPerChunk=4 -XX:+VerifyAfterGC
+ *                   gc.parallel.TestParallelOldSummary
+ * @run main/othervm -XX:+UseParallelGC -Xmx128m -Xmn16m -XX:ParallelGCThreads=4
+ *                   -XX:-UseDynamicNumberOfGCThreads -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:PSSummaryRegionsPerChunk=1 -XX:MarkSweepDeadRatio=0
+ *                   -XX:+VerifyAfterGC gc.parallel.TestParallelOldSummary
+ */
+
+package gc.parallel;
+
+import jdk.test.lib.Asserts;
+
+public class TestParallelOldSummary {
+    static final int ARRAYS = 40_000;
+    static final int ARRAY_LENGTH = 256;
+    static final int FULL_GCS = 5;
+
+    static int[][] arrays = new int[ARRAYS][];
+
+    public static void main(String[] args) {
+        for (int i = 0; i < ARRAYS; i++) {
+            arrays[i] = newArray(i);
+        }
+        // Promote everything, so that the old generation spans many chunks.
+        System.gc();
+
+        for (int gc = 0; gc < FULL_GCS; gc++) {
+            // Drop a different stride of arrays each time and refill some of
+            // the holes, so that every full GC has live data to move down.
+            int stride = gc + 2;
+            for (int i = gc; i < ARRAYS; i += stride) {
+                arrays[i] = (i % 3 == 0) ? newArray(i) : null;
+            }
+            System.gc();
+            verify();
+        }
+    }
+
+    static int[] newArray(int seed) {
+        int[] a = new int[ARRAY_LENGTH];
+        for (int j = 0; j < ARRAY_LENGTH; j++) {
+            a[j] = seed * 31 + j;
+        }
+        return a;
+    }
+
+    static void verify() {
+        for (int i = 0; i < ARRAYS; i++) {
+            int[] a = arrays[i];
+            if (a == null) {
+                continue;
+            }
+            Asserts.assertEQ(ARRAY_LENGTH, a.length, "array " + i + " has the wrong length");
+            for (int j = 0; j < ARRAY_LENGTH; j++) {
+                Asserts.assertEQ(i * 31 + j, a[j], "array " + i + " is corrupt at " + j);
+            }
+        }
+    }
+}
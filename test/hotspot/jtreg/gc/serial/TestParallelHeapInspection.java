@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Heap inspection walks the Serial heap with safepoint workers when
+ *          ParallelGCThreads is set, and still sees every object
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UseSerialGC -XX:ParallelGCThreads=4 -Xmx256m
+ *                   gc.serial.TestParallelHeapInspection
+ * @run main/othervm -XX:+UseSerialGC -Xmx256m
+ *                   gc.serial.TestParallelHeapInspection
+ */
+
+package gc.serial;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestParallelHeapInspection {
+    static final int COUNT = 200_000;
+
+    static class Marker {
+        final long value;
+        Marker(long value) { this.value = value; }
+    }
+
+    static Object[] markers;
+
+    public static void main(String[] args) {
+        markers = new Object[COUNT];
+        for (int i = 0; i < COUNT; i++) {
+            markers[i] = new Marker(i);
+        }
+        // Promote most of them, so that the old gen blocks are walked too.
+        System.gc();
+        for (int i = 0; i < COUNT; i += 2) {
+            markers[i] = new Marker(-i);
+        }
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute("GC.class_histogram -parallel=4");
+        output.shouldMatch("\\s+" + COUNT + "\\s+\\d+\\s+gc\\.serial\\.TestParallelHeapInspection\\$Marker");
+    }
+}
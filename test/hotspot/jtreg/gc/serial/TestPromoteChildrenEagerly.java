@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.serial;
+
+/*
+ * @test
+ * @summary Young collections that copy the children of promoted objects
+ *          right away keep object graphs and weak references intact
+ * @requires vm.gc.Serial
+ * @run main/othervm -XX:+UseSerialGC -Xmn8m -Xmx128m -XX:MaxTenuringThreshold=1
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+SerialPromoteChildrenEagerly
+ *                   gc.serial.TestPromoteChildrenEagerly
+ * @run main/othervm -XX:+UseSerialGC -Xmn8m -Xmx128m -XX:MaxTenuringThreshold=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+SerialPromoteChildrenEagerly
+ *                   gc.serial.TestPromoteChildrenEagerly
+ */
+
+import java.lang.ref.WeakReference;
+
+public class TestPromoteChildrenEagerly {
+    static final int TREES = 64;
+    static final int DEPTH = 10;
+
+    static class Node {
+        final int value;
+        Node left;
+        Node right;
+        WeakReference<Object> weak;
+
+        Node(int value) {
+            this.value = value;
+        }
+    }
+
+    static volatile Object sink;
+
+    static Node build(int value, int depth) {
+        Node node = new Node(value);
+        // Only reachable through the weak reference, so it must not be
+        // kept alive by copying the children of the promoted node.
+        node.weak = new WeakReference<>(new byte[16]);
+        if (depth > 0) {
+            node.left = build(2 * value, depth - 1);
+            node.right = build(2 * value + 1, depth - 1);
+        }
+        return node;
+    }
+
+    static void check(Node node, int value, int depth) {
+        if (node.value != value) {
+            throw new RuntimeException("Expected " + value + ", got " + node.value);
+        }
+        if (depth > 0) {
+            check(node.left, 2 * value, depth - 1);
+            check(node.right, 2 * value + 1, depth - 1);
+        } else if (node.left != null || node.right != null) {
+            throw new RuntimeException("Unexpected children at " + value);
+        }
+    }
+
+    static int clearedReferents(Node node) {
+        int cleared = node.weak.get() == null ? 1 : 0;
+        if (node.left != null) {
+            cleared += clearedReferents(node.left) + clearedReferents(node.right);
+        }
+        return cleared;
+    }
+
+    public static void main(String[] args) {
+        Node[] trees = new Node[TREES];
+        for (int round = 0; round < 10; round++) {
+            for (int i = 0; i < TREES; i++) {
+                trees[i] = build(1, DEPTH);
+                // Garbage that pushes the trees through several young collections.
+                for (int j = 0; j < 100; j++) {
+                    sink = new int[256];
+                }
+            }
+            for (int i = 0; i < TREES; i++) {
+                check(trees[i], 1, DEPTH);
+            }
+        }
+        for (int i = 0; i < 100_000; i++) {
+            sink = new int[256];
+        }
+        if (clearedReferents(trees[0]) == 0) {
+            throw new RuntimeException("No weak referent was cleared");
+        }
+    }
+}
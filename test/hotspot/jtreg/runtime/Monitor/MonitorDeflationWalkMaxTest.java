@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/*
+ * @test
+ * @summary Deflation cycles limited by MonitorDeflationWalkMax continue where
+ *          the previous one stopped and eventually deflate every idle monitor
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run driver MonitorDeflationWalkMaxTest
+ */
+
+public class MonitorDeflationWalkMaxTest {
+
+    public static class Test {
+        private static final int MONITORS = 10_000;
+        private static final int THREADS = 16;
+
+        private static Object[] monitors;
+
+        public static void main(String... args) throws Exception {
+            monitors = new Object[MONITORS];
+            Thread[] threads = new Thread[THREADS];
+
+            for (int t = 0; t < THREADS; t++) {
+                int monStart = t * MONITORS / THREADS;
+                int monEnd = (t + 1) * MONITORS / THREADS;
+                threads[t] = new Thread(() -> {
+                    for (int m = monStart; m < monEnd; m++) {
+                        Object o = new Object();
+                        synchronized (o) {
+                            try {
+                                o.wait(1);
+                            } catch (InterruptedException e) {
+                            }
+                        }
+                        monitors[m] = o;
+                    }
+                });
+                threads[t].start();
+            }
+
+            for (Thread t : threads) {
+                t.join();
+            }
+
+            Thread.sleep(5_000);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-Xmx100M",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:MonitorDeflationWalkMax=1024",
+            "-XX:GuaranteedAsyncDeflationInterval=100",
+            "-Xlog:monitorinflation=info",
+            "MonitorDeflationWalkMaxTest$Test");
+
+        OutputAnalyzer oa = new OutputAnalyzer(pb.start());
+        oa.shouldHaveExitValue(0);
+
+        // No single cycle may deflate more monitors than it was allowed to examine.
+        // Only the end-of-cycle line counts, "pausing deflation" lines repeat
+        // a running count.
+        Pattern deflated = Pattern.compile("\\] deflated_count=(\\d+), ");
+        Matcher m = deflated.matcher(oa.getStdout());
+        long total = 0;
+        int cycles = 0;
+        while (m.find()) {
+            long count = Long.parseLong(m.group(1));
+            if (count > 1024) {
+                throw new RuntimeException("Cycle deflated " + count + " monitors, more than MonitorDeflationWalkMax");
+            }
+            total += count;
+            cycles++;
+        }
+        if (total < 10_000) {
+            throw new RuntimeException("Only " + total + " monitors deflated in " + cycles + " cycles");
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Thread.lock_stats reports contended monitors by class when
+ *          MonitorContentionStatistics is enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+MonitorContentionStatistics TestLockStats
+ */
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestLockStats {
+    static class ContendedLock {}
+
+    static final ContendedLock lock = new ContendedLock();
+
+    public static void main(String[] args) throws Exception {
+        Thread holder;
+        synchronized (lock) {
+            holder = new Thread(() -> {
+                synchronized (lock) {
+                    // Blocks until main releases the lock.
+                }
+            });
+            holder.start();
+            while (holder.getState() != Thread.State.BLOCKED) {
+                Thread.sleep(10);
+            }
+            Thread.sleep(50);
+        }
+        holder.join();
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute("Thread.lock_stats -reset");
+        output.shouldContain("Contended monitor enters:");
+        output.shouldContain("TestLockStats$ContendedLock");
+
+        output = new PidJcmdExecutor().execute("Thread.lock_stats");
+        output.shouldNotContain("TestLockStats$ContendedLock");
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Contended monitors stay correct and every waiter makes progress
+ *          when successors are chosen by NUMA node
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseNUMA
+ *                   -XX:+MonitorNUMAHandoff TestNUMAHandoff
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseNUMA
+ *                   -XX:+MonitorNUMAHandoff -XX:MonitorNUMAHandoffLimit=1 TestNUMAHandoff
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseNUMA
+ *                   -XX:-MonitorNUMAHandoff TestNUMAHandoff
+ */
+
+public class TestNUMAHandoff {
+    static final int THREADS = 16;
+    static final long DURATION_MS = 2000;
+
+    static final Object lock = new Object();
+    static long counter = 0;
+    static volatile boolean done = false;
+
+    public static void main(String[] args) throws Exception {
+        long[] acquired = new long[THREADS];
+        Thread[] threads = new Thread[THREADS];
+        for (int i = 0; i < THREADS; i++) {
+            final int id = i;
+            threads[i] = new Thread(() -> {
+                while (!done) {
+                    synchronized (lock) {
+                        counter++;
+                        acquired[id]++;
+                    }
+                }
+            });
+            threads[i].start();
+        }
+
+        Thread.sleep(DURATION_MS);
+        done = true;
+        for (Thread t : threads) {
+            t.join();
+        }
+
+        long sum = 0;
+        for (int i = 0; i < THREADS; i++) {
+            if (acquired[i] == 0) {
+                throw new RuntimeException("Thread " + i + " never acquired the monitor");
+            }
+            sum += acquired[i];
+        }
+        if (sum != counter) {
+            throw new RuntimeException("Lost updates: " + counter + " != " + sum);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With NativeMemorySampleInterval, summary tracking reports sampled
+ *          malloc sites in VM.native_memory detail and detail.diff
+ * @library /test/lib
+ * @run main/othervm -XX:NativeMemoryTracking=summary
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:NativeMemorySampleInterval=4096
+ *                   SummarySampledSitesTest
+ */
+
+import jdk.test.lib.JDKToolFinder;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class SummarySampledSitesTest {
+    static OutputAnalyzer jcmd(String... args) throws Exception {
+        String[] command = new String[args.length + 3];
+        command[0] = JDKToolFinder.getJDKTool("jcmd");
+        command[1] = Long.toString(ProcessTools.getProcessId());
+        command[2] = "VM.native_memory";
+        System.arraycopy(args, 0, command, 3, args.length);
+        OutputAnalyzer output = new OutputAnalyzer(new ProcessBuilder(command).start());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = jcmd("detail", "scale=1");
+        output.shouldNotContain("Detail tracking is not enabled");
+        output.shouldContain("Malloc sites sampled about every 4096 bytes");
+        output.shouldMatch("\\(malloc=\\d+ tag=\\w+");
+        // Virtual memory has no stacks in summary mode
+        output.shouldNotContain("Virtual memory map:");
+
+        jcmd("baseline").shouldContain("Baseline taken");
+        output = jcmd("detail.diff", "scale=1");
+        output.shouldNotContain("Detail tracking is not enabled");
+        output.shouldNotContain("No detail baseline for comparison");
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary VM.safepoint_stats reports the compiled polls that delayed
+ *          safepoints when TimeToSafepointProfile is enabled
+ * @requires vm.compMode != "Xint"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+TimeToSafepointProfile
+ *                   -XX:TimeToSafepointProfileThreshold=0 TestTimeToSafepointProfile
+ */
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestTimeToSafepointProfile {
+    static volatile boolean done = false;
+    static volatile long sink;
+
+    static long spin(long n) {
+        long sum = 0;
+        for (long i = 0; i < n; i++) {
+            sum += i ^ (sum >>> 3);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Get spin() compiled, so that the spinner reaches compiled polls.
+        for (int i = 0; i < 20_000; i++) {
+            sink = spin(1_000);
+        }
+        Thread spinner = new Thread(() -> {
+            while (!done) {
+                sink = spin(1_000_000);
+            }
+        });
+        spinner.start();
+        try {
+            for (int i = 0; i < 50; i++) {
+                System.gc();
+                Thread.sleep(10);
+            }
+        } finally {
+            done = true;
+            spinner.join();
+        }
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute("VM.safepoint_stats -reset");
+        output.shouldContain("Safepoint operations:");
+        output.shouldContain("Compiled polls reached after 0.000 ms:");
+        output.shouldContain("TestTimeToSafepointProfile.spin");
+
+        output = new PidJcmdExecutor().execute("VM.safepoint_stats");
+        output.shouldNotContain("TestTimeToSafepointProfile.spin");
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Stack pages touched by a deep recursion are trimmed when the thread parks
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run driver TestStackTrim
+ */
+
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestStackTrim {
+    static volatile int sink;
+
+    static int recurse(int depth) {
+        if (depth == 0) {
+            return 0;
+        }
+        return recurse(depth - 1) + 1;
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (args.length > 0) {
+            Thread t = new Thread(null, () -> {
+                for (int i = 0; i < 3; i++) {
+                    sink = recurse(50_000);
+                    LockSupport.parkNanos(1_000_000);
+                }
+            }, "deep", 64 * 1024 * 1024);
+            t.start();
+            t.join();
+            return;
+        }
+
+        ProcessBuilder pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-XX:StackTrimThreshold=1m", "-Xlog:os+thread=debug", "-Xint",
+            TestStackTrim.class.getName(), "run");
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("of unused stack");
+
+        pb = ProcessTools.createLimitedTestJavaProcessBuilder(
+            "-Xlog:os+thread=debug", "-Xint",
+            TestStackTrim.class.getName(), "run");
+        output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("of unused stack");
+    }
+}
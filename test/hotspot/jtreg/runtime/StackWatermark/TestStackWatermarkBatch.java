@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=z
+ * @summary Deep stacks stay consistent when concurrent stack processing
+ *          handles several frames per watermark crossing
+ * @requires vm.gc.Z
+ * @run main/othervm -Xss16m -Xmx128m -XX:+UseZGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:StackWatermarkBatchSize=64
+ *      TestStackWatermarkBatch
+ */
+
+/*
+ * @test id=shenandoah
+ * @summary Deep stacks stay consistent when concurrent stack processing
+ *          handles several frames per watermark crossing
+ * @requires vm.gc.Shenandoah
+ * @run main/othervm -Xss16m -Xmx128m -XX:+UseShenandoahGC
+ *      -XX:+UnlockDiagnosticVMOptions -XX:+UnlockExperimentalVMOptions
+ *      -XX:ShenandoahGCHeuristics=aggressive -XX:StackWatermarkBatchSize=64
+ *      TestStackWatermarkBatch
+ */
+
+public class TestStackWatermarkBatch {
+    static final int DEPTH = 20_000;
+    static final int ROUNDS = 20;
+
+    static class Node {
+        final int depth;
+        final int[] payload;
+
+        Node(int depth) {
+            this.depth = depth;
+            this.payload = new int[] { depth, -depth };
+        }
+
+        void check(int expected) {
+            if (depth != expected || payload[0] != expected || payload[1] != -expected) {
+                throw new RuntimeException("Corrupted node at depth " + expected);
+            }
+        }
+    }
+
+    static volatile boolean done = false;
+    static volatile Object sink;
+
+    // Alternate frames that hold an oop across the call with frames that
+    // hold none, so that both kinds end up behind the watermark.
+    static int recurse(int depth) {
+        if (depth == DEPTH) {
+            for (int i = 0; i < 1000; i++) {
+                sink = new byte[1024];
+            }
+            return 0;
+        }
+        if ((depth & 1) == 0) {
+            Node node = new Node(depth);
+            int result = recurse(depth + 1);
+            node.check(depth);
+            return result + 1;
+        }
+        return recurse(depth + 1) + 1;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Thread allocator = new Thread(() -> {
+            while (!done) {
+                sink = new Object[128];
+            }
+        });
+        allocator.start();
+        try {
+            for (int i = 0; i < ROUNDS; i++) {
+                int result = recurse(0);
+                if (result != DEPTH) {
+                    throw new RuntimeException("Unexpected result " + result);
+                }
+                System.gc();
+            }
+        } finally {
+            done = true;
+            allocator.join();
+        }
+    }
+}
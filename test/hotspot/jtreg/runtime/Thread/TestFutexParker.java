@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check LockSupport.park/unpark with the futex-based Parker
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseFutexParker TestFutexParker
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseFutexParker -XX:ParkSpinLimit=2000 TestFutexParker
+ */
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.Asserts;
+
+public class TestFutexParker {
+    static final int HANDOFFS = 100_000;
+    static final long LONG_TIMEOUT_NANOS = TimeUnit.SECONDS.toNanos(60);
+
+    public static void main(String[] args) throws Exception {
+        testPermit();
+        testHandoff();
+        testTimedRelative();
+        testTimedAbsolute();
+        testInterrupt();
+    }
+
+    // unpark() before park() leaves a permit, and permits do not accumulate.
+    static void testPermit() {
+        Thread self = Thread.currentThread();
+        LockSupport.unpark(self);
+        LockSupport.unpark(self);
+        long start = System.nanoTime();
+        LockSupport.park();
+        Asserts.assertLT(System.nanoTime() - start, LONG_TIMEOUT_NANOS / 2, "park did not consume the permit");
+
+        // The permit is gone, so a timed park must run to its timeout.
+        long timeout = TimeUnit.MILLISECONDS.toNanos(100);
+        long deadline = System.nanoTime() + timeout;
+        parkNanosUntil(deadline);
+    }
+
+    // Two threads that hand a token back and forth with park/unpark.
+    static void testHandoff() throws Exception {
+        AtomicBoolean ping = new AtomicBoolean();
+        Thread main = Thread.currentThread();
+        Thread partner = new Thread(() -> {
+            for (int i = 0; i < HANDOFFS; i++) {
+                while (!ping.get()) {
+                    LockSupport.park();
+                }
+                ping.set(false);
+                LockSupport.unpark(main);
+            }
+        });
+        partner.start();
+        for (int i = 0; i < HANDOFFS; i++) {
+            ping.set(true);
+            LockSupport.unpark(partner);
+            while (ping.get()) {
+                LockSupport.park();
+            }
+        }
+        partner.join();
+    }
+
+    static void testTimedRelative() throws Exception {
+        // With nobody to unpark, parkNanos returns once the timeout passed.
+        long start = System.nanoTime();
+        LockSupport.parkNanos(TimeUnit.MILLISECONDS.toNanos(100));
+        Asserts.assertLT(System.nanoTime() - start, LONG_TIMEOUT_NANOS / 2, "parkNanos did not time out");
+
+        // An unpark wakes a thread parked with a long timeout early.
+        AtomicBoolean woken = new AtomicBoolean();
+        Thread waiter = new Thread(() -> {
+            long deadline = System.nanoTime() + LONG_TIMEOUT_NANOS;
+            while (!woken.get() && System.nanoTime() < deadline) {
+                LockSupport.parkNanos(deadline - System.nanoTime());
+            }
+        });
+        long wakeStart = System.nanoTime();
+        waiter.start();
+        Thread.sleep(100);
+        woken.set(true);
+        LockSupport.unpark(waiter);
+        waiter.join();
+        Asserts.assertLT(System.nanoTime() - wakeStart, LONG_TIMEOUT_NANOS / 2, "unpark did not wake a timed park");
+    }
+
+    static void testTimedAbsolute() throws Exception {
+        // A deadline in the past does not block.
+        LockSupport.parkUntil(System.currentTimeMillis() - 1000);
+
+        // A near deadline is reached.
+        long deadline = System.currentTimeMillis() + 100;
+        while (System.currentTimeMillis() < deadline) {
+            LockSupport.parkUntil(deadline);
+        }
+
+        // An unpark wakes a thread parked until a far deadline.
+        AtomicBoolean woken = new AtomicBoolean();
+        Thread waiter = new Thread(() -> {
+            long farDeadline = System.currentTimeMillis() + TimeUnit.NANOSECONDS.toMillis(LONG_TIMEOUT_NANOS);
+            while (!woken.get() && System.currentTimeMillis() < farDeadline) {
+                LockSupport.parkUntil(farDeadline);
+            }
+        });
+        long wakeStart = System.nanoTime();
+        waiter.start();
+        Thread.sleep(100);
+        woken.set(true);
+        LockSupport.unpark(waiter);
+        waiter.join();
+        Asserts.assertLT(System.nanoTime() - wakeStart, LONG_TIMEOUT_NANOS / 2, "unpark did not wake an absolute park");
+    }
+
+    static void testInterrupt() throws Exception {
+        // A pending interrupt makes park return at once.
+        Thread.currentThread().interrupt();
+        LockSupport.park();
+        Asserts.assertTrue(Thread.interrupted(), "park cleared the interrupt status");
+
+        // An interrupt wakes an untimed park.
+        Thread waiter = new Thread(() -> {
+            while (!Thread.currentThread().isInterrupted()) {
+                LockSupport.park();
+            }
+        });
+        long start = System.nanoTime();
+        waiter.start();
+        Thread.sleep(100);
+        waiter.interrupt();
+        waiter.join();
+        Asserts.assertLT(System.nanoTime() - start, LONG_TIMEOUT_NANOS / 2, "interrupt did not wake park");
+    }
+
+    static void parkNanosUntil(long deadline) {
+        long remaining;
+        while ((remaining = deadline - System.nanoTime()) > 0) {
+            LockSupport.parkNanos(remaining);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that thread dumps formatted on the safepoint workers
+ *          contain every thread and its stack exactly once
+ *
+ * @library /test/lib
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:ParallelThreadDumpThreshold=1 TestParallelThreadDump
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:ParallelThreadDumpThreshold=1 -XX:+UseParallelGC TestParallelThreadDump
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:ParallelThreadDumpThreshold=0 TestParallelThreadDump
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadInfo;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.locks.LockSupport;
+
+import jdk.test.lib.JDKToolFinder;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestParallelThreadDump {
+    final static String JSTACK = JDKToolFinder.getTestJDKTool("jstack");
+    // jstack output may be lengthy, disable streaming output to avoid deadlocks
+    final static String DISABLE_STREAMING_OUTPUT = "-J-Djdk.attach.allowStreamingOutput=false";
+    final static String PID = "" + ProcessHandle.current().pid();
+
+    final static int THREADS = 300;
+    final static String THREAD_PREFIX = "ParallelDumpThread-";
+    final static String PARK_FRAME = "TestParallelThreadDump.parkHere";
+
+    static volatile boolean done = false;
+
+    static void parkHere(CountDownLatch started) {
+        started.countDown();
+        while (!done) {
+            LockSupport.park();
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        CountDownLatch started = new CountDownLatch(THREADS);
+        Thread[] threads = new Thread[THREADS];
+        for (int i = 0; i < THREADS; i++) {
+            threads[i] = new Thread(() -> parkHere(started), THREAD_PREFIX + i);
+            threads[i].start();
+        }
+        started.await();
+
+        try {
+            checkThreadMXBean();
+            checkJstack();
+        } finally {
+            done = true;
+            for (Thread t : threads) {
+                LockSupport.unpark(t);
+                t.join();
+            }
+        }
+    }
+
+    static void checkThreadMXBean() {
+        int found = 0;
+        for (ThreadInfo info : ManagementFactory.getThreadMXBean().dumpAllThreads(true, true)) {
+            if (!info.getThreadName().startsWith(THREAD_PREFIX)) {
+                continue;
+            }
+            found++;
+            boolean parked = false;
+            for (StackTraceElement e : info.getStackTrace()) {
+                if (e.getClassName().equals("TestParallelThreadDump") &&
+                    e.getMethodName().equals("parkHere")) {
+                    parked = true;
+                }
+            }
+            if (!parked) {
+                throw new RuntimeException("Missing parkHere frame for " + info.getThreadName());
+            }
+        }
+        if (found != THREADS) {
+            throw new RuntimeException("Expected " + THREADS + " threads in dump, found " + found);
+        }
+    }
+
+    static void checkJstack() throws Exception {
+        ProcessBuilder pb = new ProcessBuilder(JSTACK, DISABLE_STREAMING_OUTPUT, PID);
+        OutputAnalyzer output = new OutputAnalyzer(pb.start());
+        output.shouldHaveExitValue(0);
+
+        int[] seen = new int[THREADS];
+        int frames = 0;
+        for (String line : output.asLines()) {
+            if (line.startsWith("\"" + THREAD_PREFIX)) {
+                int end = line.indexOf('"', 1);
+                seen[Integer.parseInt(line.substring(1 + THREAD_PREFIX.length(), end))]++;
+            } else if (line.contains("at " + PARK_FRAME + "(")) {
+                frames++;
+            }
+        }
+        for (int i = 0; i < THREADS; i++) {
+            if (seen[i] != 1) {
+                output.reportDiagnosticSummary();
+                throw new RuntimeException(THREAD_PREFIX + i + " printed " + seen[i] + " times");
+            }
+        }
+        if (frames != THREADS) {
+            output.reportDiagnosticSummary();
+            throw new RuntimeException("Expected " + THREADS + " parkHere frames, found " + frames);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Java threads started on reused pooled stacks run, detect stack
+ *          overflow and exit like threads on fresh stacks
+ * @requires os.family == "linux"
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseThreadStackPool
+ *                   TestThreadStackPool
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseThreadStackPool
+ *                   -XX:ThreadStackPoolSize=1 TestThreadStackPool
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+UseThreadStackPool
+ *                   -XX:ThreadStackPoolSize=0 TestThreadStackPool
+ */
+
+import java.util.concurrent.atomic.AtomicInteger;
+
+public class TestThreadStackPool {
+    static final int ROUNDS = 20;
+    static final int THREADS = 50;
+
+    static int depth;
+
+    static void recurse() {
+        depth++;
+        recurse();
+    }
+
+    public static void main(String[] args) throws Exception {
+        AtomicInteger overflows = new AtomicInteger();
+        for (int round = 0; round < ROUNDS; round++) {
+            Thread[] threads = new Thread[THREADS];
+            for (int i = 0; i < THREADS; i++) {
+                // Alternate between two stack sizes so both share the pool.
+                long stackSize = (i % 2 == 0) ? 0 : 512 * 1024;
+                threads[i] = new Thread(null, () -> {
+                    try {
+                        recurse();
+                    } catch (StackOverflowError e) {
+                        overflows.incrementAndGet();
+                    }
+                }, "pooled-" + round + "-" + i, stackSize);
+                threads[i].start();
+            }
+            for (Thread t : threads) {
+                t.join();
+            }
+        }
+        if (overflows.get() != ROUNDS * THREADS) {
+            throw new RuntimeException("Expected " + (ROUNDS * THREADS) +
+                                       " stack overflows, got " + overflows.get());
+        }
+    }
+}
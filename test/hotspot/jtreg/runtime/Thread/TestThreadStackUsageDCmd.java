@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Check that Thread.stack_usage reports the depth of every thread
+ *          and accounts deep recursion to the recursive method
+ *
+ * @library /test/lib
+ * @run main/othervm TestThreadStackUsageDCmd
+ * @run main/othervm -Xint TestThreadStackUsageDCmd
+ */
+
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.locks.LockSupport;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.JDKToolFinder;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class TestThreadStackUsageDCmd {
+    final static String JCMD = JDKToolFinder.getTestJDKTool("jcmd");
+    final static String PID = "" + ProcessHandle.current().pid();
+
+    final static int DEPTH = 2000;
+    final static String THREAD_NAME = "StackUsageThread";
+
+    static volatile boolean done = false;
+
+    static int recurse(int n, CountDownLatch started) {
+        if (n == 0) {
+            started.countDown();
+            while (!done) {
+                LockSupport.park();
+            }
+            return 0;
+        }
+        return recurse(n - 1, started) + 1;
+    }
+
+    public static void main(String[] args) throws Exception {
+        CountDownLatch started = new CountDownLatch(1);
+        Thread thread = new Thread(() -> recurse(DEPTH, started), THREAD_NAME);
+        thread.start();
+        started.await();
+
+        try {
+            ProcessBuilder pb = new ProcessBuilder(JCMD, PID, "Thread.stack_usage", "-top=1");
+            OutputAnalyzer output = new OutputAnalyzer(pb.start());
+            output.shouldHaveExitValue(0);
+            output.shouldMatch("\"" + THREAD_NAME + "\" 0x\\p{XDigit}+: \\d+K / \\d+K / \\d+K, \\d+ frames");
+            output.shouldContain("Methods by cumulative frame bytes over all threads:");
+
+            // Compiled frames may cover several inlined levels, but recurse
+            // should still use more stack than any other method.
+            Pattern p = Pattern.compile("^\\s*(\\d+)\\s+(\\d+)\\s+(\\S.*)$");
+            String top = null;
+            for (String line : output.asLines()) {
+                Matcher m = p.matcher(line);
+                if (m.matches() && top == null) {
+                    top = m.group(3);
+                    if (Long.parseLong(m.group(1)) <= 0 || Long.parseLong(m.group(2)) <= 0) {
+                        output.reportDiagnosticSummary();
+                        throw new RuntimeException("Unexpected usage: " + line);
+                    }
+                }
+            }
+            if (top == null || !top.contains("TestThreadStackUsageDCmd.recurse(")) {
+                output.reportDiagnosticSummary();
+                throw new RuntimeException("recurse is not the top method: " + top);
+            }
+        } finally {
+            done = true;
+            LockSupport.unpark(thread);
+            thread.join();
+        }
+    }
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Backtraces of recursive stacks expand to the same stack trace with and without compaction
+ * @run main/othervm -XX:MaxJavaStackTraceDepth=100000 TestRecursiveBacktrace
+ * @run main/othervm -XX:MaxJavaStackTraceDepth=100000 -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:-CompactRecursiveBacktraces TestRecursiveBacktrace
+ * @run main/othervm -XX:MaxJavaStackTraceDepth=1000 TestRecursiveBacktrace
+ */
+
+import java.lang.StackWalker.StackFrame;
+import java.util.List;
+
+public class TestRecursiveBacktrace {
+    // Throwable backtraces show reflection frames but not hidden frames.
+    static final StackWalker WALKER = StackWalker.getInstance(StackWalker.Option.SHOW_REFLECT_FRAMES);
+
+    static Throwable throwable;
+    static List<StackFrame> frames;
+
+    static void capture() {
+        // Both on one line, so that the top frames match too.
+        throwable = new Throwable(); frames = WALKER.walk(s -> s.toList());
+    }
+
+    static void self(int n) {
+        if (n == 0) {
+            capture();
+        } else {
+            self(n - 1);
+        }
+    }
+
+    static void even(int n) {
+        if (n == 0) {
+            capture();
+        } else {
+            odd(n - 1);
+        }
+    }
+
+    static void odd(int n) {
+        if (n % 7 == 3) {
+            other(n);
+        } else {
+            even(n);
+        }
+    }
+
+    static void other(int n) {
+        even(n);
+    }
+
+    static void check(String name) {
+        StackTraceElement[] trace = throwable.getStackTrace();
+        if (trace.length > frames.size()) {
+            throw new RuntimeException(name + ": " + trace.length + " elements for " + frames.size() + " frames");
+        }
+        for (int i = 0; i < trace.length; i++) {
+            StackTraceElement e = trace[i];
+            StackFrame f = frames.get(i);
+            if (!e.getMethodName().equals(f.getMethodName()) ||
+                !e.getClassName().equals(f.getClassName()) ||
+                e.getLineNumber() != f.getLineNumber()) {
+                throw new RuntimeException(name + ": element " + i + " is " + e + ", expected " + f);
+            }
+        }
+        if (trace.length != frames.size() && trace.length != 1000) {
+            throw new RuntimeException(name + ": " + trace.length + " elements for " + frames.size() + " frames");
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int depth : new int[] { 0, 1, 2, 5, 100, 5000 }) {
+            self(depth);
+            check("self(" + depth + ")");
+            even(depth);
+            check("even(" + depth + ")");
+            other(depth);
+            check("other(" + depth + ")");
+        }
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary StackOverflowErrors thrown by the VM keep only the top and bottom
+ *          of the stack when StackOverflowErrorTraceFrames is set
+ * @run main/othervm -XX:StackOverflowErrorTraceFrames=16 TestStackOverflowErrorTrace
+ * @run main/othervm -Xint -XX:StackOverflowErrorTraceFrames=16 TestStackOverflowErrorTrace
+ * @run main/othervm -Xcomp -XX:StackOverflowErrorTraceFrames=16
+ *                   -XX:CompileCommand=compileonly,TestStackOverflowErrorTrace::recurse
+ *                   TestStackOverflowErrorTrace
+ */
+
+public class TestStackOverflowErrorTrace {
+    static final int FRAMES = 16;
+
+    static int recurse(int depth) {
+        return recurse(depth + 1) + 1;
+    }
+
+    static void check(StackOverflowError soe) {
+        StackTraceElement[] trace = soe.getStackTrace();
+        if (trace.length != 2 * FRAMES) {
+            throw new RuntimeException("Expected " + (2 * FRAMES) + " frames, got " + trace.length, soe);
+        }
+        for (int i = 0; i < FRAMES; i++) {
+            if (!trace[i].getMethodName().equals("recurse")) {
+                throw new RuntimeException("Frame " + i + " is not recurse: " + trace[i], soe);
+            }
+        }
+        // The harness may run main() from another thread, so main is not
+        // necessarily the bottom frame, but it must be among the kept ones.
+        boolean foundMain = false;
+        for (int i = FRAMES; i < trace.length; i++) {
+            if (trace[i].getMethodName().equals("main") &&
+                trace[i].getClassName().equals(TestStackOverflowErrorTrace.class.getName())) {
+                foundMain = true;
+                break;
+            }
+        }
+        if (!foundMain) {
+            throw new RuntimeException("main is not among the bottom " + FRAMES + " frames", soe);
+        }
+        String message = soe.getMessage();
+        if (message == null || !message.matches("\\d+ frames omitted after frame " + FRAMES + " of \\d+")) {
+            throw new RuntimeException("Unexpected message: " + message, soe);
+        }
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 3; i++) {
+            try {
+                recurse(0);
+                throw new RuntimeException("No StackOverflowError");
+            } catch (StackOverflowError soe) {
+                check(soe);
+            }
+        }
+    }
+}
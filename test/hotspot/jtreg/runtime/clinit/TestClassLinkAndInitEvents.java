@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary jdk.ClassLink and jdk.ClassInitialization are emitted for a class
+ *          that is linked and initialized while recording
+ * @requires vm.hasJFR
+ * @run main/othervm TestClassLinkAndInitEvents
+ */
+
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestClassLinkAndInitEvents {
+    static class Target {
+        static final long VALUE = System.nanoTime();
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("classlinkinit.jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.ClassLink");
+            recording.enable("jdk.ClassInitialization");
+            recording.start();
+            if (Target.VALUE == 0) {
+                throw new RuntimeException("Unexpected value");
+            }
+            recording.stop();
+            recording.dump(file);
+        }
+
+        String targetName = Target.class.getName();
+        boolean linked = false;
+        boolean initialized = false;
+        List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+        for (RecordedEvent e : events) {
+            switch (e.getEventType().getName()) {
+                case "jdk.ClassLink" ->
+                    linked |= e.getClass("linkedClass").getName().equals(targetName);
+                case "jdk.ClassInitialization" ->
+                    initialized |= e.getClass("initializedClass").getName().equals(targetName);
+            }
+        }
+        if (!linked) {
+            throw new RuntimeException("No jdk.ClassLink event for " + targetName);
+        }
+        if (!initialized) {
+            throw new RuntimeException("No jdk.ClassInitialization event for " + targetName);
+        }
+    }
+}
@@ -63,6 +63,8 @@ private static void test(int iterations) throws Exception {
             wb.asyncHandshakeWalkStack(wait_thread);
             Thread.sleep(200);
             wb.asyncHandshakeWalkStack(Thread.currentThread());
+            Thread.sleep(200);
+            wb.asyncHandshakeWalkStack(null);
         }
     }
 
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary A virtual thread that resumes on a different carrier emits
+ *          jdk.VirtualThreadCarrierMigration naming both carriers
+ * @requires vm.continuations & vm.hasJFR
+ * @run main/othervm -Djdk.virtualThreadScheduler.parallelism=4 TestCarrierMigrationEvent
+ */
+
+import java.nio.file.Path;
+import java.util.List;
+import java.util.concurrent.Executors;
+import java.util.concurrent.ExecutorService;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestCarrierMigrationEvent {
+    static final String EVENT_NAME = "jdk.VirtualThreadCarrierMigration";
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("migrations.jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME);
+            recording.start();
+            try (ExecutorService executor = Executors.newVirtualThreadPerTaskExecutor()) {
+                for (int i = 0; i < 100; i++) {
+                    executor.submit(() -> {
+                        for (int j = 0; j < 100; j++) {
+                            Thread.yield();
+                        }
+                    });
+                }
+            }
+            recording.stop();
+            recording.dump(file);
+        }
+
+        List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+        if (events.isEmpty()) {
+            throw new RuntimeException("No " + EVENT_NAME + " events recorded");
+        }
+        for (RecordedEvent e : events) {
+            long previous = e.getLong("previousCarrier");
+            long current = e.getThread("carrierThread").getJavaThreadId();
+            if (previous == 0 || previous == current) {
+                throw new RuntimeException("Not a migration: " + e);
+            }
+        }
+        System.out.println(events.size() + " carrier migrations recorded");
+    }
+}
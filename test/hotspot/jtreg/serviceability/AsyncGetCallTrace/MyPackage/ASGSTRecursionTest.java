@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package MyPackage;
+
+/**
+ * @test
+ * @summary Verifies that AsyncGetStackSample folds direct recursion into
+ *          single ring entries and covers the whole stack
+ * @compile ASGSTRecursionTest.java
+ * @requires os.family == "linux"
+ * @requires os.arch=="x86" | os.arch=="i386" | os.arch=="amd64" | os.arch=="x86_64" | os.arch=="arm" | os.arch=="aarch64" | os.arch=="ppc64" | os.arch=="s390" | os.arch=="riscv64"
+ * @requires vm.jvmti
+ * @run main/othervm/native -agentlib:AsyncGetCallTraceTest MyPackage.ASGSTRecursionTest
+ * @run main/othervm/native -Xint -agentlib:AsyncGetCallTraceTest MyPackage.ASGSTRecursionTest
+ */
+
+public class ASGSTRecursionTest {
+    static final int DEPTH = 1000;
+
+    static {
+        System.loadLibrary("AsyncGetCallTraceTest");
+    }
+
+    private static native boolean checkAsyncGetStackSampleCall(int depth);
+
+    static boolean recurse(int n) {
+        return n == 1 ? checkAsyncGetStackSampleCall(DEPTH) : recurse(n - 1);
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 3; i++) {
+            if (!recurse(DEPTH)) {
+                throw new RuntimeException("AsyncGetStackSample call failed");
+            }
+        }
+    }
+}
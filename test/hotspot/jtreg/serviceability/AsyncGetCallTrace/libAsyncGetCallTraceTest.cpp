@@ -266,4 +266,97 @@ Java_MyPackage_ASGCTBaseTest_checkAsyncGetCallTraceCall(JNIEnv* env, jclass cls)
   return true;
 }
 
+// A copy of the AsyncGetStackSample data structures.
+typedef struct {
+    jmethodID method_id;              // method of the frame, null for a sample header
+    jint bci;                         // frame: bci; header: frames walked
+    jint repeat;                      // frame: folded frames; header: entry count
+} ASGST_Frame;
+
+typedef struct {
+    ASGST_Frame *frames;              // 'capacity' entries
+    jint capacity;                    // number of entries in 'frames'
+    volatile unsigned int head;       // entries written so far
+} ASGST_Ring;
+
+typedef jint (*ASGSTType)(ASGST_Ring *, jint, void *);
+
+static bool CheckMethodName(jmethodID method_id, const char* expected) {
+  JvmtiDeallocator<char*> name;
+  jvmtiError err = jvmti->GetMethodName(method_id, name.get_addr(), nullptr, nullptr);
+  if (err != JVMTI_ERROR_NONE) {
+    fprintf(stderr, "CheckMethodName: Error in GetMethodName: %d\n", err);
+    return false;
+  }
+  if (strcmp(name.get(), expected) != 0) {
+    fprintf(stderr, "Name is not %s: %s\n", expected, name.get());
+    return false;
+  }
+  return true;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_MyPackage_ASGSTRecursionTest_checkAsyncGetStackSampleCall(JNIEnv* env, jclass cls, jint depth) {
+  ASGSTType asgst = reinterpret_cast<ASGSTType>(dlsym(RTLD_DEFAULT, "AsyncGetStackSample"));
+  if (asgst == nullptr) {
+    fprintf(stderr, "AsyncGetStackSample not found.\n");
+    return false;
+  }
+
+  // Far fewer entries than frames: the recursion has to be folded to fit.
+  const int CAPACITY = 64;
+  const int MAX_DEPTH = 4096;
+  ASGST_Frame frames[CAPACITY];
+  ASGST_Ring ring;
+  ring.frames = frames;
+  ring.capacity = CAPACITY;
+  ring.head = 0;
+
+  jint num_frames = asgst(&ring, MAX_DEPTH, nullptr);
+  if (num_frames <= depth) {
+    fprintf(stderr, "Expected more than %d frames, got %d\n", depth, num_frames);
+    return false;
+  }
+
+  ASGST_Frame* header = &frames[0];
+  if (header->method_id != nullptr || header->bci != num_frames ||
+      (unsigned int)header->repeat + 1 != ring.head) {
+    fprintf(stderr, "Bad header: %p %d %d, head %u\n",
+            header->method_id, header->bci, header->repeat, ring.head);
+    return false;
+  }
+
+  // The native frame of this function, the innermost recurse frame that
+  // called it, then a single entry for the rest of the recursion.
+  if (header->repeat < 3 || frames[1].bci != -3 ||
+      !CheckMethodName(frames[1].method_id, "checkAsyncGetStackSampleCall")) {
+    return false;
+  }
+  if (!CheckMethodName(frames[2].method_id, "recurse") ||
+      !CheckMethodName(frames[3].method_id, "recurse")) {
+    return false;
+  }
+  if (frames[2].repeat != 0 || frames[3].repeat != depth - 2) {
+    fprintf(stderr, "Expected %d folded frames, got %d and %d\n",
+            depth - 2, frames[2].repeat, frames[3].repeat);
+    return false;
+  }
+
+  // Unfolded, the sample must cover the same frames as GetStackTrace.
+  jint expanded = 0;
+  for (int i = 1; i <= header->repeat; i++) {
+    expanded += 1 + frames[i].repeat;
+  }
+  jthread thread;
+  jvmti->GetCurrentThread(&thread);
+  jint gstCount = 0;
+  jvmti->GetFrameCount(thread, &gstCount);
+  if (expanded != num_frames || gstCount != num_frames) {
+    fprintf(stderr, "Frame counts differ: sample %d, expanded %d, GetFrameCount %d\n",
+            num_frames, expanded, gstCount);
+    return false;
+  }
+  return true;
+}
+
 }
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Test that a heap dump can be streamed into an existing FIFO
+ * @requires os.family != "windows"
+ * @library /test/lib
+ * @run main/othervm HeapDumpToFifoTest
+ */
+
+import java.io.File;
+import java.io.InputStream;
+import java.nio.file.Files;
+import java.nio.file.StandardCopyOption;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.hprof.model.JavaClass;
+import jdk.test.lib.hprof.model.Snapshot;
+import jdk.test.lib.hprof.parser.Reader;
+
+public class HeapDumpToFifoTest {
+
+    static class Marker {}
+
+    static Marker[] markers = new Marker[10];
+
+    public static void main(String[] args) throws Exception {
+        for (int i = 0; i < markers.length; i++) {
+            markers[i] = new Marker();
+        }
+
+        File fifo = new File("dump.fifo");
+        Process mkfifo = new ProcessBuilder("mkfifo", fifo.getAbsolutePath()).inheritIO().start();
+        Asserts.assertEquals(0, mkfifo.waitFor(), "mkfifo failed");
+
+        // Copy whatever comes through the FIFO into a regular file to parse.
+        File dump = new File("dump.hprof");
+        Thread reader = new Thread(() -> {
+            try (InputStream in = Files.newInputStream(fifo.toPath())) {
+                Files.copy(in, dump.toPath(), StandardCopyOption.REPLACE_EXISTING);
+            } catch (Exception e) {
+                throw new RuntimeException(e);
+            }
+        });
+        reader.start();
+
+        // No -overwrite: an existing FIFO is opened as is, and the dump is
+        // written serially without segment files next to it.
+        new PidJcmdExecutor().execute("GC.heap_dump -parallel=4 " + fifo.getAbsolutePath())
+                             .shouldHaveExitValue(0)
+                             .shouldNotContain("Unable to create");
+        reader.join();
+
+        Asserts.assertFalse(new File(fifo.getAbsolutePath() + ".p0").exists(),
+                            "no segment files expected");
+
+        // The streamed dump is a complete HPROF file with all the markers.
+        try (Snapshot snapshot = Reader.readFile(dump.getPath(), true, 0)) {
+            snapshot.resolve(true);
+            JavaClass marker = snapshot.findClass(Marker.class.getName());
+            Asserts.assertNotNull(marker, "Marker class not in the dump");
+            Asserts.assertEquals(markers.length, marker.getInstancesCount(false),
+                                 "wrong number of Marker instances");
+        }
+    }
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+/*
+ * @test
+ * @summary Compiler.dump_profiles writes a CompileCommand file with the
+ *          tier 4 methods that a new JVM can load
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run testng/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                     -XX:-BackgroundCompilation DumpProfilesTest
+ */
+
+import java.lang.reflect.Method;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+import org.testng.Assert;
+import org.testng.annotations.Test;
+
+public class DumpProfilesTest {
+    static final WhiteBox WB = WhiteBox.getWhiteBox();
+    static final int TIER4 = 4;
+
+    static int hot(int x) {
+        return x * 31 + 7;
+    }
+
+    public void run(CommandExecutor executor) throws Exception {
+        Method m = DumpProfilesTest.class.getDeclaredMethod("hot", int.class);
+        WB.enqueueMethodForCompilation(m, TIER4);
+        Assert.assertEquals(WB.getMethodCompilationLevel(m), TIER4, "hot() not compiled at tier 4");
+
+        Path file = Path.of("hot_methods.txt");
+        executor.execute("Compiler.dump_profiles " + file.toAbsolutePath())
+                .shouldContain("hot methods to");
+
+        List<String> lines = Files.readAllLines(file);
+        Assert.assertTrue(lines.contains("CompileThresholdScaling,DumpProfilesTest.hot(I)I,0.1"),
+                          "hot() missing from " + lines);
+
+        // The file must be accepted by a new JVM.
+        OutputAnalyzer output = ProcessTools.executeTestJava("-XX:CompileCommandFile=" + file.toAbsolutePath(), "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("CompileCommand: An error occurred");
+    }
+
+    @Test
+    public void jmx() throws Exception {
+        run(new JMXExecutor());
+    }
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test of diagnostic command GC.epsilon_checkpoint
+ * @requires vm.gc.Epsilon
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver EpsilonCheckpointTest
+ */
+
+import java.io.BufferedReader;
+import java.io.InputStreamReader;
+import java.io.OutputStream;
+import java.lang.ref.Reference;
+import java.lang.ref.WeakReference;
+import java.lang.reflect.Field;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+/*
+ * The checkpoint and the reset are driven with jcmd from this process, so
+ * that nothing on the stack of the Epsilon VM refers to what the command
+ * itself allocates. The Epsilon VM runs Child, which stops at each step,
+ * prints its number and waits for a byte on stdin before going on.
+ */
+public class EpsilonCheckpointTest {
+    private static final String CHECKPOINT = "GC.epsilon_checkpoint";
+    private static final String RESET = "GC.epsilon_checkpoint -reset";
+
+    public static void main(String[] args) throws Exception {
+        ProcessBuilder pb = ProcessTools.createTestJavaProcessBuilder(
+            "-XX:+UnlockExperimentalVMOptions", "-XX:+UseEpsilonGC", "-Xmx256m",
+            // No compiled code, so that no nmethod refers to new objects.
+            "-Xint",
+            "--add-opens", "java.base/java.lang.ref=ALL-UNNAMED",
+            Child.class.getName());
+        Process child = pb.start();
+        BufferedReader in = new BufferedReader(new InputStreamReader(child.getInputStream()));
+        OutputStream out = child.getOutputStream();
+        PidJcmdExecutor jcmd = new PidJcmdExecutor(String.valueOf(child.pid()));
+
+        // Attach once, so that the attach listener thread exists before the
+        // first checkpoint. A reset with nothing allocated since succeeds.
+        awaitStep(in, 0);
+        jcmd.execute(CHECKPOINT).shouldContain("Checkpoint set");
+        jcmd.execute(RESET).shouldContain("Reset to checkpoint");
+        proceed(out);
+
+        // The child stores an object allocated after the checkpoint in a
+        // static field, so the reset has to be refused.
+        awaitStep(in, 1);
+        jcmd.execute(CHECKPOINT).shouldContain("Checkpoint set");
+        proceed(out);
+        awaitStep(in, 2);
+        jcmd.execute(RESET).shouldContain("Cannot reset to checkpoint")
+                           .shouldNotContain("Reset to checkpoint");
+        proceed(out);
+
+        // The child only keeps a WeakReference to what it allocates after
+        // the checkpoint, so the reset succeeds and clears the referent.
+        awaitStep(in, 3);
+        jcmd.execute(CHECKPOINT).shouldContain("Checkpoint set");
+        proceed(out);
+        awaitStep(in, 4);
+        jcmd.execute(RESET).shouldContain("Reset to checkpoint, discarded");
+        proceed(out);
+
+        awaitStep(in, 5);
+        OutputAnalyzer output = new OutputAnalyzer(child);
+        output.shouldHaveExitValue(0);
+    }
+
+    private static void awaitStep(BufferedReader in, int step) throws Exception {
+        String line = in.readLine();
+        if (line == null || Integer.parseInt(line.trim()) != step) {
+            throw new RuntimeException("Expected step " + step + ", got: " + line);
+        }
+    }
+
+    private static void proceed(OutputStream out) throws Exception {
+        out.write('\n');
+        out.flush();
+    }
+
+    public static class Child {
+        private static final Runtime RUNTIME = Runtime.getRuntime();
+        private static final WeakReference<Object> WEAK = new WeakReference<>(null);
+        private static Field referent;
+        private static Object retained;
+        private static long usedBeforeReset;
+
+        public static void main(String[] args) throws Exception {
+            referent = Reference.class.getDeclaredField("referent");
+            referent.setAccessible(true);
+            // Run every step once before the first checkpoint, so that no
+            // class loading, constant pool resolution or lazily created
+            // accessor allocates after it.
+            retain();
+            retained = null;
+            allocateGarbage();
+            referent.set(WEAK, null);
+            step(0);
+
+            step(1);
+            retain();
+            step(2);
+            retained = null;
+
+            step(3);
+            allocateGarbage();
+            usedBeforeReset = used();
+            step(4);
+            if (used() >= usedBeforeReset) {
+                throw new RuntimeException("Reset did not lower the used heap: " +
+                                           usedBeforeReset + " -> " + used());
+            }
+            if (WEAK.get() != null) {
+                throw new RuntimeException("Reset did not clear the WeakReference");
+            }
+            System.out.println(5);
+        }
+
+        // Print the step number and wait for the driver. println(int) only
+        // allocates temporaries that are dead once it returns.
+        private static void step(int n) throws Exception {
+            System.out.println(n);
+            System.out.flush();
+            if (System.in.read() < 0) {
+                throw new RuntimeException("Driver went away");
+            }
+        }
+
+        private static void retain() {
+            retained = new byte[1024];
+        }
+
+        // Allocates 1 MB that nothing refers to, plus an object that only
+        // WEAK refers to. Reference has no way to set a referent, so this
+        // writes the field directly.
+        private static void allocateGarbage() throws Exception {
+            for (int i = 0; i < 1024; i++) {
+                byte[] garbage = new byte[1024];
+            }
+            referent.set(WEAK, new Object());
+        }
+
+        private static long used() {
+            return RUNTIME.totalMemory() - RUNTIME.freeMemory();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Memory pool usage is exported as sun.rt.memoryPool.* perf counters
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run testng/othervm -XX:+UsePerfData MemoryPoolPerfCountersTest
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.MemoryPoolMXBean;
+
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import org.testng.annotations.Test;
+
+public class MemoryPoolPerfCountersTest {
+    public void run(CommandExecutor executor) {
+        System.gc();
+        OutputAnalyzer output = executor.execute("PerfCounter.print");
+        for (MemoryPoolMXBean pool : ManagementFactory.getMemoryPoolMXBeans()) {
+            output.shouldMatch("sun\\.rt\\.memoryPool\\.\\d+\\.name=\"" + pool.getName() + "\"");
+        }
+        output.shouldMatch("sun\\.rt\\.memoryPool\\.0\\.used=\\d+");
+        output.shouldMatch("sun\\.rt\\.memoryPool\\.0\\.committed=\\d+");
+        output.shouldMatch("sun\\.rt\\.memoryPool\\.0\\.afterGC\\.used=\\d+");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+}
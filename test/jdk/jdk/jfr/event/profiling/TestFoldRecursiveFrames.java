@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With JfrFoldRecursiveFrames, execution samples taken in a deep
+ *          recursion keep the root frame and record each recursive cycle once
+ * @requires vm.hasJFR
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+JfrFoldRecursiveFrames
+ *                   -Xint jdk.jfr.event.profiling.TestFoldRecursiveFrames
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+JfrFoldRecursiveFrames
+ *                   -XX:-Inline jdk.jfr.event.profiling.TestFoldRecursiveFrames
+ */
+
+package jdk.jfr.event.profiling;
+
+import java.nio.file.Path;
+import java.time.Duration;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Set;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedFrame;
+import jdk.jfr.consumer.RecordedStackTrace;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestFoldRecursiveFrames {
+    // Far deeper than the default JFR stack depth of 64, but within the
+    // eight times that many frames that may be folded.
+    static final int DEPTH = 400;
+    static final long SPIN_NANOS = Duration.ofSeconds(2).toNanos();
+
+    static volatile long sink;
+
+    static void spin() {
+        long end = System.nanoTime() + SPIN_NANOS;
+        while (System.nanoTime() < end) {
+            sink++;
+        }
+    }
+
+    static void recurse(int depth) {
+        if (depth == 0) {
+            spin();
+            return;
+        }
+        recurse(depth - 1);
+    }
+
+    static void ping(int depth) {
+        if (depth == 0) {
+            spin();
+            return;
+        }
+        pong(depth - 1);
+    }
+
+    static void pong(int depth) {
+        if (depth == 0) {
+            spin();
+            return;
+        }
+        ping(depth - 1);
+    }
+
+    public static void main(String[] args) throws Exception {
+        check("self", () -> recurse(DEPTH), Set.of("recurse"));
+        check("mutual", () -> ping(DEPTH), Set.of("ping", "pong"));
+    }
+
+    static void check(String name, Runnable recursion, Set<String> recursive) throws Exception {
+        Path file = Path.of("fold-" + name + ".jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable("jdk.ExecutionSample").withPeriod(Duration.ofMillis(10));
+            recording.start();
+            recursion.run();
+            recording.stop();
+            recording.dump(file);
+        }
+
+        String className = TestFoldRecursiveFrames.class.getName();
+        int samples = 0;
+        List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+        for (RecordedEvent event : events) {
+            RecordedStackTrace trace = event.getStackTrace();
+            if (trace == null || !isInRecursion(trace, className, recursive)) {
+                continue;
+            }
+            samples++;
+            // The harness may run main() from another thread, so main is
+            // not necessarily the root frame, but the walk must reach it.
+            List<RecordedFrame> frames = trace.getFrames();
+            if (trace.isTruncated() || !hasFrame(trace, className, "main")) {
+                throw new RuntimeException(name + ": main frame missing from " + trace);
+            }
+            // Every frame of a folded cycle is recorded once.
+            Set<String> seenFrames = new HashSet<>();
+            Set<String> seenMethods = new HashSet<>();
+            for (RecordedFrame frame : frames) {
+                String method = frame.getMethod().getName();
+                if (!recursive.contains(method)) {
+                    continue;
+                }
+                String key = method + "@" + frame.getBytecodeIndex() + " " + frame.getType();
+                if (!seenFrames.add(key)) {
+                    throw new RuntimeException(name + ": " + key + " recorded more than once in " + trace);
+                }
+                seenMethods.add(method);
+            }
+            if (!seenMethods.equals(recursive)) {
+                throw new RuntimeException(name + ": recursive frames missing from " + trace);
+            }
+        }
+        if (samples == 0) {
+            throw new RuntimeException(name + ": no execution samples taken in the recursion");
+        }
+        System.out.println(name + ": " + samples + " samples checked");
+    }
+
+    static boolean isInRecursion(RecordedStackTrace trace, String className, Set<String> recursive) {
+        for (String method : recursive) {
+            if (hasFrame(trace, className, method)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static boolean hasFrame(RecordedStackTrace trace, String className, String method) {
+        for (RecordedFrame frame : trace.getFrames()) {
+            if (frame.getMethod().getType().getName().equals(className) &&
+                frame.getMethod().getName().equals(method)) {
+                return true;
+            }
+        }
+        return false;
+    }
+}
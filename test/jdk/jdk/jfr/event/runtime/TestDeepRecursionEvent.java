@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary jdk.DeepRecursion is posted for methods that recurse at least
+ *          DeepRecursionEventDepth deep, and only for those
+ * @requires vm.hasJFR & vm.compiler1.enabled
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:+ProfileRecursionDepth
+ *                   -XX:DeepRecursionEventDepth=50 -XX:TieredStopAtLevel=3
+ *                   -XX:Tier0InvokeNotifyFreqLog=0 -XX:Tier3InvokeNotifyFreqLog=0
+ *                   jdk.jfr.event.runtime.TestDeepRecursionEvent
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordedMethod;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestDeepRecursionEvent {
+    static final String EVENT_NAME = "jdk.DeepRecursion";
+    static final int THRESHOLD = 50;
+    static final int ITERATIONS = 2_000;
+
+    static int sink;
+
+    static int below(int n) {
+        return n <= 1 ? 1 : below(n - 1) + 1;
+    }
+
+    static int at(int n) {
+        return n <= 1 ? 1 : at(n - 1) + 1;
+    }
+
+    static int above(int n) {
+        return n <= 1 ? 1 : above(n - 1) + 1;
+    }
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("deep-recursion.jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME).with("throttle", "off");
+            recording.start();
+
+            // Every invocation notifies the compilation policy, so the
+            // deepest activation of each recursion is sampled.
+            for (int i = 0; i < ITERATIONS; i++) {
+                sink += below(THRESHOLD - 1);
+                sink += at(THRESHOLD);
+                sink += above(4 * THRESHOLD);
+            }
+
+            recording.stop();
+            recording.dump(file);
+        }
+
+        List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+        int atEvents = 0;
+        int aboveEvents = 0;
+        for (RecordedEvent event : events) {
+            if (!event.getEventType().getName().equals(EVENT_NAME)) {
+                continue;
+            }
+            RecordedMethod method = event.getValue("method");
+            if (!method.getType().getName().equals(TestDeepRecursionEvent.class.getName())) {
+                continue;
+            }
+            // The depth is only measured up to the threshold
+            if (event.getInt("depth") != THRESHOLD) {
+                throw new RuntimeException("Unexpected depth: " + event);
+            }
+            switch (method.getName()) {
+                case "below" -> throw new RuntimeException("Event below the threshold: " + event);
+                case "at"    -> atEvents++;
+                case "above" -> aboveEvents++;
+                default      -> throw new RuntimeException("Unexpected method: " + event);
+            }
+        }
+        if (atEvents == 0) {
+            throw new RuntimeException("No " + EVENT_NAME + " event at the threshold");
+        }
+        if (aboveEvents == 0) {
+            throw new RuntimeException("No " + EVENT_NAME + " event above the threshold");
+        }
+    }
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary jdk.JavaMonitorDeflationCycle reports deflation cycles that are
+ *          limited by MonitorDeflationWalkMax
+ * @requires vm.hasJFR
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions -XX:MonitorDeflationWalkMax=1024
+ *                   -XX:GuaranteedAsyncDeflationInterval=100
+ *                   jdk.jfr.event.runtime.TestJavaMonitorDeflationCycleEvent
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestJavaMonitorDeflationCycleEvent {
+    static final String EVENT_NAME = "jdk.JavaMonitorDeflationCycle";
+    static final int WALK_MAX = 1024;
+    static final int MONITORS = 5_000;
+
+    static Object[] monitors = new Object[MONITORS];
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("deflation.jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME);
+            recording.start();
+
+            // Inflate the monitors, then keep the objects so that only the
+            // idle monitors can go.
+            for (int i = 0; i < MONITORS; i++) {
+                Object o = new Object();
+                synchronized (o) {
+                    o.wait(1);
+                }
+                monitors[i] = o;
+            }
+            Thread.sleep(5_000);
+
+            recording.stop();
+            recording.dump(file);
+        }
+
+        List<RecordedEvent> events = RecordingFile.readAllEvents(file);
+        long deflated = 0;
+        boolean sawPartial = false;
+        int cycles = 0;
+        for (RecordedEvent event : events) {
+            if (!event.getEventType().getName().equals(EVENT_NAME)) {
+                continue;
+            }
+            cycles++;
+            long examined = event.getLong("examined");
+            long cycleDeflated = event.getLong("deflated");
+            if (examined > WALK_MAX) {
+                throw new RuntimeException("Cycle examined more than MonitorDeflationWalkMax: " + event);
+            }
+            if (cycleDeflated > examined) {
+                throw new RuntimeException("Cycle deflated more monitors than it examined: " + event);
+            }
+            if (event.getBoolean("partial")) {
+                sawPartial = true;
+                if (examined != WALK_MAX) {
+                    throw new RuntimeException("Partial cycle did not use its budget: " + event);
+                }
+            }
+            deflated += cycleDeflated;
+        }
+        if (cycles == 0) {
+            throw new RuntimeException("No " + EVENT_NAME + " events");
+        }
+        if (!sawPartial) {
+            throw new RuntimeException("No partial deflation cycle in " + cycles + " cycles");
+        }
+        if (deflated < MONITORS) {
+            throw new RuntimeException("Only " + deflated + " monitors deflated in " + cycles + " cycles");
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary With TrimNativeHeapFreedThreshold, the native heap is only trimmed
+ *          once enough NMT-tracked memory was freed, and each trim posts
+ *          jdk.NativeHeapTrim
+ * @requires vm.hasJFR & os.family == "linux" & !vm.musl
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -XX:NativeMemoryTracking=summary -XX:TrimNativeHeapInterval=100
+ *                   -XX:+UnlockExperimentalVMOptions -XX:TrimNativeHeapFreedThreshold=64m
+ *                   jdk.jfr.event.runtime.TestNativeHeapTrimEvent
+ */
+
+package jdk.jfr.event.runtime;
+
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.internal.misc.Unsafe;
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.jfr.consumer.RecordingFile;
+
+public class TestNativeHeapTrimEvent {
+    static final String EVENT_NAME = "jdk.NativeHeapTrim";
+    static final long THRESHOLD = 64 * 1024 * 1024;
+    static final int CHUNK = 1024 * 1024;
+    static final int CHUNKS = 128;
+
+    static final Unsafe UNSAFE = Unsafe.getUnsafe();
+
+    static List<RecordedEvent> record(String name, Runnable action) throws Exception {
+        Path file = Path.of(name + ".jfr");
+        try (Recording recording = new Recording()) {
+            recording.enable(EVENT_NAME);
+            recording.start();
+            action.run();
+            recording.stop();
+            recording.dump(file);
+        }
+        return RecordingFile.readAllEvents(file).stream()
+                            .filter(e -> e.getEventType().getName().equals(EVENT_NAME))
+                            .toList();
+    }
+
+    static void sleep(long millis) {
+        try {
+            Thread.sleep(millis);
+        } catch (InterruptedException e) {
+            throw new RuntimeException(e);
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Without frees the periodic checks must not trim.
+        List<RecordedEvent> idle = record("idle", () -> sleep(2_000));
+        if (!idle.isEmpty()) {
+            throw new RuntimeException("Trimmed without freeing memory: " + idle);
+        }
+
+        // Keep the memory long enough for a check to see the high point,
+        // then free more than the threshold.
+        List<RecordedEvent> freed = record("freed", () -> {
+            long[] chunks = new long[CHUNKS];
+            for (int i = 0; i < CHUNKS; i++) {
+                chunks[i] = UNSAFE.allocateMemory(CHUNK);
+                UNSAFE.setMemory(chunks[i], CHUNK, (byte)1);
+            }
+            sleep(1_000);
+            for (long chunk : chunks) {
+                UNSAFE.freeMemory(chunk);
+            }
+            sleep(2_000);
+        });
+        if (freed.isEmpty()) {
+            throw new RuntimeException("No " + EVENT_NAME + " after freeing " + (CHUNKS * CHUNK) + " bytes");
+        }
+        for (RecordedEvent event : freed) {
+            if (event.getLong("freedSinceLastTrim") < THRESHOLD) {
+                throw new RuntimeException("Trimmed below the threshold: " + event);
+            }
+            if (event.getLong("rssBefore") == 0 || event.getLong("rssAfter") == 0) {
+                throw new RuntimeException("RSS not reported: " + event);
+            }
+        }
+    }
+}
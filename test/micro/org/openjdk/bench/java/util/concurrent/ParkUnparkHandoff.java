@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.java.util.concurrent;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.locks.LockSupport;
+
+/**
+ * Round trip of a handoff between two platform threads that wait for each
+ * other with LockSupport.park/unpark, with the pthread-based and the
+ * futex-based Parker.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class ParkUnparkHandoff {
+
+    private volatile boolean ping;
+    private volatile boolean stop;
+    private Thread caller;
+    private Thread partner;
+
+    @Setup(Level.Trial)
+    public void setup() {
+        caller = Thread.currentThread();
+        partner = new Thread(() -> {
+            while (!stop) {
+                while (!ping && !stop) {
+                    LockSupport.park();
+                }
+                ping = false;
+                LockSupport.unpark(caller);
+            }
+        });
+        partner.setDaemon(true);
+        partner.start();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown() throws InterruptedException {
+        stop = true;
+        LockSupport.unpark(partner);
+        partner.join();
+    }
+
+    private void roundTrip() {
+        ping = true;
+        LockSupport.unpark(partner);
+        while (ping) {
+            LockSupport.park();
+        }
+    }
+
+    @Benchmark
+    public void mutexParker() {
+        roundTrip();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UnlockExperimentalVMOptions", "-XX:+UseFutexParker"})
+    public void futexParker() {
+        roundTrip();
+    }
+
+    @Benchmark
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UnlockExperimentalVMOptions", "-XX:+UseFutexParker",
+                                      "-XX:ParkSpinLimit=2000"})
+    public void futexParkerSpin() {
+        roundTrip();
+    }
+}
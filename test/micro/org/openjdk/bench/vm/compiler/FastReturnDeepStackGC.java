@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Cost of a full collection requested from the top of a deep recursion in
+ * which every frame holds a live object. The heap is kept small so that
+ * scanning the frames of the recursing thread is a visible part of the
+ * pause. The nested classes rerun the benchmark with each collector.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MILLISECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xmx64m"})
+public class FastReturnDeepStackGC {
+
+    @Param({"100", "20000"})
+    public int depth;
+
+    static int descendReturn(int n, Object live) {
+        if (n <= 0) {
+            System.gc();
+            return live.hashCode();
+        }
+        return descendReturn(n - 1, new Object()) + live.hashCode();
+    }
+
+    static int descendFastReturn(int n, Object live) {
+        if (n <= 0) {
+            System.gc();
+            fastreturn live.hashCode();
+        }
+        fastreturn descendFastReturn(n - 1, new Object()) + live.hashCode();
+    }
+
+    @Benchmark
+    public int gcReturn() {
+        return descendReturn(depth, new Object());
+    }
+
+    @Benchmark
+    public int gcFastReturn() {
+        return descendFastReturn(depth, new Object());
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xmx64m", "-XX:+UseSerialGC"})
+    public static class Serial extends FastReturnDeepStackGC {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xmx64m", "-XX:+UseParallelGC"})
+    public static class Parallel extends FastReturnDeepStackGC {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xmx64m", "-XX:+UseZGC"})
+    public static class Z extends FastReturnDeepStackGC {}
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Cost of unwinding an exception through a deep recursion of methods
+ * without exception handlers. The preallocated exception isolates the
+ * per-frame handler lookup; the fresh one adds the stack trace fill-in.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-Xss64m"})
+public class FastReturnExceptions {
+
+    @Param({"100", "20000"})
+    public int depth;
+
+    static final RuntimeException PREALLOCATED = new RuntimeException("unwind", null, false, false);
+
+    static int descendReturn(int n, boolean fresh) {
+        if (n <= 0) {
+            throw fresh ? new RuntimeException("unwind") : PREALLOCATED;
+        }
+        return descendReturn(n - 1, fresh) + 1;
+    }
+
+    static int descendFastReturn(int n, boolean fresh) {
+        if (n <= 0) {
+            throw fresh ? new RuntimeException("unwind") : PREALLOCATED;
+        }
+        fastreturn descendFastReturn(n - 1, fresh) + 1;
+    }
+
+    @Benchmark
+    public Object preallocatedReturn() {
+        try {
+            return descendReturn(depth, false);
+        } catch (RuntimeException e) {
+            return e;
+        }
+    }
+
+    @Benchmark
+    public Object preallocatedFastReturn() {
+        try {
+            return descendFastReturn(depth, false);
+        } catch (RuntimeException e) {
+            return e;
+        }
+    }
+
+    @Benchmark
+    public Object freshReturn() {
+        try {
+            return descendReturn(depth, true);
+        } catch (RuntimeException e) {
+            return e;
+        }
+    }
+
+    @Benchmark
+    public Object freshFastReturn() {
+        try {
+            return descendFastReturn(depth, true);
+        } catch (RuntimeException e) {
+            return e;
+        }
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xint"})
+    public static class Interpreter extends FastReturnExceptions {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-XX:TieredStopAtLevel=1"})
+    public static class C1 extends FastReturnExceptions {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-XX:-TieredCompilation"})
+    public static class C2 extends FastReturnExceptions {}
+}
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Recursion-heavy kernels, each written once with {@code return} and once
+ * with {@code fastreturn}. The nested classes rerun the suite in the
+ * interpreter, with C1 only and with C2 only.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-Xss16m"})
+public class FastReturnRecursion {
+
+    @Param({"16", "1000"})
+    public int depth;
+
+    // A complete binary tree of the given height, as walked by the tree
+    // benchmarks. JSON and AST walkers typically recurse 8-12 levels deep.
+    @Param({"10"})
+    public int treeHeight;
+
+    private Node tree;
+
+    static final class Node {
+        final int value;
+        final Node left;
+        final Node right;
+
+        Node(int value, Node left, Node right) {
+            this.value = value;
+            this.left = left;
+            this.right = right;
+        }
+
+        static Node build(int height, int value) {
+            if (height == 0) {
+                return null;
+            }
+            return new Node(value, build(height - 1, 2 * value), build(height - 1, 2 * value + 1));
+        }
+    }
+
+    @Setup
+    public void setup() {
+        tree = Node.build(treeHeight, 1);
+    }
+
+    // Linear recursion: the call is not in tail position.
+
+    static int linearReturn(int n) {
+        if (n <= 0) {
+            return 0;
+        }
+        return n + linearReturn(n - 1);
+    }
+
+    static int linearFastReturn(int n) {
+        if (n <= 0) {
+            fastreturn 0;
+        }
+        fastreturn n + linearFastReturn(n - 1);
+    }
+
+    @Benchmark
+    public int linearReturn() {
+        return linearReturn(depth);
+    }
+
+    @Benchmark
+    public int linearFastReturn() {
+        return linearFastReturn(depth);
+    }
+
+    // Tail recursion: the fastreturn variant is a self tail call.
+
+    static int tailReturn(int n, int acc) {
+        if (n <= 0) {
+            return acc;
+        }
+        return tailReturn(n - 1, acc + n);
+    }
+
+    static int tailFastReturn(int n, int acc) {
+        if (n <= 0) {
+            fastreturn acc;
+        }
+        fastreturn tailFastReturn(n - 1, acc + n);
+    }
+
+    @Benchmark
+    public int tailReturn() {
+        return tailReturn(depth, 0);
+    }
+
+    @Benchmark
+    public int tailFastReturn() {
+        return tailFastReturn(depth, 0);
+    }
+
+    // Tree recursion with a fan-out of two.
+
+    static int treeReturn(Node node) {
+        if (node == null) {
+            return 0;
+        }
+        return node.value + treeReturn(node.left) + treeReturn(node.right);
+    }
+
+    static int treeFastReturn(Node node) {
+        if (node == null) {
+            fastreturn 0;
+        }
+        fastreturn node.value + treeFastReturn(node.left) + treeFastReturn(node.right);
+    }
+
+    @Benchmark
+    public int treeReturn() {
+        return treeReturn(tree);
+    }
+
+    @Benchmark
+    public int treeFastReturn() {
+        return treeFastReturn(tree);
+    }
+
+    // Mutual recursion through two methods.
+
+    static boolean isEvenReturn(int n) {
+        if (n == 0) {
+            return true;
+        }
+        return isOddReturn(n - 1);
+    }
+
+    static boolean isOddReturn(int n) {
+        if (n == 0) {
+            return false;
+        }
+        return isEvenReturn(n - 1);
+    }
+
+    static boolean isEvenFastReturn(int n) {
+        if (n == 0) {
+            fastreturn true;
+        }
+        fastreturn isOddFastReturn(n - 1);
+    }
+
+    static boolean isOddFastReturn(int n) {
+        if (n == 0) {
+            fastreturn false;
+        }
+        fastreturn isEvenFastReturn(n - 1);
+    }
+
+    @Benchmark
+    public boolean mutualReturn() {
+        return isEvenReturn(depth);
+    }
+
+    @Benchmark
+    public boolean mutualFastReturn() {
+        return isEvenFastReturn(depth);
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss16m", "-Xint"})
+    public static class Interpreter extends FastReturnRecursion {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss16m", "-XX:TieredStopAtLevel=1"})
+    public static class C1 extends FastReturnRecursion {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss16m", "-XX:-TieredCompilation"})
+    public static class C2 extends FastReturnRecursion {}
+}
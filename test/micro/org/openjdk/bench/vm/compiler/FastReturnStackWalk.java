@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Cost of walking a deep stack of recursive frames from its top, once with
+ * StackWalker and once with Thread.getStackTrace. The frames below the walk
+ * return with either {@code return} or {@code fastreturn}.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3, jvmArgsAppend = {"-Xss64m"})
+public class FastReturnStackWalk {
+
+    @Param({"100", "5000"})
+    public int depth;
+
+    static final StackWalker WALKER = StackWalker.getInstance();
+
+    static long walk(boolean stackTrace) {
+        if (stackTrace) {
+            return Thread.currentThread().getStackTrace().length;
+        }
+        return WALKER.walk(frames -> frames.count());
+    }
+
+    static long descendReturn(int n, boolean stackTrace) {
+        if (n <= 0) {
+            return walk(stackTrace);
+        }
+        return descendReturn(n - 1, stackTrace) + 1;
+    }
+
+    static long descendFastReturn(int n, boolean stackTrace) {
+        if (n <= 0) {
+            fastreturn walk(stackTrace);
+        }
+        fastreturn descendFastReturn(n - 1, stackTrace) + 1;
+    }
+
+    @Benchmark
+    public long stackWalkerReturn() {
+        return descendReturn(depth, false);
+    }
+
+    @Benchmark
+    public long stackWalkerFastReturn() {
+        return descendFastReturn(depth, false);
+    }
+
+    @Benchmark
+    public long stackTraceReturn() {
+        return descendReturn(depth, true);
+    }
+
+    @Benchmark
+    public long stackTraceFastReturn() {
+        return descendFastReturn(depth, true);
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-Xint"})
+    public static class Interpreter extends FastReturnStackWalk {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-XX:TieredStopAtLevel=1"})
+    public static class C1 extends FastReturnStackWalk {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xss64m", "-XX:-TieredCompilation"})
+    public static class C2 extends FastReturnStackWalk {}
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Recursion inside a virtual thread that yields at the bottom of the
+ * recursion, so every yield freezes and thaws the whole recursive stack.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.MICROSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(3)
+public class FastReturnVirtualThreads {
+
+    @Param({"16", "1000"})
+    public int depth;
+
+    @Param({"1", "10"})
+    public int yields;
+
+    static int recurseReturn(int n, int yields) {
+        if (n <= 0) {
+            for (int i = 0; i < yields; i++) {
+                Thread.yield();
+            }
+            return 0;
+        }
+        return recurseReturn(n - 1, yields) + 1;
+    }
+
+    static int recurseFastReturn(int n, int yields) {
+        if (n <= 0) {
+            for (int i = 0; i < yields; i++) {
+                Thread.yield();
+            }
+            fastreturn 0;
+        }
+        fastreturn recurseFastReturn(n - 1, yields) + 1;
+    }
+
+    @Benchmark
+    public void recurseReturn() throws InterruptedException {
+        Thread.ofVirtual().start(() -> recurseReturn(depth, yields)).join();
+    }
+
+    @Benchmark
+    public void recurseFastReturn() throws InterruptedException {
+        Thread.ofVirtual().start(() -> recurseFastReturn(depth, yields)).join();
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-Xint"})
+    public static class Interpreter extends FastReturnVirtualThreads {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:TieredStopAtLevel=1"})
+    public static class C1 extends FastReturnVirtualThreads {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:-TieredCompilation"})
+    public static class C2 extends FastReturnVirtualThreads {}
+}